@@ -0,0 +1,51 @@
+/**
+ * BenchmarkUtils.h
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Minimal std::chrono timing helpers shared by the benchmark executables
+ */
+
+#ifndef BENCHMARKUTILS_H
+#define BENCHMARKUTILS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace bench {
+
+    // Keeps the optimizer from discarding a result
+    template <typename T>
+    inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Best-of-N wall time of fn() in milliseconds
+     */
+    template <typename Fn>
+    double BestOf(int repetitions, Fn&& fn) {
+        double best = 1e300;
+        for (int i = 0; i < repetitions; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+    inline void Report(const char* name, double ms, size_t items) {
+        std::printf("%-40s %10.3f ms %10.2f Mitems/s\n", name, ms, items / (ms * 1e3));
+    }
+
+} // namespace bench
+
+#endif // BENCHMARKUTILS_H
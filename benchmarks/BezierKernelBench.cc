@@ -0,0 +1,73 @@
+// BezierKernelBench.cc
+// 차수별 Bezier 평가: 런타임 n 루프 vs 컴파일 타임 차수 커널
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "BezierEvaluator.h"
+#include "CurveDerivatives.h"
+#include "FixedDegreeBezier.h"
+
+int main(int argc, char** argv) {
+    const size_t samples = argc > 1 ? std::stoul(argv[1]) : 2000000;
+    const int numSegments = 100;
+    const size_t curves = samples / (numSegments + 1);
+    const int repetitions = 5;
+
+    for (int degree = 2; degree <= 8; ++degree) {
+        std::vector<Vector3> controlPoints;
+        for (int i = 0; i <= degree; ++i)
+            controlPoints.emplace_back(float(i), std::sin(float(i)), std::cos(float(i) * 0.5f));
+        const BezierKernelSet* kernel = FixedDegreeBezier::Find(degree);
+        CurveDerivatives generic(controlPoints);
+        std::printf("-- degree %d (%d control points)\n", degree, degree + 1);
+
+        auto pointBench = [&](const char* label, auto&& evaluate) {
+            std::string name = std::string("  point ") + label;
+            bench::Report(name.c_str(), bench::BestOf(repetitions, [&] {
+                Vector3 sum;
+                for (size_t i = 0; i < samples; ++i)
+                    sum += evaluate(static_cast<float>(i % 1024) * (1.0f / 1023.0f));
+                bench::DoNotOptimize(sum);
+            }), samples);
+        };
+        const BezierEvaluator& horner = BezierEvaluator::Get(BezierMethod::Horner);
+        const BezierEvaluator& deCasteljau = BezierEvaluator::Get(BezierMethod::DeCasteljau);
+        pointBench("Horner (runtime n)", [&](float t) { return horner.Evaluate(controlPoints, t); });
+        pointBench("DeCasteljau (runtime n)", [&](float t) { return deCasteljau.Evaluate(controlPoints, t); });
+        pointBench("BezierKernel<N>", [&](float t) { return kernel->Point(controlPoints.data(), t); });
+
+        auto derivativeBench = [&](const char* label, auto&& evaluate) {
+            std::string name = std::string("  B' + B'' ") + label;
+            bench::Report(name.c_str(), bench::BestOf(repetitions, [&] {
+                Vector3 sum;
+                for (size_t i = 0; i < samples; ++i)
+                    sum += evaluate(static_cast<float>(i % 1024) * (1.0f / 1023.0f));
+                bench::DoNotOptimize(sum);
+            }), samples);
+        };
+        derivativeBench("hodograph Horner", [&](float t) { return generic.FirstDerivative(t) + generic.SecondDerivative(t); });
+        derivativeBench("BezierKernel<N>", [&](float t) {
+            return kernel->FirstDerivative(controlPoints.data(), t) + kernel->SecondDerivative(controlPoints.data(), t);
+        });
+
+        auto uniformBench = [&](const char* label, BezierMethod method) {
+            std::string name = std::string("  uniform x101 ") + label;
+            const BezierEvaluator& evaluator = BezierEvaluator::Get(method);
+            std::vector<Vector3> out;
+            bench::Report(name.c_str(), bench::BestOf(repetitions, [&] {
+                for (size_t c = 0; c < curves; ++c) {
+                    evaluator.EvaluateUniform(controlPoints, numSegments, out);
+                    bench::DoNotOptimize(out);
+                }
+            }), curves * (numSegments + 1));
+        };
+        uniformBench("Horner", BezierMethod::Horner);
+        uniformBench("BasisTable", BezierMethod::BasisTable);
+        uniformBench("FixedDegree", BezierMethod::FixedDegree);
+    }
+    return 0;
+}
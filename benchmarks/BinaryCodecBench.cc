@@ -0,0 +1,63 @@
+// BinaryCodecBench.cc
+// BearingVector 직렬화: nlohmann JSON vs BinaryCodec
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "BinaryCodec.h"
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const int repetitions = 5;
+
+    // 노드당 베어링 4개
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::vector<BearingVector> bearings;
+    bearings.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        NodeVector node(static_cast<int>(i / 4), Vector3(float(i / 4), 0.0f, 0.0f));
+        bearings.emplace_back(node, Vector3(coord(rng), coord(rng), coord(rng)), Vector3(coord(rng), coord(rng), coord(rng)));
+    }
+
+    std::string text;
+    bench::Report("json encode (toJson + dump)", bench::BestOf(repetitions, [&] {
+        json array = json::array();
+        for (const auto& bearing : bearings)
+            array.push_back(bearing.toJson());
+        text = array.dump();
+        bench::DoNotOptimize(text);
+    }), count);
+    bench::Report("json decode (parse + fromJson)", bench::BestOf(repetitions, [&] {
+        json array = json::parse(text);
+        std::vector<BearingVector> decoded;
+        decoded.reserve(array.size());
+        for (const auto& j : array)
+            decoded.push_back(BearingVector::fromJson(j));
+        bench::DoNotOptimize(decoded);
+    }), count);
+
+    std::vector<uint8_t> buffer;
+    bench::Report("binary encode", bench::BestOf(repetitions, [&] {
+        buffer.clear();
+        BinaryCodec::Encode(bearings, buffer);
+        bench::DoNotOptimize(buffer);
+    }), count);
+    bench::Report("binary decode", bench::BestOf(repetitions, [&] {
+        std::vector<BearingVector> decoded;
+        BinaryCodec::Decode(BinaryView(buffer.data(), buffer.size()), decoded);
+        bench::DoNotOptimize(decoded);
+    }), count);
+    bench::Report("binary view (read directions in place)", bench::BestOf(repetitions, [&] {
+        BinaryView view(buffer.data(), buffer.size());
+        Vector3 sum;
+        for (size_t i = 0; i < view.Count(); ++i)
+            sum += view.BearingDirection(i);
+        bench::DoNotOptimize(sum);
+    }), count);
+
+    std::printf("json: %zu bytes, binary: %zu bytes\n", text.size(), buffer.size());
+    return 0;
+}
@@ -0,0 +1,70 @@
+// CoordinateConverterBench.cc
+// 단일 호출 libm 변환과 배치 Exact / Fast / Approx 경로 비교
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "CoordinateConverter.h"
+#include "CpuFeatures.h"
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const int repetitions = 5;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+    std::uniform_real_distribution<float> polar(0.0f, 3.14f);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+
+    std::vector<SphericalVector> spherical(count);
+    std::vector<CartesianVector> cartesian(count);
+    for (size_t i = 0; i < count; ++i) {
+        spherical[i] = SphericalVector(1.0f + coord(rng) * coord(rng), angle(rng), polar(rng));
+        cartesian[i] = CartesianVector(coord(rng), coord(rng), coord(rng));
+    }
+
+    std::vector<CartesianVector> cartesianOut(count);
+    std::vector<SphericalVector> sphericalOut(count);
+
+    std::printf("%zu vectors, detected SIMD: %s\n", count, CpuFeatures::Name(CpuFeatures::Detect()));
+
+    bench::Report("sphericalToCartesian (per call)", bench::BestOf(repetitions, [&] {
+        for (size_t i = 0; i < count; ++i)
+            cartesianOut[i] = CoordinateConverter::sphericalToCartesian(spherical[i]);
+        bench::DoNotOptimize(cartesianOut);
+    }), count);
+    bench::Report("cartesianToSpherical (per call)", bench::BestOf(repetitions, [&] {
+        for (size_t i = 0; i < count; ++i)
+            sphericalOut[i] = CoordinateConverter::cartesianToSpherical(cartesian[i]);
+        bench::DoNotOptimize(sphericalOut);
+    }), count);
+
+    const struct { ConversionAccuracy accuracy; const char* name; } tiers[] = {
+        {ConversionAccuracy::Exact, "Exact"},
+        {ConversionAccuracy::Fast, "Fast"},
+        {ConversionAccuracy::Approx, "Approx"},
+    };
+
+    for (SimdLevel level : {SimdLevel::Scalar, CpuFeatures::Detect()}) {
+        CpuFeatures::Override(level);
+        for (const auto& tier : tiers) {
+            if (tier.accuracy == ConversionAccuracy::Exact && level != SimdLevel::Scalar)
+                continue; // Exact never dispatches to SIMD
+            std::string prefix = std::string(tier.name) + "/" + CpuFeatures::Name(level);
+            bench::Report((prefix + " sphericalToCartesian").c_str(), bench::BestOf(repetitions, [&] {
+                CoordinateConverter::sphericalToCartesian(spherical.data(), cartesianOut.data(), count, tier.accuracy);
+                bench::DoNotOptimize(cartesianOut);
+            }), count);
+            bench::Report((prefix + " cartesianToSpherical").c_str(), bench::BestOf(repetitions, [&] {
+                CoordinateConverter::cartesianToSpherical(cartesian.data(), sphericalOut.data(), count, tier.accuracy);
+                bench::DoNotOptimize(sphericalOut);
+            }), count);
+        }
+        if (level == SimdLevel::Scalar && CpuFeatures::Detect() == SimdLevel::Scalar)
+            break;
+    }
+    CpuFeatures::ClearOverride();
+    return 0;
+}
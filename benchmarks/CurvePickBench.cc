@@ -0,0 +1,110 @@
+// CurvePickBench.cc
+// 곡선 피킹/최근접점: 캐시 점 전수 조사 vs 곡선별 정확 질의 전수 조사 vs SegmentBVH + CurveQuery
+// (전수 조사는 질의 10 개, BVH 는 질의 1000 개의 합계 시간)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "LinearSegment.h"
+#include "SegmentManager.h"
+#include "Vertex.h"
+#include "thread.h"
+
+int main(int argc, char** argv) {
+    const std::size_t side = argc > 1 ? std::stoul(argv[1]) : 316; // side^2 segments
+    const int repetitions = 3;
+    const std::size_t queries = 1000;
+
+    std::deque<Vertex> vertices;
+    TaskScheduler scheduler(1);
+    SegmentManager manager(scheduler);
+    for (std::size_t y = 0; y < side; ++y) {
+        for (std::size_t x = 0; x < side; ++x) {
+            float fx = static_cast<float>(x), fy = static_cast<float>(y);
+            NodeVector a(0, Vector3(fx, fy, std::sin(fx * 0.1f)));
+            NodeVector b(1, Vector3(fx + 0.8f, fy + 0.3f, std::cos(fy * 0.1f)));
+            vertices.emplace_back();
+            vertices.back().UpdateNodeVector(a);
+            vertices.back().PostBearingVector(BearingVector(a, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.3f, 0.6f, 0.4f)));
+            Vertex& start = vertices.back();
+            vertices.emplace_back();
+            vertices.back().UpdateNodeVector(b);
+            manager.AddLinearSegment(start, vertices.back(), 0.5f, 20);
+        }
+    }
+    const std::size_t count = manager.LinearSegmentCount();
+    std::printf("-- %zu segments\n", count);
+    bench::Report("build (tessellate + BVH)", bench::BestOf(1, [&] { manager.UpdateSpatialIndex(); }), count);
+    bench::Report("update, nothing dirty", bench::BestOf(repetitions, [&] { manager.UpdateSpatialIndex(); }), count);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coordinate(0.0f, static_cast<float>(side));
+    std::vector<Vector3> points(queries);
+    for (Vector3& p : points) p = Vector3(coordinate(rng), coordinate(rng), 0.5f);
+
+    // Closest point
+    {
+        float sum = 0.0f;
+        bench::Report("closest: cached points, brute force", bench::BestOf(1, [&] {
+            for (std::size_t q = 0; q < 10; ++q) {
+                float best = 1e30f;
+                for (std::size_t i = 0; i < count; ++i)
+                    for (const Vector3& p : *manager.GetLinearSegment(i).GetLinearSegmentCache())
+                        best = std::min(best, p.distance(points[q]));
+                sum += best;
+            }
+        }), 10);
+        bench::Report("closest: exact per segment, brute force", bench::BestOf(1, [&] {
+            for (std::size_t q = 0; q < 10; ++q) {
+                float best = 1e30f;
+                for (std::size_t i = 0; i < count; ++i) {
+                    CurveHit hit;
+                    if (manager.GetLinearSegment(i).ClosestPoint(points[q], best, hit)) best = hit.Distance;
+                }
+                sum += best;
+            }
+        }), 10);
+        bench::Report("closest: BVH + CurveQuery", bench::BestOf(repetitions, [&] {
+            for (const Vector3& p : points) {
+                SegmentHit hit;
+                if (manager.ClosestSegment(p, 1e30f, hit)) sum += hit.Hit.Distance;
+            }
+        }), queries);
+        bench::DoNotOptimize(sum);
+    }
+
+    // Ray pick, looking down -z with a slight tilt
+    {
+        const Vector3 direction(0.05f, -0.03f, -1.0f);
+        const float radius = 0.25f;
+        float sum = 0.0f;
+        bench::Report("pick: cached points, brute force", bench::BestOf(1, [&] {
+            Vector3 d = direction.normalized();
+            for (std::size_t q = 0; q < 10; ++q) {
+                Vector3 origin = points[q] + Vector3(0.0f, 0.0f, 20.0f);
+                float best = radius;
+                for (std::size_t i = 0; i < count; ++i) {
+                    for (const Vector3& p : *manager.GetLinearSegment(i).GetLinearSegmentCache()) {
+                        Vector3 w = p - origin;
+                        best = std::min(best, (w - d * std::max(0.0f, w.dot(d))).magnitude());
+                    }
+                }
+                sum += best;
+            }
+        }), 10);
+        bench::Report("pick: BVH + CurveQuery", bench::BestOf(repetitions, [&] {
+            for (const Vector3& p : points) {
+                SegmentHit hit;
+                if (manager.PickSegment(p + Vector3(0.0f, 0.0f, 20.0f), direction, radius, hit)) sum += hit.Hit.Distance;
+            }
+        }), queries);
+        bench::DoNotOptimize(sum);
+    }
+    return 0;
+}
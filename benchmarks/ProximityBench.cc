@@ -0,0 +1,104 @@
+// ProximityBench.cc
+// 세그먼트 간 근접/교차 검출: 테셀레이션 캐시 전수 비교 O(N^2 * samples^2) vs BVH broad phase + 제어 다각형 분할 narrow phase
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "LinearSegment.h"
+#include "SegmentManager.h"
+#include "Vertex.h"
+#include "thread.h"
+
+namespace {
+
+    // Random-walk chains tangled inside a cube of the given size; dense enough that many curves cross
+    void BuildTangle(std::deque<Vertex>& vertices, SegmentManager& manager, std::size_t segments, float size,
+                     std::size_t chainLength) {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> position(0.0f, size);
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+        int id = 0;
+        while (manager.LinearSegmentCount() < segments) {
+            Vector3 p(position(rng), position(rng), position(rng));
+            for (std::size_t k = 0; k <= chainLength && manager.LinearSegmentCount() < segments; ++k) {
+                NodeVector node(id++, p);
+                vertices.emplace_back();
+                vertices.back().UpdateNodeVector(node);
+                vertices.back().PostBearingVector(
+                    BearingVector(node, Vector3(step(rng), step(rng), step(rng)), Vector3(step(rng), step(rng), step(rng))));
+                if (k > 0)
+                    manager.AddLinearSegment(vertices[vertices.size() - 2], vertices.back(), 0.5f, 20);
+                p = p + Vector3(step(rng), step(rng), step(rng));
+            }
+        }
+    }
+
+    // Baseline: every pair of cached sample points of every pair of segments
+    std::size_t BruteForce(SegmentManager& manager, float clearance) {
+        std::size_t pairs = 0;
+        for (std::size_t a = 0; a < manager.LinearSegmentCount(); ++a) {
+            const LinearSegment& segmentA = manager.GetLinearSegment(a);
+            for (std::size_t b = a + 1; b < manager.LinearSegmentCount(); ++b) {
+                const LinearSegment& segmentB = manager.GetLinearSegment(b);
+                if (segmentA.SharesVertex(segmentB)) continue;
+                bool near = false;
+                for (const Vector3& p : *segmentA.GetLinearSegmentCache()) {
+                    for (const Vector3& q : *segmentB.GetLinearSegmentCache()) {
+                        if (p.distance(q) <= clearance) { near = true; break; }
+                    }
+                    if (near) break;
+                }
+                pairs += near;
+            }
+        }
+        return pairs;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t workers = argc > 1 ? std::stoul(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+    const float clearance = 0.05f;
+    std::printf("-- %zu workers, clearance %.2f\n", workers, clearance);
+
+    // 1) Small scene: both methods
+    {
+        std::deque<Vertex> vertices;
+        TaskScheduler scheduler(workers);
+        SegmentManager manager(scheduler);
+        BuildTangle(vertices, manager, 1000, 12.0f, 8);
+        manager.UpdateSpatialIndex();
+        std::size_t naive = 0, detected = 0;
+        bench::Report("1k: cache points, all pairs", bench::BestOf(1, [&] { naive = BruteForce(manager, clearance); }), 1000);
+        bench::Report("1k: BVH + subdivision", bench::BestOf(3, [&] { detected = manager.FindProximities(clearance).size(); }), 1000);
+        std::printf("   pairs: cache points %zu, exact %zu\n", naive, detected);
+    }
+
+    // 2) Stress: 100k segments, serial vs parallel
+    {
+        std::deque<Vertex> vertices;
+        TaskScheduler serial(1);
+        TaskScheduler parallel(workers);
+        SegmentManager manager(parallel);
+        BuildTangle(vertices, manager, 100000, 55.0f, 32);
+        bench::Report("100k: tessellate + BVH", bench::BestOf(1, [&] { manager.UpdateSpatialIndex(); }), 100000);
+        std::size_t detected = 0;
+        bench::Report("100k: BVH + subdivision, parallel", bench::BestOf(3, [&] { detected = manager.FindProximities(clearance).size(); }), 100000);
+
+        SegmentManager single(serial);
+        for (std::size_t i = 0; i < manager.LinearSegmentCount(); ++i) {
+            const LinearSegment& segment = manager.GetLinearSegment(i);
+            single.AddLinearSegment(segment.GetStartVertex(), segment.GetEndVertex(), 0.5f, 20);
+        }
+        single.UpdateSpatialIndex();
+        bench::Report("100k: BVH + subdivision, 1 worker", bench::BestOf(3, [&] { detected = single.FindProximities(clearance).size(); }), 100000);
+        std::printf("   pairs: %zu\n", detected);
+    }
+    return 0;
+}
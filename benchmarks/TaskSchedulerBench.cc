@@ -0,0 +1,120 @@
+// TaskSchedulerBench.cc
+// 작업 분배: std::thread-per-job vs 단일 큐 ThreadPool vs work-stealing TaskScheduler
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "LinearSegment.h"
+#include "Vertex.h"
+#include "thread.h"
+
+namespace {
+
+    // CPU-only job of roughly `units` x 1 us
+    float Work(std::size_t seed, int units) {
+        float sum = 0.0f;
+        for (int i = 0; i < units * 200; ++i)
+            sum += std::sin(static_cast<float>(seed + i) * 1e-3f);
+        return sum;
+    }
+
+    // Naive baseline: one std::thread per piece
+    template <typename Body>
+    void ThreadPerJob(std::size_t count, std::size_t chunkSize, Body&& body) {
+        std::vector<std::thread> threads;
+        for (std::size_t begin = 0; begin < count; begin += chunkSize)
+            threads.emplace_back([&body, begin, end = std::min(count, begin + chunkSize)]() { body(begin, end); });
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t workers = argc > 1 ? std::stoul(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+    const int repetitions = 5;
+    ThreadPool pool(workers);
+    TaskScheduler scheduler(workers);
+    std::printf("-- %zu workers\n", workers);
+
+    // 1) Many small independent jobs
+    {
+        const std::size_t jobs = 4096;
+        std::vector<float> out(jobs);
+        auto body = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) out[i] = Work(i, 4);
+        };
+        bench::Report("small jobs: thread per job", bench::BestOf(repetitions, [&] { ThreadPerJob(jobs, 1, body); }), jobs);
+        bench::Report("small jobs: single queue (Submit)", bench::BestOf(repetitions, [&] {
+            std::vector<std::future<void>> futures;
+            futures.reserve(jobs);
+            for (std::size_t i = 0; i < jobs; ++i) futures.push_back(pool.Submit([&body, i]() { body(i, i + 1); }));
+            for (std::future<void>& future : futures) future.get();
+        }), jobs);
+        bench::Report("small jobs: work stealing (TaskGroup)", bench::BestOf(repetitions, [&] {
+            TaskGroup group(scheduler);
+            for (std::size_t i = 0; i < jobs; ++i) group.Run([&body, i]() { body(i, i + 1); });
+            group.Wait();
+        }), jobs);
+        bench::DoNotOptimize(out);
+    }
+
+    // 2) Imbalanced loop: cost grows 1..64 units across the range, large chunks
+    {
+        const std::size_t count = 2048;
+        const std::size_t chunk = count / (workers * 2) + 1;
+        std::vector<float> out(count);
+        auto body = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) out[i] = Work(i, 1 + static_cast<int>(i * 64 / count));
+        };
+        bench::Report("imbalanced: thread per chunk", bench::BestOf(repetitions, [&] { ThreadPerJob(count, chunk, body); }), count);
+        bench::Report("imbalanced: single queue ParallelFor", bench::BestOf(repetitions, [&] { pool.ParallelFor(count, chunk, body); }), count);
+        bench::Report("imbalanced: work stealing ParallelFor", bench::BestOf(repetitions, [&] { scheduler.ParallelFor(count, 0, body); }), count);
+        bench::DoNotOptimize(out);
+    }
+
+    // 3) Segment tessellation (LinearSegment rebuilds, 101 samples each)
+    {
+        const std::size_t segments = 20000;
+        std::deque<Vertex> vertices(segments + 1);
+        for (std::size_t i = 0; i <= segments; ++i) {
+            NodeVector node(static_cast<int>(i), Vector3(static_cast<float>(i), std::sin(i * 0.5f), 0.0f));
+            vertices[i].UpdateNodeVector(node);
+            vertices[i].PostBearingVector(BearingVector(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(1.0f, std::cos(i * 0.3f), 0.2f)));
+        }
+        std::vector<std::unique_ptr<LinearSegment>> list;
+        for (std::size_t i = 0; i < segments; ++i)
+            list.push_back(std::make_unique<LinearSegment>(vertices[i], vertices[i + 1], 0.5f, 100, true));
+        // Every run edits alpha first, so each Commit is a full rebuild
+        float alpha = 0.3f;
+        auto body = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                list[i]->SetAlpha(alpha);
+                list[i]->Commit();
+            }
+        };
+        const std::size_t chunk = (segments + workers - 1) / workers;
+        bench::Report("tessellate: thread per chunk", bench::BestOf(repetitions, [&] {
+            alpha = 1.0f - alpha;
+            ThreadPerJob(segments, chunk, body);
+        }), segments);
+        bench::Report("tessellate: single queue ParallelFor", bench::BestOf(repetitions, [&] {
+            alpha = 1.0f - alpha;
+            pool.ParallelFor(segments, 32, body);
+        }), segments);
+        bench::Report("tessellate: work stealing ParallelFor", bench::BestOf(repetitions, [&] {
+            alpha = 1.0f - alpha;
+            scheduler.ParallelFor(segments, 32, body);
+        }), segments);
+    }
+
+    std::printf("steals: %zu\n", scheduler.StealCount());
+    return 0;
+}
@@ -0,0 +1,72 @@
+// VertexPoolBench.cc
+// 정점 로딩: Vertex 객체 vs VertexPool (Post / 바이너리 Load)
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "BinaryCodec.h"
+#include "VertexPool.h"
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const size_t bearingsPerVertex = 3;
+    const int repetitions = 3;
+
+    auto makeNode = [](size_t i) { return NodeVector(static_cast<int>(i), Vector3(float(i), 0.0f, 0.0f)); };
+    auto makeBearing = [](const NodeVector& node, size_t b) {
+        return BearingVector(node, Vector3(1.0f, float(b), 0.0f), Vector3(0.0f, 0.0f, 1.0f));
+    };
+
+    bench::Report("Vertex objects (Post)", bench::BestOf(repetitions, [&] {
+        std::vector<std::unique_ptr<Vertex>> vertices;
+        vertices.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            auto vertex = std::make_unique<Vertex>();
+            NodeVector node = makeNode(i);
+            vertex->UpdateNodeVector(node);
+            for (size_t b = 0; b < bearingsPerVertex; ++b)
+                vertex->PostBearingVector(makeBearing(node, b));
+            vertices.push_back(std::move(vertex));
+        }
+        bench::DoNotOptimize(vertices);
+    }), count);
+
+    bench::Report("VertexPool (Create + Post)", bench::BestOf(repetitions, [&] {
+        VertexPool pool;
+        pool.Reserve(count, count * bearingsPerVertex);
+        for (size_t i = 0; i < count; ++i) {
+            NodeVector node = makeNode(i);
+            VertexId id = pool.Create(node, bearingsPerVertex);
+            for (size_t b = 0; b < bearingsPerVertex; ++b)
+                pool.PostBearingVector(id, makeBearing(node, b));
+        }
+        bench::DoNotOptimize(pool);
+    }), count);
+
+    // 바이너리 블록 준비
+    std::vector<uint8_t> buffer;
+    {
+        VertexPool pool;
+        std::vector<std::unique_ptr<Vertex>> vertices;
+        std::vector<const Vertex*> pointers;
+        for (size_t i = 0; i < count; ++i) {
+            auto vertex = std::make_unique<Vertex>();
+            NodeVector node = makeNode(i);
+            vertex->UpdateNodeVector(node);
+            for (size_t b = 0; b < bearingsPerVertex; ++b)
+                vertex->PostBearingVector(makeBearing(node, b));
+            pointers.push_back(vertex.get());
+            vertices.push_back(std::move(vertex));
+        }
+        BinaryCodec::Encode(pointers, buffer);
+    }
+
+    bench::Report("VertexPool::Load (binary block)", bench::BestOf(repetitions, [&] {
+        VertexPool pool;
+        pool.Load(BinaryView(buffer.data(), buffer.size()));
+        bench::DoNotOptimize(pool);
+    }), count);
+    return 0;
+}
@@ -25,6 +25,7 @@ using json = nlohmann::json;
 
 #include "Vector3.h"
 #include "NodeVector.h"
+#include "NodeTable.h"
 
 /**
  * @brief Bearing Vector
@@ -95,4 +96,49 @@ struct BearingVector
     }
 };
 
+/**
+ * @brief Bearing Vector in normalized storage
+ *
+ * Same data as BearingVector, but the parent node is a handle into a NodeTable instead of an
+ * embedded copy (28 bytes instead of 40).
+ *
+ * @param Node Handle of the parent node in the owning NodeTable
+ * @param Force Bearing Vector Force in Cartesian coordinates (x, y, z)
+ * @param Vector Bearing Vector location; (x, y, z), (d_i, theta_i, phi_i)
+ */
+struct BearingVectorRef
+{
+    NodeHandle Node;
+    Vector3 Force;
+    Vector3 Vector;
+
+    BearingVectorRef(NodeHandle node, const Vector3& force, const Vector3& vec)
+        : Node(node), Force(force), Vector(vec) {}
+
+    /**
+     * @brief Normalizes a BearingVector, interning its node into nodes
+     */
+    static BearingVectorRef FromBearing(const BearingVector& bearing, NodeTable& nodes) {
+        return BearingVectorRef(nodes.Intern(bearing.Node), bearing.Force, bearing.Vector);
+    }
+
+    /**
+     * @brief Expands back to an embedded BearingVector
+     */
+    BearingVector Resolve(const NodeTable& nodes) const {
+        return BearingVector(nodes.Get(Node), Force, Vector);
+    }
+
+    /**
+     * @brief Serializes in the BearingVector::toJson shape, so both storages round-trip the same JSON
+     */
+    json toJson(const NodeTable& nodes) const {
+        return Resolve(nodes).toJson();
+    }
+
+    static BearingVectorRef fromJson(const json& j, NodeTable& nodes) {
+        return FromBearing(BearingVector::fromJson(j), nodes);
+    }
+};
+
 #endif // BEARINGVECTOR_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+/**
+ * EditEpoch.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ *
+ * Purpose: Process-wide counter of geometry edits
+ *
+ * Every change that can make a LinearSegment stale (a Vertex or NodeTable edit, a segment
+ * setter, a rebind) advances the epoch. A holder of derived data that recorded the epoch can
+ * tell "nothing anywhere changed" in O(1) and skip scanning its segments one by one; a changed
+ * epoch only says that something may have changed.
+ */
+
+#ifndef EDITEPOCH_H
+#define EDITEPOCH_H
+
+#include <atomic>
+#include <cstdint>
+
+class EditEpoch
+{
+public:
+    static uint64_t Current() { return _counter.load(std::memory_order_acquire); }
+    // Returns the new epoch, usable as a stamp ordered against every earlier edit
+    static uint64_t Advance() { return _counter.fetch_add(1, std::memory_order_acq_rel) + 1; }
+
+private:
+    inline static std::atomic<uint64_t> _counter{0};
+};
+
+#endif // EDITEPOCH_H
@@ -0,0 +1,78 @@
+/**
+ * NodeTable.cpp
+ * Linked File: NodeTable.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ */
+
+#include "NodeTable.h"
+#include "EditEpoch.h"
+
+#include <stdexcept>
+
+NodeHandle NodeTable::Intern(const NodeVector& node)
+{
+    auto it = _byIndex.find(node.Index);
+    if (it != _byIndex.end())
+        return it->second;
+
+    if (_nodes.size() >= kInvalidNodeHandle)
+        throw std::length_error("NodeTable: too many nodes");
+    NodeHandle handle = static_cast<NodeHandle>(_nodes.size());
+    _nodes.push_back(node);
+    _byIndex.emplace(node.Index, handle);
+    _revisions.push_back(EditEpoch::Advance()); // Newer than any stale stamp for a reused handle
+    return handle;
+}
+
+NodeHandle NodeTable::Find(int index) const
+{
+    auto it = _byIndex.find(index);
+    return it == _byIndex.end() ? kInvalidNodeHandle : it->second;
+}
+
+bool NodeTable::Update(NodeHandle handle, const NodeVector& node)
+{
+    if (handle >= _nodes.size())
+        throw std::out_of_range("NodeTable: invalid handle");
+
+    NodeVector& current = _nodes[handle];
+    if (current.Index == node.Index && current.Vector == node.Vector)
+        return false;
+    if (current.Index != node.Index)
+    {
+        NodeHandle owner = Find(node.Index);
+        if (owner != kInvalidNodeHandle && owner != handle)
+            throw std::invalid_argument("NodeTable: node index already belongs to another handle");
+        _byIndex.erase(current.Index);
+        _byIndex.emplace(node.Index, handle);
+    }
+    current = node;
+    _revisions[handle] = EditEpoch::Advance();
+    return true;
+}
+
+void NodeTable::Clear()
+{
+    _nodes.clear();
+    _byIndex.clear();
+    _revisions.clear();
+    _clearRevision = EditEpoch::Advance();
+}
+
+json NodeTable::toJson() const
+{
+    json array = json::array();
+    for (const NodeVector& node : _nodes)
+        array.push_back(node.toJson());
+    return array;
+}
+
+NodeTable NodeTable::fromJson(const json& j)
+{
+    NodeTable table;
+    for (const auto& node : j)
+        table.Intern(NodeVector::fromJson(node));
+    return table;
+}
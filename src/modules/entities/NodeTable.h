@@ -0,0 +1,77 @@
+/**
+ * NodeTable.h
+ * Linked File: NodeTable.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ *
+ * Purpose: Shared NodeVector storage addressed by handle
+ *
+ * Bearings in normalized storage (BearingVectorRef) hold a NodeHandle into this table instead
+ * of a NodeVector copy, so each node is stored once and an edit is seen by every bearing.
+ * Nodes are keyed by NodeVector::Index, the node's unique identifier.
+ */
+
+#ifndef NODETABLE_H
+#define NODETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Json
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+#include "NodeVector.h"
+
+using NodeHandle = uint32_t;
+constexpr NodeHandle kInvalidNodeHandle = UINT32_MAX;
+
+class NodeTable {
+public:
+    NodeTable() = default;
+
+    /**
+     * @brief Handle of the node with node.Index, adding node if the index is new
+     * @note An existing entry is not overwritten; use Update to move a node
+     */
+    NodeHandle Intern(const NodeVector& node);
+
+    // Handle of the node with this Index, or kInvalidNodeHandle
+    NodeHandle Find(int index) const;
+
+    /**
+     * @brief Replace a node; throws std::invalid_argument if node.Index belongs to another handle
+     * @return false (and no revision bump) when node equals the stored one
+     */
+    bool Update(NodeHandle handle, const NodeVector& node);
+
+    // References stay valid until the next Intern that adds a node
+    const NodeVector& Get(NodeHandle handle) const { return _nodes[handle]; }
+
+    /**
+     * @brief EditEpoch stamp of the last change to this handle's node
+     *
+     * Only an Update of this handle (or a Clear) moves it, so holders of a handle are not
+     * dirtied by edits to unrelated nodes. A handle Clear invalidated reports the Clear's stamp.
+     */
+    uint64_t Revision(NodeHandle handle) const { return handle < _revisions.size() ? _revisions[handle] : _clearRevision; }
+
+    std::size_t Size() const { return _nodes.size(); }
+    bool Empty() const { return _nodes.empty(); }
+    void Clear();
+
+    // JSON Serialization: array of NodeVector::toJson in handle order
+    json toJson() const;
+    static NodeTable fromJson(const json& j);
+
+private:
+    std::vector<NodeVector> _nodes;
+    std::unordered_map<int, NodeHandle> _byIndex;
+    std::vector<uint64_t> _revisions; // Per handle
+    uint64_t _clearRevision = 0;
+};
+
+#endif // NODETABLE_H
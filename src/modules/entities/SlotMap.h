@@ -0,0 +1,204 @@
+/**
+ * SlotMap.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ *
+ * Purpose: Dense storage addressed by generational handles
+ *
+ * Values live contiguously in insertion order (minus erasures), so iteration is a plain array
+ * walk. A handle names a slot plus the generation the slot had when the value was inserted;
+ * erasing bumps the generation, so stale handles are detected instead of reaching whatever
+ * value reuses the slot. Erase moves the last value into the hole (O(1)) and Reorder permutes
+ * the values, e.g. for locality; handles stay valid across both, addresses do not.
+ */
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Handle into a SlotMap<T>; the type parameter keeps handles of different maps apart
+ */
+template <typename T>
+struct SlotHandle
+{
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    uint32_t Index = kInvalidIndex; // Slot; stable for the life of the value
+    uint32_t Generation = 0;
+
+    bool IsNull() const { return Index == kInvalidIndex; }
+    bool operator==(const SlotHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+template <typename T>
+class SlotMap
+{
+public:
+    using Handle = SlotHandle<T>;
+
+    SlotMap() = default;
+
+    void Reserve(std::size_t count)
+    {
+        _values.reserve(count);
+        _owners.reserve(count);
+        _slots.reserve(count);
+    }
+
+    Handle Insert(T value)
+    {
+        if (_values.size() >= Handle::kInvalidIndex)
+            throw std::length_error("SlotMap: too many values");
+
+        uint32_t slot;
+        if (_freeHead != Handle::kInvalidIndex)
+        {
+            slot = _freeHead;
+            _freeHead = _slots[slot].Dense;
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(_slots.size());
+            _slots.push_back(Slot{0, 0});
+        }
+        _slots[slot].Dense = static_cast<uint32_t>(_values.size());
+        _values.push_back(std::move(value));
+        _owners.push_back(slot);
+        return Handle{slot, _slots[slot].Generation};
+    }
+
+    /**
+     * @brief Remove the value; false for a stale or null handle
+     * @param moved Receives the handle of the value moved into the hole (null if none moved)
+     */
+    bool Erase(Handle handle, Handle* moved = nullptr)
+    {
+        if (moved)
+            *moved = Handle();
+        if (!Contains(handle))
+            return false;
+
+        uint32_t dense = _slots[handle.Index].Dense;
+        uint32_t last = static_cast<uint32_t>(_values.size() - 1);
+        if (dense != last)
+        {
+            _values[dense] = std::move(_values[last]);
+            _owners[dense] = _owners[last];
+            _slots[_owners[dense]].Dense = dense;
+            if (moved)
+                *moved = Handle{_owners[dense], _slots[_owners[dense]].Generation};
+        }
+        _values.pop_back();
+        _owners.pop_back();
+
+        // Retire the slot: new generation, onto the free list
+        Slot& slot = _slots[handle.Index];
+        ++slot.Generation;
+        slot.Dense = _freeHead;
+        _freeHead = handle.Index;
+        return true;
+    }
+
+    bool Contains(Handle handle) const
+    {
+        // Retiring a slot bumps its generation, so a matching generation means the slot is live
+        return handle.Index < _slots.size() && _slots[handle.Index].Generation == handle.Generation;
+    }
+
+    // nullptr for a stale handle; the pointer lasts until the next Insert, Erase or Reorder
+    T* Find(Handle handle) { return Contains(handle) ? &_values[_slots[handle.Index].Dense] : nullptr; }
+    const T* Find(Handle handle) const { return Contains(handle) ? &_values[_slots[handle.Index].Dense] : nullptr; }
+
+    // Throws std::out_of_range for a stale handle
+    T& Get(Handle handle)
+    {
+        if (!Contains(handle))
+            throw std::out_of_range("SlotMap: stale handle");
+        return _values[_slots[handle.Index].Dense];
+    }
+    const T& Get(Handle handle) const { return const_cast<SlotMap*>(this)->Get(handle); }
+
+    // Value at a dense position, 0 .. Size() - 1 (unchecked)
+    T& operator[](std::size_t dense) { return _values[dense]; }
+    const T& operator[](std::size_t dense) const { return _values[dense]; }
+
+    // Dense position of a live handle, and the handle at a dense position
+    std::size_t DenseIndex(Handle handle) const { return _slots[handle.Index].Dense; }
+    Handle HandleAt(std::size_t dense) const { return Handle{_owners[dense], _slots[_owners[dense]].Generation}; }
+
+    /**
+     * @brief Permute the values: new position i takes the value at old position order[i]
+     * @note order must be a permutation of 0 .. Size() - 1
+     */
+    void Reorder(const std::vector<uint32_t>& order)
+    {
+        if (order.size() != _values.size())
+            throw std::invalid_argument("SlotMap: order is not a permutation");
+        std::vector<T> values;
+        std::vector<uint32_t> owners;
+        values.reserve(_values.size());
+        owners.reserve(_owners.size());
+        for (uint32_t old : order)
+        {
+            values.push_back(std::move(_values[old]));
+            owners.push_back(_owners[old]);
+        }
+        _values = std::move(values);
+        _owners = std::move(owners);
+        for (uint32_t dense = 0; dense < _owners.size(); ++dense)
+            _slots[_owners[dense]].Dense = dense;
+    }
+
+    void ShrinkToFit()
+    {
+        _values.shrink_to_fit();
+        _owners.shrink_to_fit();
+    }
+
+    void Clear()
+    {
+        // Keep the slots so handles issued before stay stale rather than becoming valid again
+        for (uint32_t slot : _owners)
+        {
+            ++_slots[slot].Generation;
+            _slots[slot].Dense = _freeHead;
+            _freeHead = slot;
+        }
+        _values.clear();
+        _owners.clear();
+    }
+
+    std::size_t Size() const { return _values.size(); }
+    bool Empty() const { return _values.empty(); }
+    std::size_t SlotCount() const { return _slots.size(); }
+
+    // Dense values in storage order
+    T* Data() { return _values.data(); }
+    const T* Data() const { return _values.data(); }
+    typename std::vector<T>::iterator begin() { return _values.begin(); }
+    typename std::vector<T>::iterator end() { return _values.end(); }
+    typename std::vector<T>::const_iterator begin() const { return _values.begin(); }
+    typename std::vector<T>::const_iterator end() const { return _values.end(); }
+
+private:
+    struct Slot
+    {
+        uint32_t Dense;      // Position in _values, or the next free slot while retired
+        uint32_t Generation; // Bumped by every Erase
+    };
+
+    std::vector<T> _values;
+    std::vector<uint32_t> _owners; // Slot of each value, parallel to _values
+    std::vector<Slot> _slots;
+    uint32_t _freeHead = Handle::kInvalidIndex;
+};
+
+#endif // SLOTMAP_H
@@ -1,89 +1,170 @@
 /**
  * Vector3.h
- * Linked File: Vector3.cpp
  * Security: Confidential
  * Author: Minseok Doo
  * Created Date: Oct 24, 2024
- * Last Modified: Nov 18, 2024
+ * Last Modified: Oct 17, 2026
+ *
+ * Header-only 3D vector template. Vector3 (float) is the storage type used throughout the
+ * project; Vector3d (double) is available for math that needs the extra precision.
  */
 
 #ifndef VECTOR3_H
 #define VECTOR3_H
 
 #include <iostream>
+#include <cmath> // sqrt
 
 // Json
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
-class Vector3 {
+template <typename T>
+class Vector3T {
 public:
-    union {
-        float values[3]; // Internal storage as an array
-        struct {
-            float x, y, z; // Retain x, y, z members
-        };
-    };
+    T x, y, z;
+
+    // Default and parameterized constructor
+    constexpr Vector3T(T xVal = T(0), T yVal = T(0), T zVal = T(0))
+        : x(xVal), y(yVal), z(zVal) {}
+
+    // Conversion between precisions (e.g. Vector3 <-> Vector3d)
+    template <typename U>
+    constexpr explicit Vector3T(const Vector3T<U>& v)
+        : x(static_cast<T>(v.x)), y(static_cast<T>(v.y)), z(static_cast<T>(v.z)) {}
 
     // JSON Serialization
-    json toJson() const;
-    static Vector3 fromJson(const json& j);
+    json toJson() const {
+        return json{{"x", x}, {"y", y}, {"z", z}};
+    }
 
-    // Default and parameterized constructor
-    Vector3(float xVal = 0.0f, float yVal = 0.0f, float zVal = 0.0f);
+    static Vector3T fromJson(const json& j) {
+        return Vector3T(j.at("x").get<T>(), j.at("y").get<T>(), j.at("z").get<T>());
+    }
 
     // Overloaded output operator
-    friend std::ostream& operator<<(std::ostream& os, const Vector3& vec);
+    friend std::ostream& operator<<(std::ostream& os, const Vector3T& vec) {
+        os << "(" << vec.x << ", " << vec.y << ", " << vec.z << ")";
+        return os;
+    }
 
     // Vector addition
-    Vector3 operator+(const Vector3& v) const;
-    Vector3& operator+=(const Vector3& v);
+    constexpr Vector3T operator+(const Vector3T& v) const {
+        return Vector3T(x + v.x, y + v.y, z + v.z);
+    }
+
+    constexpr Vector3T& operator+=(const Vector3T& v) {
+        x += v.x; y += v.y; z += v.z;
+        return *this;
+    }
 
     // Vector subtraction
-    Vector3 operator-(const Vector3& v) const;
-    Vector3& operator-=(const Vector3& v);
+    constexpr Vector3T operator-(const Vector3T& v) const {
+        return Vector3T(x - v.x, y - v.y, z - v.z);
+    }
+
+    constexpr Vector3T& operator-=(const Vector3T& v) {
+        x -= v.x; y -= v.y; z -= v.z;
+        return *this;
+    }
 
-    // Scalar multiplication (Vector3 * float)
-    Vector3 operator*(float scalar) const;
-    Vector3& operator*=(float scalar);
+    // Scalar multiplication (Vector3 * scalar)
+    constexpr Vector3T operator*(T scalar) const {
+        return Vector3T(x * scalar, y * scalar, z * scalar);
+    }
+
+    constexpr Vector3T& operator*=(T scalar) {
+        x *= scalar; y *= scalar; z *= scalar;
+        return *this;
+    }
 
     // Hadamard product (Vector3 * Vector3)
-    Vector3 operator*(const Vector3& v) const;
+    constexpr Vector3T operator*(const Vector3T& v) const {
+        return Vector3T(x * v.x, y * v.y, z * v.z);
+    }
 
     // Scalar division
-    Vector3 operator/(float scalar) const;
-    Vector3& operator/=(float scalar);
-
-    // Equality operator
-    bool operator==(const Vector3& other) const;
+    constexpr Vector3T operator/(T scalar) const {
+        return Vector3T(x / scalar, y / scalar, z / scalar);
+    }
+
+    constexpr Vector3T& operator/=(T scalar) {
+        x /= scalar; y /= scalar; z /= scalar;
+        return *this;
+    }
+
+    // Equality operator (component-wise tolerance)
+    constexpr bool operator==(const Vector3T& other) const {
+        return Abs(x - other.x) < kEpsilon &&
+               Abs(y - other.y) < kEpsilon &&
+               Abs(z - other.z) < kEpsilon;
+    }
 
     // Inequality operator
-    bool operator!=(const Vector3& other) const;
+    constexpr bool operator!=(const Vector3T& other) const {
+        return !(*this == other);
+    }
 
     // Dot product
-    float dot(const Vector3& v) const;
+    constexpr T dot(const Vector3T& v) const {
+        return x * v.x + y * v.y + z * v.z;
+    }
 
     // Cross product
-    Vector3 cross(const Vector3& v) const;
+    constexpr Vector3T cross(const Vector3T& v) const {
+        return Vector3T(
+            y * v.z - z * v.y,
+            z * v.x - x * v.z,
+            x * v.y - y * v.x
+        );
+    }
 
     // Vector magnitude
-    float magnitude() const;
+    T magnitude() const {
+        return std::sqrt(x * x + y * y + z * z);
+    }
 
     // Normalize the vector
-    Vector3 normalized() const;
+    Vector3T normalized() const {
+        T mag = magnitude();
+        if (mag == T(0))
+            return Vector3T(T(0), T(0), T(0));
+        return *this / mag;
+    }
 
     // Check if the vector is zero
-    bool isZero() const;
+    constexpr bool isZero() const {
+        return Abs(x) < kEpsilon && Abs(y) < kEpsilon && Abs(z) < kEpsilon;
+    }
 
     // Distance between two vectors
-    float distance(const Vector3& v) const;
+    T distance(const Vector3T& v) const {
+        return (*this - v).magnitude();
+    }
 
-    // Friend function for scalar multiplication (float * Vector3)
-    friend Vector3 operator*(float scalar, const Vector3& v);
+    // Scalar multiplication (scalar * Vector3)
+    friend constexpr Vector3T operator*(T scalar, const Vector3T& v) {
+        return Vector3T(v.x * scalar, v.y * scalar, v.z * scalar);
+    }
 
     // Access individual elements via operator[]
-    float operator[](int index) const;
-    float& operator[](int index);
+    constexpr T operator[](int index) const {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
+
+    constexpr T& operator[](int index) {
+        return index == 0 ? x : (index == 1 ? y : z);
+    }
+
+private:
+    static constexpr T kEpsilon = T(1e-5);
+
+    static constexpr T Abs(T value) {
+        return value < T(0) ? -value : value;
+    }
 };
 
+using Vector3 = Vector3T<float>;
+using Vector3d = Vector3T<double>;
+
 #endif // VECTOR3_H
@@ -0,0 +1,477 @@
+/**
+ * Vector3Array.cpp
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ */
+
+#include "Vector3Array.h"
+#include "CpuFeatures.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#if defined(NBVS_SIMD_X86)
+#include <immintrin.h>
+#elif defined(NBVS_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+    void CheckSizes(const Vector3Array& a, const Vector3Array& b)
+    {
+        if (a.size() != b.size())
+            throw std::invalid_argument("Vector3Array: operand sizes differ");
+    }
+
+#if defined(NBVS_SIMD_X86)
+    // Each AVX2 kernel handles the largest multiple of 8 and returns the number of elements done
+
+    NBVS_TARGET_AVX2 std::size_t AddAvx2(const Vector3Array& a, const Vector3Array& b, Vector3Array& out, bool subtract)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 ax = _mm256_load_ps(a.x() + i), ay = _mm256_load_ps(a.y() + i), az = _mm256_load_ps(a.z() + i);
+            __m256 bx = _mm256_load_ps(b.x() + i), by = _mm256_load_ps(b.y() + i), bz = _mm256_load_ps(b.z() + i);
+            _mm256_store_ps(out.x() + i, subtract ? _mm256_sub_ps(ax, bx) : _mm256_add_ps(ax, bx));
+            _mm256_store_ps(out.y() + i, subtract ? _mm256_sub_ps(ay, by) : _mm256_add_ps(ay, by));
+            _mm256_store_ps(out.z() + i, subtract ? _mm256_sub_ps(az, bz) : _mm256_add_ps(az, bz));
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t ScaleAvx2(const Vector3Array& a, float scalar, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        const __m256 s = _mm256_set1_ps(scalar);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            _mm256_store_ps(out.x() + i, _mm256_mul_ps(_mm256_load_ps(a.x() + i), s));
+            _mm256_store_ps(out.y() + i, _mm256_mul_ps(_mm256_load_ps(a.y() + i), s));
+            _mm256_store_ps(out.z() + i, _mm256_mul_ps(_mm256_load_ps(a.z() + i), s));
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t CrossAvx2(const Vector3Array& a, const Vector3Array& b, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 ax = _mm256_load_ps(a.x() + i), ay = _mm256_load_ps(a.y() + i), az = _mm256_load_ps(a.z() + i);
+            __m256 bx = _mm256_load_ps(b.x() + i), by = _mm256_load_ps(b.y() + i), bz = _mm256_load_ps(b.z() + i);
+            _mm256_store_ps(out.x() + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+            _mm256_store_ps(out.y() + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+            _mm256_store_ps(out.z() + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t NormalizeAvx2(const Vector3Array& a, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        const __m256 zero = _mm256_setzero_ps();
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 ax = _mm256_load_ps(a.x() + i), ay = _mm256_load_ps(a.y() + i), az = _mm256_load_ps(a.z() + i);
+            __m256 len = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, ax), _mm256_mul_ps(ay, ay)), _mm256_mul_ps(az, az)));
+            // Zero-length vectors normalize to zero, as Vector3::normalized does
+            __m256 nonZero = _mm256_cmp_ps(len, zero, _CMP_NEQ_OQ);
+            _mm256_store_ps(out.x() + i, _mm256_and_ps(_mm256_div_ps(ax, len), nonZero));
+            _mm256_store_ps(out.y() + i, _mm256_and_ps(_mm256_div_ps(ay, len), nonZero));
+            _mm256_store_ps(out.z() + i, _mm256_and_ps(_mm256_div_ps(az, len), nonZero));
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t DotAvx2(const Vector3Array& a, const Vector3Array& b, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 d = _mm256_mul_ps(_mm256_load_ps(a.x() + i), _mm256_load_ps(b.x() + i));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(a.y() + i), _mm256_load_ps(b.y() + i)));
+            d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_load_ps(a.z() + i), _mm256_load_ps(b.z() + i)));
+            _mm256_storeu_ps(out + i, d);
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t MagnitudeAvx2(const Vector3Array& a, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 ax = _mm256_load_ps(a.x() + i), ay = _mm256_load_ps(a.y() + i), az = _mm256_load_ps(a.z() + i);
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, ax), _mm256_mul_ps(ay, ay)), _mm256_mul_ps(az, az));
+            _mm256_storeu_ps(out + i, _mm256_sqrt_ps(d));
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 std::size_t DistanceAvx2(const Vector3Array& a, const Vector3Array& b, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            __m256 dx = _mm256_sub_ps(_mm256_load_ps(a.x() + i), _mm256_load_ps(b.x() + i));
+            __m256 dy = _mm256_sub_ps(_mm256_load_ps(a.y() + i), _mm256_load_ps(b.y() + i));
+            __m256 dz = _mm256_sub_ps(_mm256_load_ps(a.z() + i), _mm256_load_ps(b.z() + i));
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+            _mm256_storeu_ps(out + i, _mm256_sqrt_ps(d));
+        }
+        return n;
+    }
+#endif
+
+#if defined(NBVS_SIMD_NEON)
+    // Each NEON kernel handles the largest multiple of 4 and returns the number of elements done
+
+    std::size_t AddNeon(const Vector3Array& a, const Vector3Array& b, Vector3Array& out, bool subtract)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            float32x4_t ax = vld1q_f32(a.x() + i), ay = vld1q_f32(a.y() + i), az = vld1q_f32(a.z() + i);
+            float32x4_t bx = vld1q_f32(b.x() + i), by = vld1q_f32(b.y() + i), bz = vld1q_f32(b.z() + i);
+            vst1q_f32(out.x() + i, subtract ? vsubq_f32(ax, bx) : vaddq_f32(ax, bx));
+            vst1q_f32(out.y() + i, subtract ? vsubq_f32(ay, by) : vaddq_f32(ay, by));
+            vst1q_f32(out.z() + i, subtract ? vsubq_f32(az, bz) : vaddq_f32(az, bz));
+        }
+        return n;
+    }
+
+    std::size_t ScaleNeon(const Vector3Array& a, float scalar, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            vst1q_f32(out.x() + i, vmulq_n_f32(vld1q_f32(a.x() + i), scalar));
+            vst1q_f32(out.y() + i, vmulq_n_f32(vld1q_f32(a.y() + i), scalar));
+            vst1q_f32(out.z() + i, vmulq_n_f32(vld1q_f32(a.z() + i), scalar));
+        }
+        return n;
+    }
+
+    std::size_t CrossNeon(const Vector3Array& a, const Vector3Array& b, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            float32x4_t ax = vld1q_f32(a.x() + i), ay = vld1q_f32(a.y() + i), az = vld1q_f32(a.z() + i);
+            float32x4_t bx = vld1q_f32(b.x() + i), by = vld1q_f32(b.y() + i), bz = vld1q_f32(b.z() + i);
+            vst1q_f32(out.x() + i, vsubq_f32(vmulq_f32(ay, bz), vmulq_f32(az, by)));
+            vst1q_f32(out.y() + i, vsubq_f32(vmulq_f32(az, bx), vmulq_f32(ax, bz)));
+            vst1q_f32(out.z() + i, vsubq_f32(vmulq_f32(ax, by), vmulq_f32(ay, bx)));
+        }
+        return n;
+    }
+
+    float32x4_t LengthNeon(float32x4_t x, float32x4_t y, float32x4_t z)
+    {
+        return vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z)));
+    }
+
+    std::size_t NormalizeNeon(const Vector3Array& a, Vector3Array& out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            float32x4_t ax = vld1q_f32(a.x() + i), ay = vld1q_f32(a.y() + i), az = vld1q_f32(a.z() + i);
+            float32x4_t len = LengthNeon(ax, ay, az);
+            uint32x4_t isZero = vceqq_f32(len, zero);
+            vst1q_f32(out.x() + i, vbslq_f32(isZero, zero, vdivq_f32(ax, len)));
+            vst1q_f32(out.y() + i, vbslq_f32(isZero, zero, vdivq_f32(ay, len)));
+            vst1q_f32(out.z() + i, vbslq_f32(isZero, zero, vdivq_f32(az, len)));
+        }
+        return n;
+    }
+
+    std::size_t DotNeon(const Vector3Array& a, const Vector3Array& b, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            float32x4_t d = vmulq_f32(vld1q_f32(a.x() + i), vld1q_f32(b.x() + i));
+            d = vaddq_f32(d, vmulq_f32(vld1q_f32(a.y() + i), vld1q_f32(b.y() + i)));
+            d = vaddq_f32(d, vmulq_f32(vld1q_f32(a.z() + i), vld1q_f32(b.z() + i)));
+            vst1q_f32(out + i, d);
+        }
+        return n;
+    }
+
+    std::size_t MagnitudeNeon(const Vector3Array& a, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            vst1q_f32(out + i, LengthNeon(vld1q_f32(a.x() + i), vld1q_f32(a.y() + i), vld1q_f32(a.z() + i)));
+        }
+        return n;
+    }
+
+    std::size_t DistanceNeon(const Vector3Array& a, const Vector3Array& b, float* out)
+    {
+        const std::size_t n = a.size() & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            float32x4_t dx = vsubq_f32(vld1q_f32(a.x() + i), vld1q_f32(b.x() + i));
+            float32x4_t dy = vsubq_f32(vld1q_f32(a.y() + i), vld1q_f32(b.y() + i));
+            float32x4_t dz = vsubq_f32(vld1q_f32(a.z() + i), vld1q_f32(b.z() + i));
+            vst1q_f32(out + i, LengthNeon(dx, dy, dz));
+        }
+        return n;
+    }
+#endif
+}
+
+// Constructors
+Vector3Array::Vector3Array(std::size_t count)
+    : _x(count, 0.0f), _y(count, 0.0f), _z(count, 0.0f) {}
+
+Vector3Array::Vector3Array(const std::vector<Vector3>& vectors)
+{
+    assign(vectors);
+}
+
+// Container access
+void Vector3Array::resize(std::size_t count)
+{
+    _x.resize(count, 0.0f);
+    _y.resize(count, 0.0f);
+    _z.resize(count, 0.0f);
+}
+
+void Vector3Array::reserve(std::size_t count)
+{
+    _x.reserve(count);
+    _y.reserve(count);
+    _z.reserve(count);
+}
+
+void Vector3Array::clear()
+{
+    _x.clear();
+    _y.clear();
+    _z.clear();
+}
+
+void Vector3Array::push_back(const Vector3& v)
+{
+    _x.push_back(v.x);
+    _y.push_back(v.y);
+    _z.push_back(v.z);
+}
+
+void Vector3Array::set(std::size_t index, const Vector3& v)
+{
+    _x[index] = v.x;
+    _y[index] = v.y;
+    _z[index] = v.z;
+}
+
+// Conversion to and from AoS storage
+void Vector3Array::assign(const Vector3* vectors, std::size_t count)
+{
+    resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        _x[i] = vectors[i].x;
+        _y[i] = vectors[i].y;
+        _z[i] = vectors[i].z;
+    }
+}
+
+void Vector3Array::copyTo(Vector3* vectors) const
+{
+    for (std::size_t i = 0; i < size(); ++i)
+    {
+        vectors[i] = Vector3(_x[i], _y[i], _z[i]);
+    }
+}
+
+std::vector<Vector3> Vector3Array::toVector() const
+{
+    std::vector<Vector3> vectors(size());
+    copyTo(vectors.data());
+    return vectors;
+}
+
+// Batch kernels
+void Vector3Array::add(const Vector3Array& a, const Vector3Array& b, Vector3Array& out)
+{
+    CheckSizes(a, b);
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = AddAvx2(a, b, out, false); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = AddNeon(a, b, out, false); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out._x[i] = a._x[i] + b._x[i];
+        out._y[i] = a._y[i] + b._y[i];
+        out._z[i] = a._z[i] + b._z[i];
+    }
+}
+
+void Vector3Array::subtract(const Vector3Array& a, const Vector3Array& b, Vector3Array& out)
+{
+    CheckSizes(a, b);
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = AddAvx2(a, b, out, true); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = AddNeon(a, b, out, true); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out._x[i] = a._x[i] - b._x[i];
+        out._y[i] = a._y[i] - b._y[i];
+        out._z[i] = a._z[i] - b._z[i];
+    }
+}
+
+void Vector3Array::scale(const Vector3Array& a, float scalar, Vector3Array& out)
+{
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = ScaleAvx2(a, scalar, out); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = ScaleNeon(a, scalar, out); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out._x[i] = a._x[i] * scalar;
+        out._y[i] = a._y[i] * scalar;
+        out._z[i] = a._z[i] * scalar;
+    }
+}
+
+void Vector3Array::cross(const Vector3Array& a, const Vector3Array& b, Vector3Array& out)
+{
+    CheckSizes(a, b);
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = CrossAvx2(a, b, out); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = CrossNeon(a, b, out); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        Vector3 c = a.get(i).cross(b.get(i));
+        out.set(i, c);
+    }
+}
+
+void Vector3Array::normalize(const Vector3Array& a, Vector3Array& out)
+{
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = NormalizeAvx2(a, out); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = NormalizeNeon(a, out); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out.set(i, a.get(i).normalized());
+    }
+}
+
+void Vector3Array::dot(const Vector3Array& a, const Vector3Array& b, std::vector<float>& out)
+{
+    CheckSizes(a, b);
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = DotAvx2(a, b, out.data()); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = DotNeon(a, b, out.data()); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out[i] = a._x[i] * b._x[i] + a._y[i] * b._y[i] + a._z[i] * b._z[i];
+    }
+}
+
+void Vector3Array::magnitude(const Vector3Array& a, std::vector<float>& out)
+{
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = MagnitudeAvx2(a, out.data()); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = MagnitudeNeon(a, out.data()); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        out[i] = std::sqrt(a._x[i] * a._x[i] + a._y[i] * a._y[i] + a._z[i] * a._z[i]);
+    }
+}
+
+void Vector3Array::distance(const Vector3Array& a, const Vector3Array& b, std::vector<float>& out)
+{
+    CheckSizes(a, b);
+    out.resize(a.size());
+    std::size_t i = 0;
+    switch (CpuFeatures::Active())
+    {
+#if defined(NBVS_SIMD_X86)
+    case SimdLevel::AVX2: i = DistanceAvx2(a, b, out.data()); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+    case SimdLevel::NEON: i = DistanceNeon(a, b, out.data()); break;
+#endif
+    default: break;
+    }
+    for (; i < a.size(); ++i)
+    {
+        float dx = a._x[i] - b._x[i];
+        float dy = a._y[i] - b._y[i];
+        float dz = a._z[i] - b._z[i];
+        out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
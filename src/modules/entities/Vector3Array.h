@@ -0,0 +1,109 @@
+/**
+ * Vector3Array.h
+ * Linked File: Vector3Array.cpp
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Created Date: Oct 17, 2026
+ *
+ * Purpose: Structure-of-arrays storage for bulk Vector3 work
+ *
+ * x, y and z live in separate 32-byte aligned lanes so the batch kernels can load eight
+ * components per instruction. Kernels dispatch at runtime to AVX2, NEON or scalar code
+ * (see CpuFeatures.h).
+ */
+
+#ifndef VECTOR3ARRAY_H
+#define VECTOR3ARRAY_H
+
+#include <vector>
+#include <cstddef>
+#include <new>
+#include <limits>
+
+#include "Vector3.h"
+
+/**
+ * @brief Minimal aligned allocator for SIMD lanes
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator
+{
+    using value_type = T;
+
+    template <typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_alloc();
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+class Vector3Array {
+public:
+    static constexpr std::size_t kAlignment = 32;
+    using Lane = std::vector<float, AlignedAllocator<float, kAlignment>>;
+
+    Vector3Array() = default;
+    explicit Vector3Array(std::size_t count);
+    Vector3Array(const std::vector<Vector3>& vectors);
+
+    // Container access
+    std::size_t size() const { return _x.size(); }
+    bool empty() const { return _x.empty(); }
+    void resize(std::size_t count);
+    void reserve(std::size_t count);
+    void clear();
+    void push_back(const Vector3& v);
+
+    Vector3 get(std::size_t index) const { return Vector3(_x[index], _y[index], _z[index]); }
+    void set(std::size_t index, const Vector3& v);
+    Vector3 operator[](std::size_t index) const { return get(index); }
+
+    // Raw lanes
+    float* x() { return _x.data(); }
+    float* y() { return _y.data(); }
+    float* z() { return _z.data(); }
+    const float* x() const { return _x.data(); }
+    const float* y() const { return _y.data(); }
+    const float* z() const { return _z.data(); }
+
+    // Conversion to and from AoS storage
+    void assign(const Vector3* vectors, std::size_t count);
+    void assign(const std::vector<Vector3>& vectors) { assign(vectors.data(), vectors.size()); }
+    void copyTo(Vector3* vectors) const;
+    std::vector<Vector3> toVector() const;
+
+    // Batch kernels; operands must have equal sizes, out is resized to match
+    static void add(const Vector3Array& a, const Vector3Array& b, Vector3Array& out);
+    static void subtract(const Vector3Array& a, const Vector3Array& b, Vector3Array& out);
+    static void scale(const Vector3Array& a, float scalar, Vector3Array& out);
+    static void cross(const Vector3Array& a, const Vector3Array& b, Vector3Array& out);
+    static void normalize(const Vector3Array& a, Vector3Array& out);
+    static void dot(const Vector3Array& a, const Vector3Array& b, std::vector<float>& out);
+    static void magnitude(const Vector3Array& a, std::vector<float>& out);
+    static void distance(const Vector3Array& a, const Vector3Array& b, std::vector<float>& out);
+
+private:
+    Lane _x;
+    Lane _y;
+    Lane _z;
+};
+
+#endif // VECTOR3ARRAY_H
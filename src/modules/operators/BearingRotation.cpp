@@ -0,0 +1,268 @@
+/**
+ * BearingRotation.cpp
+ * Linked file: BearingRotation.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ */
+
+#include "BearingRotation.h"
+#include "CpuFeatures.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#if defined(NBVS_SIMD_X86)
+#include <immintrin.h>
+#elif defined(NBVS_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace
+{
+    // Directions shorter than this are treated as zero
+    constexpr float kDirectionEpsilon = 1e-12f;
+
+    // R_z(theta) R_y(phi) expanded (Equ. 7)
+    RotationMatrix Compose(float cosTheta, float sinTheta, float cosPhi, float sinPhi)
+    {
+        return RotationMatrix{{cosTheta * cosPhi, -sinTheta, cosTheta * sinPhi,
+                               sinTheta * cosPhi, cosTheta, sinTheta * sinPhi,
+                               -sinPhi, 0.0f, cosPhi}};
+    }
+
+    // Lane pointers of one matrix (or its transpose) and the vectors it rotates.
+    // localStep is 1 for per-bearing inputs and 0 to broadcast a single vector.
+    struct ApplyArgs
+    {
+        const float* m[9];
+        const float* lx;
+        const float* ly;
+        const float* lz;
+        std::size_t localStep;
+        float* ox;
+        float* oy;
+        float* oz;
+        std::size_t count;
+    };
+
+#if defined(NBVS_SIMD_X86)
+    // Handles the largest multiple of 8 and returns the number of elements done
+    NBVS_TARGET_AVX2 std::size_t ApplyAvx2(const ApplyArgs& a)
+    {
+        const std::size_t n = a.count & ~std::size_t(7);
+        for (std::size_t i = 0; i < n; i += 8)
+        {
+            const std::size_t li = i * a.localStep;
+            __m256 x = a.localStep ? _mm256_loadu_ps(a.lx + li) : _mm256_broadcast_ss(a.lx);
+            __m256 y = a.localStep ? _mm256_loadu_ps(a.ly + li) : _mm256_broadcast_ss(a.ly);
+            __m256 z = a.localStep ? _mm256_loadu_ps(a.lz + li) : _mm256_broadcast_ss(a.lz);
+            __m256 rx = _mm256_mul_ps(_mm256_load_ps(a.m[0] + i), x);
+            __m256 ry = _mm256_mul_ps(_mm256_load_ps(a.m[3] + i), x);
+            __m256 rz = _mm256_mul_ps(_mm256_load_ps(a.m[6] + i), x);
+            rx = _mm256_fmadd_ps(_mm256_load_ps(a.m[1] + i), y, rx);
+            ry = _mm256_fmadd_ps(_mm256_load_ps(a.m[4] + i), y, ry);
+            rz = _mm256_fmadd_ps(_mm256_load_ps(a.m[7] + i), y, rz);
+            rx = _mm256_fmadd_ps(_mm256_load_ps(a.m[2] + i), z, rx);
+            ry = _mm256_fmadd_ps(_mm256_load_ps(a.m[5] + i), z, ry);
+            rz = _mm256_fmadd_ps(_mm256_load_ps(a.m[8] + i), z, rz);
+            _mm256_storeu_ps(a.ox + i, rx);
+            _mm256_storeu_ps(a.oy + i, ry);
+            _mm256_storeu_ps(a.oz + i, rz);
+        }
+        return n;
+    }
+#endif
+
+#if defined(NBVS_SIMD_NEON)
+    // Handles the largest multiple of 4 and returns the number of elements done
+    std::size_t ApplyNeon(const ApplyArgs& a)
+    {
+        const std::size_t n = a.count & ~std::size_t(3);
+        for (std::size_t i = 0; i < n; i += 4)
+        {
+            const std::size_t li = i * a.localStep;
+            float32x4_t x = a.localStep ? vld1q_f32(a.lx + li) : vdupq_n_f32(*a.lx);
+            float32x4_t y = a.localStep ? vld1q_f32(a.ly + li) : vdupq_n_f32(*a.ly);
+            float32x4_t z = a.localStep ? vld1q_f32(a.lz + li) : vdupq_n_f32(*a.lz);
+            float32x4_t rx = vmulq_f32(vld1q_f32(a.m[0] + i), x);
+            float32x4_t ry = vmulq_f32(vld1q_f32(a.m[3] + i), x);
+            float32x4_t rz = vmulq_f32(vld1q_f32(a.m[6] + i), x);
+            rx = vfmaq_f32(rx, vld1q_f32(a.m[1] + i), y);
+            ry = vfmaq_f32(ry, vld1q_f32(a.m[4] + i), y);
+            rz = vfmaq_f32(rz, vld1q_f32(a.m[7] + i), y);
+            rx = vfmaq_f32(rx, vld1q_f32(a.m[2] + i), z);
+            ry = vfmaq_f32(ry, vld1q_f32(a.m[5] + i), z);
+            rz = vfmaq_f32(rz, vld1q_f32(a.m[8] + i), z);
+            vst1q_f32(a.ox + i, rx);
+            vst1q_f32(a.oy + i, ry);
+            vst1q_f32(a.oz + i, rz);
+        }
+        return n;
+    }
+#endif
+
+    void ApplyDispatch(const ApplyArgs& a)
+    {
+        std::size_t i = 0;
+        switch (CpuFeatures::Active())
+        {
+#if defined(NBVS_SIMD_X86)
+        case SimdLevel::AVX2: i = ApplyAvx2(a); break;
+#endif
+#if defined(NBVS_SIMD_NEON)
+        case SimdLevel::NEON: i = ApplyNeon(a); break;
+#endif
+        default: break;
+        }
+        for (; i < a.count; ++i)
+        {
+            const std::size_t li = i * a.localStep;
+            const float x = a.lx[li], y = a.ly[li], z = a.lz[li];
+            a.ox[i] = a.m[0][i] * x + a.m[1][i] * y + a.m[2][i] * z;
+            a.oy[i] = a.m[3][i] * x + a.m[4][i] * y + a.m[5][i] * z;
+            a.oz[i] = a.m[6][i] * x + a.m[7][i] * y + a.m[8][i] * z;
+        }
+    }
+}
+
+// ----------------------------
+// RotationMatrix
+// ----------------------------
+
+RotationMatrix RotationMatrix::Identity()
+{
+    return RotationMatrix{{1.0f, 0.0f, 0.0f,
+                           0.0f, 1.0f, 0.0f,
+                           0.0f, 0.0f, 1.0f}};
+}
+
+RotationMatrix RotationMatrix::FromAngles(float theta, float phi)
+{
+    return Compose(std::cos(theta), std::sin(theta), std::cos(phi), std::sin(phi));
+}
+
+RotationMatrix RotationMatrix::FromDirection(const Vector3& direction)
+{
+    const float length = direction.magnitude();
+    if (length < kDirectionEpsilon)
+        return Identity();
+
+    const Vector3 b = direction / length;
+    const float sinPhi = std::sqrt(b.x * b.x + b.y * b.y);
+    if (sinPhi < kDirectionEpsilon)
+    {
+        // On the z axis theta is undefined; pick theta = 0
+        return Compose(1.0f, 0.0f, b.z < 0.0f ? -1.0f : 1.0f, 0.0f);
+    }
+    return Compose(b.x / sinPhi, b.y / sinPhi, b.z, sinPhi);
+}
+
+Vector3 RotationMatrix::Apply(const Vector3& v) const
+{
+    return Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z,
+                   m[3] * v.x + m[4] * v.y + m[5] * v.z,
+                   m[6] * v.x + m[7] * v.y + m[8] * v.z);
+}
+
+Vector3 RotationMatrix::ApplyInverse(const Vector3& v) const
+{
+    return Vector3(m[0] * v.x + m[3] * v.y + m[6] * v.z,
+                   m[1] * v.x + m[4] * v.y + m[7] * v.z,
+                   m[2] * v.x + m[5] * v.y + m[8] * v.z);
+}
+
+// ----------------------------
+// BearingRotationSet
+// ----------------------------
+
+BearingRotationSet::BearingRotationSet(const std::vector<BearingVector>& bearings)
+{
+    Build(bearings);
+}
+
+void BearingRotationSet::Build(const std::vector<BearingVector>& bearings)
+{
+    for (auto& lane : _m)
+        lane.resize(bearings.size());
+    for (std::size_t i = 0; i < bearings.size(); ++i)
+        Store(i, RotationMatrix::FromDirection(bearings[i].Vector));
+}
+
+void BearingRotationSet::PushBack(const Vector3& direction)
+{
+    for (auto& lane : _m)
+        lane.push_back(0.0f);
+    Store(Size() - 1, RotationMatrix::FromDirection(direction));
+}
+
+void BearingRotationSet::Set(std::size_t index, const Vector3& direction)
+{
+    Store(index, RotationMatrix::FromDirection(direction));
+}
+
+void BearingRotationSet::PopBack()
+{
+    if (Empty())
+        return;
+    for (auto& lane : _m)
+        lane.pop_back();
+}
+
+void BearingRotationSet::Clear()
+{
+    for (auto& lane : _m)
+        lane.clear();
+}
+
+RotationMatrix BearingRotationSet::Get(std::size_t index) const
+{
+    RotationMatrix r;
+    for (int k = 0; k < 9; ++k)
+        r.m[k] = _m[k][index];
+    return r;
+}
+
+void BearingRotationSet::Store(std::size_t index, const RotationMatrix& r)
+{
+    for (int k = 0; k < 9; ++k)
+        _m[k][index] = r.m[k];
+}
+
+void BearingRotationSet::Apply(const Vector3Array& local, Vector3Array& out) const
+{
+    if (local.size() != Size())
+        throw std::invalid_argument("BearingRotationSet: input size differs from rotation count");
+    out.resize(Size());
+    ApplyArgs args{{_m[0].data(), _m[1].data(), _m[2].data(),
+                    _m[3].data(), _m[4].data(), _m[5].data(),
+                    _m[6].data(), _m[7].data(), _m[8].data()},
+                   local.x(), local.y(), local.z(), 1,
+                   out.x(), out.y(), out.z(), Size()};
+    ApplyDispatch(args);
+}
+
+void BearingRotationSet::Apply(const Vector3& local, Vector3Array& out) const
+{
+    out.resize(Size());
+    ApplyArgs args{{_m[0].data(), _m[1].data(), _m[2].data(),
+                    _m[3].data(), _m[4].data(), _m[5].data(),
+                    _m[6].data(), _m[7].data(), _m[8].data()},
+                   &local.x, &local.y, &local.z, 0,
+                   out.x(), out.y(), out.z(), Size()};
+    ApplyDispatch(args);
+}
+
+void BearingRotationSet::ApplyInverse(const Vector3Array& world, Vector3Array& out) const
+{
+    if (world.size() != Size())
+        throw std::invalid_argument("BearingRotationSet: input size differs from rotation count");
+    out.resize(Size());
+    // Transposed lane order
+    ApplyArgs args{{_m[0].data(), _m[3].data(), _m[6].data(),
+                    _m[1].data(), _m[4].data(), _m[7].data(),
+                    _m[2].data(), _m[5].data(), _m[8].data()},
+                   world.x(), world.y(), world.z(), 1,
+                   out.x(), out.y(), out.z(), Size()};
+    ApplyDispatch(args);
+}
@@ -0,0 +1,99 @@
+/**
+ * BearingRotation.h
+ * Linked file: BearingRotation.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Cached bearing rotations R_i and batched application
+ *
+ * R_i maps the local frame of bearing i to world space; its third column is the bearing
+ * direction B_i (Equ. 1). Built from the Cartesian bearing direction, so no trig is needed:
+ * cos(phi) = B_z, sin(phi) = sqrt(B_x^2 + B_y^2), cos(theta) = B_x / sin(phi), sin(theta) = B_y / sin(phi).
+ *
+ * Equations:
+ * Equ(4): R_i = R_z(theta_i) R_y(phi_i)
+ * Equ(5): R_z(theta_i) = [cos(theta_i) -sin(theta_i) 0; sin(theta_i) cos(theta_i) 0; 0 0 1]
+ * Equ(6): R_y(phi_i) = [cos(phi_i) 0 sin(phi_i); 0 1 0; -sin(phi_i) 0 cos(phi_i)]
+ * Equ(7): R_i = [cos(theta)cos(phi) -sin(theta) cos(theta)sin(phi);
+ *                sin(theta)cos(phi)  cos(theta) sin(theta)sin(phi);
+ *                -sin(phi)           0          cos(phi)]
+ */
+
+#ifndef BEARINGROTATION_H
+#define BEARINGROTATION_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Vector3.h"
+#include "Vector3Array.h"
+#include "BearingVector.h"
+
+/**
+ * @brief Row-major 3x3 rotation matrix
+ */
+struct RotationMatrix
+{
+    float m[9];
+
+    static RotationMatrix Identity();
+
+    // Equ. 4-7 from spherical angles (two sincos)
+    static RotationMatrix FromAngles(float theta, float phi);
+
+    // Equ. 7 from a Cartesian direction (no trig); a zero direction gives the identity
+    static RotationMatrix FromDirection(const Vector3& direction);
+
+    // R * v
+    Vector3 Apply(const Vector3& v) const;
+
+    // R^T * v (inverse rotation)
+    Vector3 ApplyInverse(const Vector3& v) const;
+
+    float operator()(int row, int column) const { return m[row * 3 + column]; }
+};
+
+/**
+ * @brief Structure-of-arrays set of bearing rotations
+ *
+ * Each of the nine matrix entries lives in its own aligned lane so Apply can rotate eight
+ * (AVX2) or four (NEON) bearings per instruction.
+ */
+class BearingRotationSet
+{
+public:
+    BearingRotationSet() = default;
+    explicit BearingRotationSet(const std::vector<BearingVector>& bearings);
+
+    // Rebuild from a bearing list
+    void Build(const std::vector<BearingVector>& bearings);
+
+    // Incremental maintenance, mirroring Vertex's bearing edits
+    void PushBack(const BearingVector& bearing) { PushBack(bearing.Vector); }
+    void PushBack(const Vector3& direction);
+    void Set(std::size_t index, const BearingVector& bearing) { Set(index, bearing.Vector); }
+    void Set(std::size_t index, const Vector3& direction);
+    void PopBack();
+    void Clear();
+
+    std::size_t Size() const { return _m[0].size(); }
+    bool Empty() const { return _m[0].empty(); }
+    RotationMatrix Get(std::size_t index) const;
+
+    // out[i] = R_i * local[i]; sizes must match
+    void Apply(const Vector3Array& local, Vector3Array& out) const;
+
+    // out[i] = R_i * local (one local vector through every bearing frame)
+    void Apply(const Vector3& local, Vector3Array& out) const;
+
+    // out[i] = R_i^T * world[i]; sizes must match
+    void ApplyInverse(const Vector3Array& world, Vector3Array& out) const;
+
+private:
+    Vector3Array::Lane _m[9];
+
+    void Store(std::size_t index, const RotationMatrix& r);
+};
+
+#endif // BEARINGROTATION_H
@@ -0,0 +1,376 @@
+/**
+ * BinaryCodec.cpp
+ * Linked file: BinaryCodec.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ */
+
+#include "BinaryCodec.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+    // ----------------------------
+    // Little-endian primitives
+    // ----------------------------
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    constexpr bool kHostLittleEndian = false;
+#else
+    constexpr bool kHostLittleEndian = true;
+#endif
+
+    inline uint32_t ByteSwap(uint32_t v)
+    {
+        return (v >> 24) | ((v >> 8) & 0x0000FF00u) | ((v << 8) & 0x00FF0000u) | (v << 24);
+    }
+
+    inline uint32_t LoadU32(const uint8_t* p)
+    {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return kHostLittleEndian ? v : ByteSwap(v);
+    }
+
+    inline uint16_t LoadU16(const uint8_t* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    inline float LoadF32(const uint8_t* p)
+    {
+        uint32_t bits = LoadU32(p);
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    inline Vector3 LoadVector3(const uint8_t* p)
+    {
+        return Vector3(LoadF32(p), LoadF32(p + 4), LoadF32(p + 8));
+    }
+
+    inline uint8_t* StoreU32(uint8_t* p, uint32_t v)
+    {
+        v = kHostLittleEndian ? v : ByteSwap(v);
+        std::memcpy(p, &v, sizeof(v));
+        return p + 4;
+    }
+
+    inline uint8_t* StoreU16(uint8_t* p, uint16_t v)
+    {
+        p[0] = static_cast<uint8_t>(v & 0xFF);
+        p[1] = static_cast<uint8_t>(v >> 8);
+        return p + 2;
+    }
+
+    inline uint8_t* StoreF32(uint8_t* p, float v)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return StoreU32(p, bits);
+    }
+
+    inline uint8_t* StoreVector3(uint8_t* p, const Vector3& v)
+    {
+        p = StoreF32(p, v.x);
+        p = StoreF32(p, v.y);
+        return StoreF32(p, v.z);
+    }
+
+    uint32_t CheckedU32(std::size_t value)
+    {
+        if (value > UINT32_MAX)
+            throw std::length_error("BinaryCodec: count exceeds 32-bit record limit");
+        return static_cast<uint32_t>(value);
+    }
+
+    // ----------------------------
+    // Node table
+    // ----------------------------
+
+    /**
+     * @brief Deduplicates nodes by index and position, assigning table slots in first-seen order
+     */
+    class NodeSlotTable
+    {
+    public:
+        uint32_t Slot(const NodeVector& node)
+        {
+            auto range = _byIndex.equal_range(node.Index);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const NodeVector& existing = _nodes[it->second];
+                if (std::memcmp(&existing.Vector, &node.Vector, sizeof(Vector3)) == 0)
+                    return it->second;
+            }
+            uint32_t slot = CheckedU32(_nodes.size());
+            _nodes.push_back(node);
+            _byIndex.emplace(node.Index, slot);
+            return slot;
+        }
+
+        const std::vector<NodeVector>& Nodes() const { return _nodes; }
+
+    private:
+        std::vector<NodeVector> _nodes;
+        std::unordered_multimap<int, uint32_t> _byIndex;
+    };
+
+    uint8_t* WriteHeader(std::vector<uint8_t>& out, BinaryRecordType type, std::size_t count,
+                         std::size_t nodeCount, std::size_t bearingCount, std::size_t payloadBytes)
+    {
+        const std::size_t start = out.size();
+        out.resize(start + BinaryCodec::kHeaderBytes + payloadBytes);
+        uint8_t* p = out.data() + start;
+        p = StoreU32(p, BinaryCodec::kMagic);
+        p = StoreU16(p, BinaryCodec::kVersion);
+        p = StoreU16(p, static_cast<uint16_t>(type));
+        p = StoreU32(p, CheckedU32(count));
+        p = StoreU32(p, CheckedU32(nodeCount));
+        p = StoreU32(p, CheckedU32(bearingCount));
+        return StoreU32(p, CheckedU32(payloadBytes));
+    }
+
+    uint8_t* WriteNode(uint8_t* p, const NodeVector& node)
+    {
+        p = StoreU32(p, static_cast<uint32_t>(node.Index));
+        return StoreVector3(p, node.Vector);
+    }
+
+    uint8_t* WriteBearing(uint8_t* p, uint32_t nodeSlot, const BearingVector& bearing)
+    {
+        p = StoreU32(p, nodeSlot);
+        p = StoreVector3(p, bearing.Force);
+        return StoreVector3(p, bearing.Vector);
+    }
+}
+
+// ----------------------------
+// BinaryView
+// ----------------------------
+
+BinaryView::BinaryView(const uint8_t* data, std::size_t size)
+{
+    if (data == nullptr || size < BinaryCodec::kHeaderBytes)
+        throw std::runtime_error("BinaryView: buffer smaller than block header");
+    if (LoadU32(data) != BinaryCodec::kMagic)
+        throw std::runtime_error("BinaryView: bad magic");
+
+    _version = LoadU16(data + 4);
+    if (_version == 0 || _version > BinaryCodec::kVersion)
+        throw std::runtime_error("BinaryView: unsupported version");
+
+    uint16_t type = LoadU16(data + 6);
+    if (type < static_cast<uint16_t>(BinaryRecordType::NodeVector) || type > static_cast<uint16_t>(BinaryRecordType::Vertex))
+        throw std::runtime_error("BinaryView: unknown record type");
+    _type = static_cast<BinaryRecordType>(type);
+
+    _count = LoadU32(data + 8);
+    _nodeCount = LoadU32(data + 12);
+    _bearingCount = LoadU32(data + 16);
+    const std::size_t payloadBytes = LoadU32(data + 20);
+
+    std::size_t vertexCount = 0;
+    switch (_type)
+    {
+    case BinaryRecordType::NodeVector:
+        if (_count != _nodeCount || _bearingCount != 0)
+            throw std::runtime_error("BinaryView: inconsistent NodeVector block counts");
+        break;
+    case BinaryRecordType::BearingVector:
+        if (_count != _bearingCount)
+            throw std::runtime_error("BinaryView: inconsistent BearingVector block counts");
+        break;
+    case BinaryRecordType::Vertex:
+        vertexCount = _count;
+        break;
+    }
+
+    // Counts are 32-bit, so these products cannot overflow a 64-bit size_t
+    const std::size_t expected = _nodeCount * BinaryCodec::kNodeRecordBytes +
+                                 vertexCount * BinaryCodec::kVertexRecordBytes +
+                                 _bearingCount * BinaryCodec::kBearingRecordBytes;
+    if (payloadBytes != expected || size - BinaryCodec::kHeaderBytes < payloadBytes)
+        throw std::runtime_error("BinaryView: truncated or inconsistent payload");
+
+    _nodes = data + BinaryCodec::kHeaderBytes;
+    _vertices = _nodes + _nodeCount * BinaryCodec::kNodeRecordBytes;
+    _bearings = _vertices + vertexCount * BinaryCodec::kVertexRecordBytes;
+    _byteSize = BinaryCodec::kHeaderBytes + payloadBytes;
+
+    // Validate references once so accessors can stay unchecked
+    for (std::size_t i = 0; i < _bearingCount; ++i)
+    {
+        if (BearingNodeSlot(i) >= _nodeCount)
+            throw std::runtime_error("BinaryView: bearing refers to a missing node");
+    }
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        if (VertexNodeSlot(i) >= _nodeCount ||
+            VertexFirstBearing(i) > _bearingCount ||
+            VertexBearingCount(i) > _bearingCount - VertexFirstBearing(i))
+            throw std::runtime_error("BinaryView: vertex refers to a missing node or bearing");
+    }
+}
+
+int BinaryView::NodeIndex(std::size_t slot) const
+{
+    return static_cast<int>(LoadU32(_nodes + slot * BinaryCodec::kNodeRecordBytes));
+}
+
+Vector3 BinaryView::NodePosition(std::size_t slot) const
+{
+    return LoadVector3(_nodes + slot * BinaryCodec::kNodeRecordBytes + 4);
+}
+
+NodeVector BinaryView::Node(std::size_t slot) const
+{
+    return NodeVector(NodeIndex(slot), NodePosition(slot));
+}
+
+std::size_t BinaryView::BearingNodeSlot(std::size_t i) const
+{
+    return LoadU32(_bearings + i * BinaryCodec::kBearingRecordBytes);
+}
+
+Vector3 BinaryView::BearingForce(std::size_t i) const
+{
+    return LoadVector3(_bearings + i * BinaryCodec::kBearingRecordBytes + 4);
+}
+
+Vector3 BinaryView::BearingDirection(std::size_t i) const
+{
+    return LoadVector3(_bearings + i * BinaryCodec::kBearingRecordBytes + 16);
+}
+
+BearingVector BinaryView::Bearing(std::size_t i) const
+{
+    return BearingVector(Node(BearingNodeSlot(i)), BearingForce(i), BearingDirection(i));
+}
+
+std::size_t BinaryView::VertexNodeSlot(std::size_t i) const
+{
+    return LoadU32(_vertices + i * BinaryCodec::kVertexRecordBytes);
+}
+
+std::size_t BinaryView::VertexFirstBearing(std::size_t i) const
+{
+    return LoadU32(_vertices + i * BinaryCodec::kVertexRecordBytes + 4);
+}
+
+std::size_t BinaryView::VertexBearingCount(std::size_t i) const
+{
+    return LoadU32(_vertices + i * BinaryCodec::kVertexRecordBytes + 8);
+}
+
+// ----------------------------
+// Encode
+// ----------------------------
+
+void BinaryCodec::Encode(const NodeVector* nodes, std::size_t count, std::vector<uint8_t>& out)
+{
+    uint8_t* p = WriteHeader(out, BinaryRecordType::NodeVector, count, count, 0, count * kNodeRecordBytes);
+    for (std::size_t i = 0; i < count; ++i)
+        p = WriteNode(p, nodes[i]);
+}
+
+void BinaryCodec::Encode(const BearingVector* bearings, std::size_t count, std::vector<uint8_t>& out)
+{
+    NodeSlotTable table;
+    std::vector<uint32_t> slots(count);
+    for (std::size_t i = 0; i < count; ++i)
+        slots[i] = table.Slot(bearings[i].Node);
+
+    const std::size_t nodeCount = table.Nodes().size();
+    uint8_t* p = WriteHeader(out, BinaryRecordType::BearingVector, count, nodeCount, count,
+                             nodeCount * kNodeRecordBytes + count * kBearingRecordBytes);
+    for (const NodeVector& node : table.Nodes())
+        p = WriteNode(p, node);
+    for (std::size_t i = 0; i < count; ++i)
+        p = WriteBearing(p, slots[i], bearings[i]);
+}
+
+void BinaryCodec::Encode(const Vertex* const* vertices, std::size_t count, std::vector<uint8_t>& out)
+{
+    NodeSlotTable table;
+    std::vector<uint32_t> vertexSlots(count);
+    std::vector<uint32_t> bearingSlots;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vertexSlots[i] = table.Slot(vertices[i]->ReadNodeVector());
+        for (std::size_t b = 0; b < vertices[i]->BearingCount(); ++b)
+            bearingSlots.push_back(table.Slot(vertices[i]->ReadBearingNode(b)));
+    }
+
+    const std::size_t nodeCount = table.Nodes().size();
+    const std::size_t bearingCount = bearingSlots.size();
+    uint8_t* p = WriteHeader(out, BinaryRecordType::Vertex, count, nodeCount, bearingCount,
+                             nodeCount * kNodeRecordBytes + count * kVertexRecordBytes + bearingCount * kBearingRecordBytes);
+    for (const NodeVector& node : table.Nodes())
+        p = WriteNode(p, node);
+
+    uint32_t firstBearing = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const uint32_t bearingsOfVertex = CheckedU32(vertices[i]->BearingCount());
+        p = StoreU32(p, vertexSlots[i]);
+        p = StoreU32(p, firstBearing);
+        p = StoreU32(p, bearingsOfVertex);
+        firstBearing += bearingsOfVertex;
+    }
+
+    std::size_t b = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (std::size_t k = 0; k < vertices[i]->BearingCount(); ++k)
+        {
+            p = StoreU32(p, bearingSlots[b++]);
+            p = StoreVector3(p, vertices[i]->ReadBearingForce(k));
+            p = StoreVector3(p, vertices[i]->ReadBearingDirection(k));
+        }
+    }
+}
+
+// ----------------------------
+// Decode
+// ----------------------------
+
+void BinaryCodec::Decode(const BinaryView& view, std::vector<NodeVector>& out)
+{
+    if (view.Type() != BinaryRecordType::NodeVector)
+        throw std::runtime_error("BinaryCodec: block does not hold NodeVector records");
+    out.reserve(out.size() + view.Count());
+    for (std::size_t i = 0; i < view.Count(); ++i)
+        out.push_back(view.Node(i));
+}
+
+void BinaryCodec::Decode(const BinaryView& view, std::vector<BearingVector>& out)
+{
+    if (view.Type() != BinaryRecordType::BearingVector)
+        throw std::runtime_error("BinaryCodec: block does not hold BearingVector records");
+    out.reserve(out.size() + view.Count());
+    for (std::size_t i = 0; i < view.Count(); ++i)
+        out.push_back(view.Bearing(i));
+}
+
+void BinaryCodec::Decode(const BinaryView& view, std::size_t i, Vertex& vertex)
+{
+    if (view.Type() != BinaryRecordType::Vertex)
+        throw std::runtime_error("BinaryCodec: block does not hold Vertex records");
+    if (i >= view.Count())
+        throw std::out_of_range("BinaryCodec: vertex record index out of range");
+
+    vertex.UpdateNodeVector(view.Node(view.VertexNodeSlot(i)));
+    while (vertex.BearingCount() != 0)
+        vertex.DeleteBearingVector();
+
+    const std::size_t first = view.VertexFirstBearing(i);
+    const std::size_t last = first + view.VertexBearingCount(i);
+    for (std::size_t b = first; b < last; ++b)
+        vertex.PostBearingVector(view.Bearing(b));
+}
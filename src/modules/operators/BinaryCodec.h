@@ -0,0 +1,126 @@
+/**
+ * BinaryCodec.h
+ * Linked file: BinaryCodec.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Versioned little-endian binary encoding for NodeVector, BearingVector and Vertex
+ *
+ * A buffer is a sequence of blocks. Each block is a 24-byte header followed by fixed-size
+ * records, so BinaryView can read fields in place from a received buffer or mapped file.
+ * Nodes are written once per block into a node table and bearings refer to them by slot,
+ * instead of nesting a copy of the node in every bearing as toJson does.
+ *
+ * Layout (all fields little-endian, 4-byte aligned):
+ * BlockHeader  { u32 magic 'NBVB'; u16 version; u16 type; u32 count; u32 nodeCount; u32 bearingCount; u32 payloadBytes; }
+ * NodeRecord   { i32 index; f32 x, y, z; }                                 16 bytes
+ * BearingRecord{ u32 nodeSlot; f32 force[3]; f32 vector[3]; }              28 bytes
+ * VertexRecord { u32 nodeSlot; u32 firstBearing; u32 bearingCount; }       12 bytes
+ *
+ * Block payload: NodeRecord[nodeCount], then
+ * - NodeVector block:    nothing more (count == nodeCount)
+ * - BearingVector block: BearingRecord[count]
+ * - Vertex block:        VertexRecord[count], BearingRecord[bearingCount]
+ */
+
+#ifndef BINARYCODEC_H
+#define BINARYCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+#include "NodeVector.h"
+#include "BearingVector.h"
+#include "Vertex.h"
+
+enum class BinaryRecordType : uint16_t
+{
+    NodeVector = 1,
+    BearingVector = 2,
+    Vertex = 3
+};
+
+/**
+ * @brief Zero-copy read view over one encoded block
+ *
+ * Holds only a pointer into the caller's buffer, which must outlive the view. The constructor
+ * validates the header and sizes and throws std::runtime_error on malformed input; accessors
+ * assume a valid index.
+ */
+class BinaryView
+{
+public:
+    BinaryView(const uint8_t* data, std::size_t size);
+
+    BinaryRecordType Type() const { return _type; }
+    uint16_t Version() const { return _version; }
+    std::size_t Count() const { return _count; }
+    std::size_t NodeCount() const { return _nodeCount; }
+    std::size_t BearingCount() const { return _bearingCount; }
+
+    // Total bytes of this block; the next block (if any) starts here
+    std::size_t ByteSize() const { return _byteSize; }
+
+    // Node table
+    int NodeIndex(std::size_t slot) const;
+    Vector3 NodePosition(std::size_t slot) const;
+    NodeVector Node(std::size_t slot) const;
+
+    // Bearings (BearingVector and Vertex blocks)
+    std::size_t BearingNodeSlot(std::size_t i) const;
+    Vector3 BearingForce(std::size_t i) const;
+    Vector3 BearingDirection(std::size_t i) const;
+    BearingVector Bearing(std::size_t i) const;
+
+    // Vertices (Vertex blocks)
+    std::size_t VertexNodeSlot(std::size_t i) const;
+    std::size_t VertexFirstBearing(std::size_t i) const;
+    std::size_t VertexBearingCount(std::size_t i) const;
+
+private:
+    const uint8_t* _nodes;
+    const uint8_t* _vertices;
+    const uint8_t* _bearings;
+    BinaryRecordType _type;
+    uint16_t _version;
+    std::size_t _count;
+    std::size_t _nodeCount;
+    std::size_t _bearingCount;
+    std::size_t _byteSize;
+};
+
+/**
+ * @brief Bulk encode / decode
+ *
+ * Encode appends one block to out, so several blocks can share a buffer.
+ */
+class BinaryCodec
+{
+public:
+    static constexpr uint32_t kMagic = 0x4256424E; // "NBVB"
+    static constexpr uint16_t kVersion = 1;
+    static constexpr std::size_t kHeaderBytes = 24;
+    static constexpr std::size_t kNodeRecordBytes = 16;
+    static constexpr std::size_t kBearingRecordBytes = 28;
+    static constexpr std::size_t kVertexRecordBytes = 12;
+
+    static void Encode(const NodeVector* nodes, std::size_t count, std::vector<uint8_t>& out);
+    static void Encode(const BearingVector* bearings, std::size_t count, std::vector<uint8_t>& out);
+    static void Encode(const Vertex* const* vertices, std::size_t count, std::vector<uint8_t>& out);
+
+    static void Encode(const std::vector<NodeVector>& nodes, std::vector<uint8_t>& out) { Encode(nodes.data(), nodes.size(), out); }
+    static void Encode(const std::vector<BearingVector>& bearings, std::vector<uint8_t>& out) { Encode(bearings.data(), bearings.size(), out); }
+    static void Encode(const std::vector<const Vertex*>& vertices, std::vector<uint8_t>& out) { Encode(vertices.data(), vertices.size(), out); }
+
+    // Append every record of a block of the matching type; throws std::runtime_error otherwise
+    static void Decode(const BinaryView& view, std::vector<NodeVector>& out);
+    static void Decode(const BinaryView& view, std::vector<BearingVector>& out);
+
+    // Replace vertex's node and bearings with vertex record i of a Vertex block
+    static void Decode(const BinaryView& view, std::size_t i, Vertex& vertex);
+};
+
+#endif // BINARYCODEC_H
@@ -7,8 +7,14 @@
  */
 
 #include "CoordinateConverter.h"
+#include "CpuFeatures.h"
+#include "FastMath.h"
 #include "Vector3.h"
 
+#if defined(NBVS_SIMD_X86)
+#include <immintrin.h>
+#endif
+
 /**
  * @brief Converts a SphericalVector to a CartesianVector.
  * 
@@ -43,4 +49,237 @@ SphericalVector CoordinateConverter::cartesianToSpherical(const CartesianVector&
     float theta = (cv.x == 0.0f && cv.y == 0.0f) ? 0.0f : std::atan2(cv.y, cv.x);
     float phi = (r == 0.0f) ? 0.0f : std::acos(cv.z / r);
     return SphericalVector(r, theta, phi);
-}
\ No newline at end of file
+}
+
+// ----------------------------
+// Batch conversion
+// ----------------------------
+
+namespace {
+
+#if defined(NBVS_SIMD_X86)
+    // Lane-wise versions of FastMath; see FastMath.h for the formulas
+
+    NBVS_TARGET_AVX2 inline void SinCosAvx2(__m256 x, __m256& s, __m256& c, bool approx) {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        __m256 ax = _mm256_andnot_ps(signMask, x);
+        __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(ax, _mm256_set1_ps(FastMath::kFourOverPi)));
+        j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+        __m256 y = _mm256_cvtepi32_ps(j);
+        __m256 r = _mm256_fnmadd_ps(y, _mm256_set1_ps(FastMath::kDP1), ax);
+        r = _mm256_fnmadd_ps(y, _mm256_set1_ps(FastMath::kDP2), r);
+        r = _mm256_fnmadd_ps(y, _mm256_set1_ps(FastMath::kDP3), r);
+        __m256 z = _mm256_mul_ps(r, r);
+
+        __m256 sinPoly, cosPoly;
+        if (approx) {
+            sinPoly = _mm256_fmadd_ps(z, _mm256_set1_ps(8.3333333e-3f), _mm256_set1_ps(-1.6666667e-1f));
+            sinPoly = _mm256_fmadd_ps(_mm256_mul_ps(r, z), sinPoly, r);
+            cosPoly = _mm256_fmadd_ps(z, _mm256_set1_ps(-1.3888889e-3f), _mm256_set1_ps(4.1666667e-2f));
+            cosPoly = _mm256_fmadd_ps(z, cosPoly, _mm256_set1_ps(-0.5f));
+            cosPoly = _mm256_fmadd_ps(z, cosPoly, _mm256_set1_ps(1.0f));
+        } else {
+            sinPoly = _mm256_fmadd_ps(z, _mm256_set1_ps(-1.9515295891e-4f), _mm256_set1_ps(8.3321608736e-3f));
+            sinPoly = _mm256_fmadd_ps(sinPoly, z, _mm256_set1_ps(-1.6666654611e-1f));
+            sinPoly = _mm256_fmadd_ps(_mm256_mul_ps(sinPoly, z), r, r);
+            cosPoly = _mm256_fmadd_ps(z, _mm256_set1_ps(2.443315711809948e-5f), _mm256_set1_ps(-1.388731625493765e-3f));
+            cosPoly = _mm256_fmadd_ps(cosPoly, z, _mm256_set1_ps(4.166664568298827e-2f));
+            cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+            cosPoly = _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, cosPoly);
+            cosPoly = _mm256_add_ps(cosPoly, _mm256_set1_ps(1.0f));
+        }
+
+        // Octant bookkeeping
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(2)));
+        __m256 sv = _mm256_blendv_ps(sinPoly, cosPoly, swap);
+        __m256 cv = _mm256_blendv_ps(cosPoly, sinPoly, swap);
+        __m256 sinSign = _mm256_xor_ps(_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29)),
+                                       _mm256_and_ps(x, signMask));
+        __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(
+            _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+        s = _mm256_xor_ps(sv, sinSign);
+        c = _mm256_xor_ps(cv, cosSign);
+    }
+
+    NBVS_TARGET_AVX2 inline __m256 Atan2Avx2(__m256 y, __m256 x, bool approx) {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 zero = _mm256_setzero_ps();
+        __m256 ax = _mm256_andnot_ps(signMask, x);
+        __m256 ay = _mm256_andnot_ps(signMask, y);
+        __m256 hi = _mm256_max_ps(ax, ay);
+        __m256 lo = _mm256_min_ps(ax, ay);
+        __m256 hiIsZero = _mm256_cmp_ps(hi, zero, _CMP_EQ_OQ);
+        __m256 a = _mm256_div_ps(lo, _mm256_blendv_ps(hi, _mm256_set1_ps(1.0f), hiIsZero));
+
+        __m256 r;
+        if (approx) {
+            __m256 z = _mm256_mul_ps(a, a);
+            r = _mm256_fmadd_ps(z, _mm256_set1_ps(0.0208351f), _mm256_set1_ps(-0.0851330f));
+            r = _mm256_fmadd_ps(z, r, _mm256_set1_ps(0.1801410f));
+            r = _mm256_fmadd_ps(z, r, _mm256_set1_ps(-0.3302995f));
+            r = _mm256_fmadd_ps(z, r, _mm256_set1_ps(0.9998660f));
+            r = _mm256_mul_ps(a, r);
+        } else {
+            __m256 reduce = _mm256_cmp_ps(a, _mm256_set1_ps(FastMath::kTanPiOver8), _CMP_GT_OQ);
+            __m256 reduced = _mm256_div_ps(_mm256_sub_ps(a, _mm256_set1_ps(1.0f)), _mm256_add_ps(a, _mm256_set1_ps(1.0f)));
+            a = _mm256_blendv_ps(a, reduced, reduce);
+            __m256 offset = _mm256_and_ps(reduce, _mm256_set1_ps(FastMath::kQuarterPi));
+            __m256 z = _mm256_mul_ps(a, a);
+            r = _mm256_fmadd_ps(z, _mm256_set1_ps(8.05374449538e-2f), _mm256_set1_ps(-1.38776856032e-1f));
+            r = _mm256_fmadd_ps(r, z, _mm256_set1_ps(1.99777106478e-1f));
+            r = _mm256_fmadd_ps(r, z, _mm256_set1_ps(-3.33329491539e-1f));
+            r = _mm256_fmadd_ps(_mm256_mul_ps(r, z), a, a);
+            r = _mm256_add_ps(r, offset);
+        }
+
+        // Unfold the octant
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(FastMath::kHalfPi), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(FastMath::kPi), r), _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+        r = _mm256_xor_ps(r, _mm256_and_ps(_mm256_cmp_ps(y, zero, _CMP_LT_OQ), signMask));
+        return _mm256_andnot_ps(hiIsZero, r);
+    }
+
+    NBVS_TARGET_AVX2 inline __m256 AcosAvx2(__m256 x, bool approx) {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 pi = _mm256_set1_ps(FastMath::kPi);
+        __m256 negative = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+        __m256 a = _mm256_min_ps(_mm256_andnot_ps(signMask, x), one);
+
+        if (approx) {
+            __m256 p = _mm256_fmadd_ps(a, _mm256_set1_ps(-0.0187293f), _mm256_set1_ps(0.0742610f));
+            p = _mm256_fmadd_ps(a, p, _mm256_set1_ps(-0.2121144f));
+            p = _mm256_fmadd_ps(a, p, _mm256_set1_ps(1.5707288f));
+            __m256 r = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(one, a)), p);
+            return _mm256_blendv_ps(r, _mm256_sub_ps(pi, r), negative);
+        }
+
+        __m256 big = _mm256_cmp_ps(a, _mm256_set1_ps(0.5f), _CMP_GT_OQ);
+        __m256 zBig = _mm256_mul_ps(_mm256_set1_ps(0.5f), _mm256_sub_ps(one, a));
+        __m256 z = _mm256_blendv_ps(_mm256_mul_ps(a, a), zBig, big);
+        __m256 s = _mm256_blendv_ps(a, _mm256_sqrt_ps(zBig), big);
+
+        __m256 p = _mm256_fmadd_ps(z, _mm256_set1_ps(4.2163199048e-2f), _mm256_set1_ps(2.4181311049e-2f));
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(4.5470025998e-2f));
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(7.4953002686e-2f));
+        p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.6666752422e-1f));
+        p = _mm256_fmadd_ps(_mm256_mul_ps(p, z), s, s);
+
+        __m256 twoP = _mm256_add_ps(p, p);
+        __m256 rBig = _mm256_blendv_ps(twoP, _mm256_sub_ps(pi, twoP), negative);
+        __m256 halfPi = _mm256_set1_ps(FastMath::kHalfPi);
+        __m256 rSmall = _mm256_blendv_ps(_mm256_sub_ps(halfPi, p), _mm256_add_ps(halfPi, p), negative);
+        return _mm256_blendv_ps(rSmall, rBig, big);
+    }
+
+    NBVS_TARGET_AVX2 size_t SphericalToCartesianAvx2(const SphericalVector* in, CartesianVector* out, size_t count, bool approx) {
+        const size_t n = count & ~size_t(7);
+        alignas(32) float r[8], theta[8], phi[8], x[8], y[8], z[8];
+        for (size_t i = 0; i < n; i += 8) {
+            for (int k = 0; k < 8; ++k) {
+                r[k] = in[i + k].r;
+                theta[k] = in[i + k].theta;
+                phi[k] = in[i + k].phi;
+            }
+            __m256 sinTheta, cosTheta, sinPhi, cosPhi;
+            SinCosAvx2(_mm256_load_ps(theta), sinTheta, cosTheta, approx);
+            SinCosAvx2(_mm256_load_ps(phi), sinPhi, cosPhi, approx);
+            __m256 vr = _mm256_load_ps(r);
+            __m256 rSinPhi = _mm256_mul_ps(vr, sinPhi);
+            _mm256_store_ps(x, _mm256_mul_ps(rSinPhi, cosTheta));
+            _mm256_store_ps(y, _mm256_mul_ps(rSinPhi, sinTheta));
+            _mm256_store_ps(z, _mm256_mul_ps(vr, cosPhi));
+            for (int k = 0; k < 8; ++k) {
+                out[i + k] = CartesianVector(x[k], y[k], z[k]);
+            }
+        }
+        return n;
+    }
+
+    NBVS_TARGET_AVX2 size_t CartesianToSphericalAvx2(const CartesianVector* in, SphericalVector* out, size_t count, bool approx) {
+        const size_t n = count & ~size_t(7);
+        alignas(32) float x[8], y[8], z[8], r[8], theta[8], phi[8];
+        const __m256 zero = _mm256_setzero_ps();
+        for (size_t i = 0; i < n; i += 8) {
+            for (int k = 0; k < 8; ++k) {
+                x[k] = in[i + k].x;
+                y[k] = in[i + k].y;
+                z[k] = in[i + k].z;
+            }
+            __m256 vx = _mm256_load_ps(x), vy = _mm256_load_ps(y), vz = _mm256_load_ps(z);
+            __m256 vr = _mm256_sqrt_ps(_mm256_fmadd_ps(vz, vz, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vx, vx))));
+            __m256 rIsZero = _mm256_cmp_ps(vr, zero, _CMP_EQ_OQ);
+            __m256 cosPhi = _mm256_div_ps(vz, _mm256_blendv_ps(vr, _mm256_set1_ps(1.0f), rIsZero));
+            _mm256_store_ps(r, vr);
+            _mm256_store_ps(theta, Atan2Avx2(vy, vx, approx));
+            _mm256_store_ps(phi, _mm256_andnot_ps(rIsZero, AcosAvx2(cosPhi, approx)));
+            for (int k = 0; k < 8; ++k) {
+                out[i + k] = SphericalVector(r[k], theta[k], phi[k]);
+            }
+        }
+        return n;
+    }
+#endif
+
+} // namespace
+
+void CoordinateConverter::sphericalToCartesian(const SphericalVector* in, CartesianVector* out, size_t count,
+                                               ConversionAccuracy accuracy) {
+    if (accuracy == ConversionAccuracy::Exact) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = sphericalToCartesian(in[i]);
+        }
+        return;
+    }
+
+    const bool approx = (accuracy == ConversionAccuracy::Approx);
+    size_t i = 0;
+#if defined(NBVS_SIMD_X86)
+    if (CpuFeatures::Active() == SimdLevel::AVX2) {
+        i = SphericalToCartesianAvx2(in, out, count, approx);
+    }
+#endif
+    for (; i < count; ++i) {
+        float sinTheta, cosTheta, sinPhi, cosPhi;
+        FastMath::SinCos(in[i].theta, sinTheta, cosTheta, approx);
+        FastMath::SinCos(in[i].phi, sinPhi, cosPhi, approx);
+        out[i] = CartesianVector(in[i].r * sinPhi * cosTheta, in[i].r * sinPhi * sinTheta, in[i].r * cosPhi);
+    }
+}
+
+void CoordinateConverter::cartesianToSpherical(const CartesianVector* in, SphericalVector* out, size_t count,
+                                               ConversionAccuracy accuracy) {
+    if (accuracy == ConversionAccuracy::Exact) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = cartesianToSpherical(in[i]);
+        }
+        return;
+    }
+
+    const bool approx = (accuracy == ConversionAccuracy::Approx);
+    size_t i = 0;
+#if defined(NBVS_SIMD_X86)
+    if (CpuFeatures::Active() == SimdLevel::AVX2) {
+        i = CartesianToSphericalAvx2(in, out, count, approx);
+    }
+#endif
+    for (; i < count; ++i) {
+        const CartesianVector& cv = in[i];
+        float r = std::sqrt(cv.x * cv.x + cv.y * cv.y + cv.z * cv.z);
+        float theta = FastMath::Atan2(cv.y, cv.x, approx);
+        float phi = (r == 0.0f) ? 0.0f : FastMath::Acos(cv.z / r, approx);
+        out[i] = SphericalVector(r, theta, phi);
+    }
+}
+
+void CoordinateConverter::sphericalToCartesian(const std::vector<SphericalVector>& in, std::vector<CartesianVector>& out,
+                                               ConversionAccuracy accuracy) {
+    out.resize(in.size());
+    sphericalToCartesian(in.data(), out.data(), in.size(), accuracy);
+}
+
+void CoordinateConverter::cartesianToSpherical(const std::vector<CartesianVector>& in, std::vector<SphericalVector>& out,
+                                               ConversionAccuracy accuracy) {
+    out.resize(in.size());
+    cartesianToSpherical(in.data(), out.data(), in.size(), accuracy);
+}
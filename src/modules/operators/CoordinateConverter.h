@@ -4,7 +4,7 @@
  * Security: Confidential
  * Author: Minseok Doo
  * Date: Oct 7, 2024
- * Last Modified: Nov 11, 2024
+ * Last Modified: Oct 17, 2026
  * 
  * Purpose of Class:
  * Conversion between spherical coordinates and Cartesian coordinates using Vector3
@@ -19,6 +19,8 @@
 #define COORDINATECONVERTER_H
 
 #include <cmath>
+#include <cstddef>
+#include <vector>
 #include "Vector3.h"
 
 /**
@@ -59,6 +61,16 @@ struct CartesianVector {
         : x(x_val), y(y_val), z(z_val) {}
 };
 
+/**
+ * @brief 배치 변환의 정확도 단계.
+ *        Exact: libm, Fast: 다항식 근사 (수 ulp 이내), Approx: 짧은 다항식 (약 1e-4 rad).
+ */
+enum class ConversionAccuracy {
+    Exact,
+    Fast,
+    Approx
+};
+
 /**
  * @brief CoordinateConverter 클래스.
  *        SphericalVector와 CartesianVector 간의 변환을 제공하는 유틸리티 클래스.
@@ -80,6 +92,35 @@ public:
      * @return SphericalVector 변환된 SphericalVector 객체.
      */
     static SphericalVector cartesianToSpherical(const CartesianVector& cv);
+
+    /**
+     * @brief SphericalVector 배열을 CartesianVector 배열로 일괄 변환합니다.
+     *        Fast/Approx 는 AVX2 사용 가능 시 8개 단위로 처리합니다.
+     *
+     * @param in 변환할 SphericalVector 배열.
+     * @param out 결과를 저장할 CartesianVector 배열 (count 개).
+     * @param count 원소 개수.
+     * @param accuracy 정확도 단계.
+     */
+    static void sphericalToCartesian(const SphericalVector* in, CartesianVector* out, size_t count,
+                                     ConversionAccuracy accuracy = ConversionAccuracy::Fast);
+
+    /**
+     * @brief CartesianVector 배열을 SphericalVector 배열로 일괄 변환합니다.
+     *
+     * @param in 변환할 CartesianVector 배열.
+     * @param out 결과를 저장할 SphericalVector 배열 (count 개).
+     * @param count 원소 개수.
+     * @param accuracy 정확도 단계.
+     */
+    static void cartesianToSpherical(const CartesianVector* in, SphericalVector* out, size_t count,
+                                     ConversionAccuracy accuracy = ConversionAccuracy::Fast);
+
+    // std::vector 편의 오버로드; out 은 in 크기로 조정됩니다.
+    static void sphericalToCartesian(const std::vector<SphericalVector>& in, std::vector<CartesianVector>& out,
+                                     ConversionAccuracy accuracy = ConversionAccuracy::Fast);
+    static void cartesianToSpherical(const std::vector<CartesianVector>& in, std::vector<SphericalVector>& out,
+                                     ConversionAccuracy accuracy = ConversionAccuracy::Fast);
 };
 
 #endif // COORDINATECONVERTER_H
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * CpuFeatures.cpp
+ * Linked file: CpuFeatures.h
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ */
+
+#include "CpuFeatures.h"
+
+#include <atomic>
+
+#if defined(NBVS_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    // -1 means no override
+    std::atomic<int> overrideLevel(-1);
+
+    SimdLevel Probe()
+    {
+#if defined(NBVS_SIMD_X86)
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return SimdLevel::AVX2;
+#elif defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] >= 7)
+        {
+            __cpuid(info, 1);
+            bool fma = (info[2] & (1 << 12)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            __cpuidex(info, 7, 0);
+            bool avx2 = (info[1] & (1 << 5)) != 0;
+            if (fma && osxsave && avx2 && (_xgetbv(0) & 0x6) == 0x6)
+                return SimdLevel::AVX2;
+        }
+#endif
+        return SimdLevel::Scalar;
+#elif defined(NBVS_SIMD_NEON)
+        // NEON is mandatory on AArch64
+        return SimdLevel::NEON;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+}
+
+SimdLevel CpuFeatures::Detect()
+{
+    static const SimdLevel detected = Probe();
+    return detected;
+}
+
+SimdLevel CpuFeatures::Active()
+{
+    int level = overrideLevel.load(std::memory_order_relaxed);
+    if (level < 0)
+        return Detect();
+    return static_cast<SimdLevel>(level);
+}
+
+void CpuFeatures::Override(SimdLevel level)
+{
+    // Never dispatch to an instruction set the host lacks
+    if (level != SimdLevel::Scalar && level != Detect())
+        level = SimdLevel::Scalar;
+    overrideLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void CpuFeatures::ClearOverride()
+{
+    overrideLevel.store(-1, std::memory_order_relaxed);
+}
+
+const char* CpuFeatures::Name(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::AVX2:
+        return "AVX2";
+    case SimdLevel::NEON:
+        return "NEON";
+    case SimdLevel::Scalar:
+    default:
+        return "Scalar";
+    }
+}
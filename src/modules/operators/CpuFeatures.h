@@ -0,0 +1,58 @@
+/**
+ * CpuFeatures.h
+ * Linked file: CpuFeatures.cpp
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Runtime SIMD detection shared by the batch kernels
+ *
+ * AVX2 kernels are compiled per function with NBVS_TARGET_AVX2 so the library itself needs no
+ * global -mavx2 flag; they only run when CpuFeatures::Active() selects AVX2, which it never
+ * does unless CpuFeatures::Detect() found AVX2 on the host CPU.
+ */
+
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define NBVS_SIMD_X86 1
+#if defined(__GNUC__) || defined(__clang__)
+#define NBVS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define NBVS_TARGET_AVX2
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define NBVS_SIMD_NEON 1
+#endif
+
+/**
+ * @brief Instruction set used by the batch kernels
+ */
+enum class SimdLevel
+{
+    Scalar,
+    AVX2,
+    NEON
+};
+
+/**
+ * @brief CPU feature queries
+ */
+class CpuFeatures
+{
+public:
+    // Best level supported by the host CPU; probed once
+    static SimdLevel Detect();
+
+    // Level the kernels dispatch to: Detect() unless overridden
+    static SimdLevel Active();
+
+    // Force a level (clamped to Detect()); used by tests and benchmarks to compare paths
+    static void Override(SimdLevel level);
+    static void ClearOverride();
+
+    static const char* Name(SimdLevel level);
+};
+
+#endif // CPUFEATURES_H
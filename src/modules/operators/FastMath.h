@@ -0,0 +1,129 @@
+/**
+ * FastMath.h
+ * Security: Confidential
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Polynomial sin/cos/atan2/acos approximations for the batch converters
+ *
+ * Two tiers are provided:
+ * - Fast:   Cephes-style minimax polynomials, within a few ulp for |x| < 8192
+ * - Approx: short polynomials, absolute error around 1e-4 rad
+ * The AVX2 kernels in CoordinateConverter.cpp implement the same formulas lane by lane.
+ *
+ * Equations:
+ * Equ(1): x = r - j * (DP1 + DP2 + DP3), j = 2 * round(|x| * 2 / pi)   (Cody-Waite reduction)
+ * Equ(2): atan2(y, x) = q(atan(min(|x|,|y|) / max(|x|,|y|)))           (octant folding)
+ * Equ(3): acos(a) = 2 * asin(sqrt((1 - a) / 2)), a > 0.5
+ */
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <cmath>
+
+class FastMath {
+public:
+    static constexpr float kPi = 3.14159265358979323846f;
+    static constexpr float kHalfPi = 1.57079632679489661923f;
+    static constexpr float kQuarterPi = 0.78539816339744830962f;
+    static constexpr float kFourOverPi = 1.27323954473516268615f;
+
+    // Cody-Waite split of pi / 4
+    static constexpr float kDP1 = 0.78515625f;
+    static constexpr float kDP2 = 2.4187564849853515625e-4f;
+    static constexpr float kDP3 = 3.77489497744594108e-8f;
+
+    static constexpr float kTanPiOver8 = 0.4142135623730950f;
+
+    /**
+     * @brief sin and cos of x in one reduction (Equ. 1)
+     */
+    static inline void SinCos(float x, float& s, float& c, bool approx = false) {
+        float ax = std::fabs(x);
+        int j = static_cast<int>(ax * kFourOverPi);
+        j = (j + 1) & ~1;
+        float y = static_cast<float>(j);
+        float r = ((ax - y * kDP1) - y * kDP2) - y * kDP3;
+        float z = r * r;
+
+        float sinPoly, cosPoly;
+        if (approx) {
+            sinPoly = r + r * z * (-1.6666667e-1f + z * 8.3333333e-3f);
+            cosPoly = 1.0f + z * (-0.5f + z * (4.1666667e-2f + z * -1.3888889e-3f));
+        } else {
+            sinPoly = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+            cosPoly = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+        }
+
+        // Octant bookkeeping
+        bool swap = (j & 2) != 0;
+        float sv = swap ? cosPoly : sinPoly;
+        float cv = swap ? sinPoly : cosPoly;
+        bool sinNegative = ((j & 4) != 0) != (x < 0.0f);
+        bool cosNegative = ((j - 2) & 4) == 0;
+        s = sinNegative ? -sv : sv;
+        c = cosNegative ? -cv : cv;
+    }
+
+    /**
+     * @brief atan(a) for a in [0, 1]
+     */
+    static inline float AtanUnit(float a, bool approx = false) {
+        if (approx) {
+            float z = a * a;
+            return a * (0.9998660f + z * (-0.3302995f + z * (0.1801410f + z * (-0.0851330f + z * 0.0208351f))));
+        }
+        float offset = 0.0f;
+        if (a > kTanPiOver8) {
+            offset = kQuarterPi;
+            a = (a - 1.0f) / (a + 1.0f);
+        }
+        float z = a * a;
+        return (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * a + a + offset;
+    }
+
+    /**
+     * @brief atan2(y, x) with atan2(0, 0) = 0 (Equ. 2)
+     */
+    static inline float Atan2(float y, float x, bool approx = false) {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float hi = ax > ay ? ax : ay;
+        float lo = ax > ay ? ay : ax;
+        if (hi == 0.0f)
+            return 0.0f;
+        float r = AtanUnit(lo / hi, approx);
+        if (ay > ax) r = kHalfPi - r;
+        if (x < 0.0f) r = kPi - r;
+        return y < 0.0f ? -r : r;
+    }
+
+    /**
+     * @brief acos(x), x clamped to [-1, 1] (Equ. 3)
+     */
+    static inline float Acos(float x, bool approx = false) {
+        float a = std::fabs(x);
+        if (a > 1.0f) a = 1.0f;
+        float r;
+        if (approx) {
+            r = std::sqrt(1.0f - a) * (1.5707288f + a * (-0.2121144f + a * (0.0742610f + a * -0.0187293f)));
+            return x < 0.0f ? kPi - r : r;
+        }
+        if (a > 0.5f) {
+            float z = 0.5f * (1.0f - a);
+            float s = std::sqrt(z);
+            r = 2.0f * AsinPoly(s, z);
+            return x < 0.0f ? kPi - r : r;
+        }
+        float asin = AsinPoly(a, a * a);
+        return x < 0.0f ? kHalfPi + asin : kHalfPi - asin;
+    }
+
+    // asin(s) for s in [0, 0.5], with z = s * s
+    static inline float AsinPoly(float s, float z) {
+        return ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z + 7.4953002686e-2f) * z + 1.6666752422e-1f) * z * s + s;
+    }
+};
+
+#endif // FASTMATH_H
@@ -1,6 +1,14 @@
 // Vertex.cpp
 #include "Vertex.h"
+#include "EditEpoch.h"
 #include <iostream>
+#include <algorithm>
+#include <limits>
+
+namespace {
+    // Node reported by a normalized vertex before its first UpdateNodeVector
+    const NodeVector kDefaultNode(0, Vector3(0.0f, 0.0f, 0.0f));
+}
 
 std::ostream& operator<<(std::ostream& os, const Vertex& vertex) {
     os << "Vertex(Index: " << vertex.GetIndex() << ", NodeVector: " << vertex.ReadNodeVector() << ")";
@@ -11,16 +19,74 @@ std::ostream& operator<<(std::ostream& os, const Vertex& vertex) {
 Vertex::Vertex()
     : index(0),
       _node(std::make_unique<NodeVector>(0, Vector3(0.0f, 0.0f, 0.0f))), // 필수 매개변수 전달
-      _bearingVectorList(std::make_unique<std::vector<BearingVector>>()) {}
+      _bearingVectorList(std::make_unique<std::vector<BearingVector>>()),
+      _nodeHandle(kInvalidNodeHandle),
+      _version(0),
+      _bearingListVersion(std::numeric_limits<uint64_t>::max()),
+      _bearingRotations(std::make_unique<BearingRotationSet>()),
+      _bearingRotationsValid(false) {}
+
+Vertex::Vertex(std::shared_ptr<NodeTable> nodeTable)
+    : index(0),
+      _bearingVectorList(std::make_unique<std::vector<BearingVector>>()),
+      _nodeTable(std::move(nodeTable)),
+      _nodeHandle(kInvalidNodeHandle),
+      _bearingRefList(std::make_unique<std::vector<BearingVectorRef>>()),
+      _version(0),
+      _bearingListVersion(std::numeric_limits<uint64_t>::max()),
+      _bearingListMutex(std::make_unique<std::mutex>()),
+      _bearingRotations(std::make_unique<BearingRotationSet>()),
+      _bearingRotationsValid(false) {
+    if (!_nodeTable) {
+        // Fall back to embedded storage
+        _node = std::make_unique<NodeVector>(kDefaultNode);
+        _bearingRefList.reset();
+        _bearingListMutex.reset();
+    }
+}
 
 Vertex::~Vertex() {
     // Cleanup if necessary
 }
 
+Vertex::Vertex(Vertex&& other) noexcept = default;
+Vertex& Vertex::operator=(Vertex&& other) noexcept = default;
+
 // NodeVector Methods
 void Vertex::UpdateNodeVector(const NodeVector& node) {
+    if (_nodeTable) {
+        // A new Index rebinds the vertex to that node; the table entry it left is untouched
+        bool rebound = false;
+        if (_nodeHandle == kInvalidNodeHandle || _nodeTable->Get(_nodeHandle).Index != node.Index) {
+            _nodeHandle = _nodeTable->Intern(node);
+            rebound = true;
+        }
+        // The table stamps the node itself (see GetVersion); only a rebind changes this vertex
+        _nodeTable->Update(_nodeHandle, node);
+        index = node.Index; // Vertex의 index를 NodeVector의 index와 동기화
+        if (rebound) {
+            _version = EditEpoch::Advance();
+        }
+        return;
+    }
+    if (_node && _node->Index == node.Index && _node->Vector == node.Vector) {
+        return; // Unchanged: keep the version so derived caches stay valid
+    }
     *_node = node;
     index = node.Index; // Vertex의 index를 NodeVector의 index와 동기화
+    _version = EditEpoch::Advance();
+}
+
+uint64_t Vertex::GetVersion() const {
+    if (!_nodeTable) {
+        return _version;
+    }
+    // All stamps come from EditEpoch, so the newest one changes on any edit this vertex depends on
+    uint64_t version = std::max(_version, _nodeTable->Revision(_nodeHandle));
+    for (const BearingVectorRef& ref : *_bearingRefList) {
+        version = std::max(version, _nodeTable->Revision(ref.Node));
+    }
+    return version;
 }
 
 void Vertex::CreateNodeVector(const NodeVector& node) {
@@ -31,19 +97,136 @@ void Vertex::DeleteNodeVector() {
     _node.reset();
 }
 
+const NodeVector& Vertex::ReadNodeVector() const {
+    if (_nodeTable) {
+        return _nodeHandle == kInvalidNodeHandle ? kDefaultNode : _nodeTable->Get(_nodeHandle);
+    }
+    return *(_node);
+}
+
 // BearingVector Methods
 void Vertex::PostBearingVector(const BearingVector& bearing) {
-    _bearingVectorList->push_back(bearing);
+    if (_nodeTable) {
+        _bearingRefList->push_back(BearingVectorRef::FromBearing(bearing, *_nodeTable));
+    } else {
+        _bearingVectorList->push_back(bearing);
+    }
+    if (_bearingRotationsValid) {
+        _bearingRotations->PushBack(bearing);
+    }
+    _version = EditEpoch::Advance();
 }
 
 void Vertex::PutBearingVector(const BearingVector& bearing) {
-    if (!_bearingVectorList->empty()) {
-        (*_bearingVectorList)[_bearingVectorList->size() - 1] = bearing;
+    const std::size_t count = BearingCount();
+    if (count != 0) {
+        if (_nodeTable) {
+            (*_bearingRefList)[count - 1] = BearingVectorRef::FromBearing(bearing, *_nodeTable);
+        } else {
+            (*_bearingVectorList)[count - 1] = bearing;
+        }
+        if (_bearingRotationsValid) {
+            _bearingRotations->Set(count - 1, bearing);
+        }
+        _version = EditEpoch::Advance();
     }
 }
 
 void Vertex::DeleteBearingVector() {
-    if (!_bearingVectorList->empty()) {
-        _bearingVectorList->pop_back();
+    if (BearingCount() != 0) {
+        if (_nodeTable) {
+            _bearingRefList->pop_back();
+        } else {
+            _bearingVectorList->pop_back();
+        }
+        if (_bearingRotationsValid) {
+            _bearingRotations->PopBack();
+        }
+        _version = EditEpoch::Advance();
+    }
+}
+
+const std::vector<BearingVector>& Vertex::ReadBearingVectorList() const {
+    if (_nodeTable) {
+        // Resolved again only when the vertex or the shared table changed since the last read
+        std::lock_guard<std::mutex> lock(*_bearingListMutex);
+        const uint64_t version = GetVersion();
+        if (_bearingListVersion != version) {
+            _bearingVectorList->clear();
+            for (const BearingVectorRef& ref : *_bearingRefList) {
+                _bearingVectorList->push_back(ref.Resolve(*_nodeTable));
+            }
+            _bearingListVersion = version;
+        }
+    }
+    return *(_bearingVectorList);
+}
+
+// Per-bearing accessors
+std::size_t Vertex::BearingCount() const {
+    return _nodeTable ? _bearingRefList->size() : _bearingVectorList->size();
+}
+
+const Vector3& Vertex::ReadBearingForce(std::size_t i) const {
+    return _nodeTable ? (*_bearingRefList)[i].Force : (*_bearingVectorList)[i].Force;
+}
+
+const Vector3& Vertex::ReadBearingDirection(std::size_t i) const {
+    return _nodeTable ? (*_bearingRefList)[i].Vector : (*_bearingVectorList)[i].Vector;
+}
+
+const NodeVector& Vertex::ReadBearingNode(std::size_t i) const {
+    return _nodeTable ? _nodeTable->Get((*_bearingRefList)[i].Node) : (*_bearingVectorList)[i].Node;
+}
+
+BearingVector Vertex::ReadBearingVector(std::size_t i) const {
+    return BearingVector(ReadBearingNode(i), ReadBearingForce(i), ReadBearingDirection(i));
+}
+
+// Memory report
+VertexMemoryReport Vertex::ReportMemory() const {
+    const std::size_t k = BearingCount();
+    VertexMemoryReport report;
+    report.BearingCount = k;
+    report.EmbeddedBytes = sizeof(NodeVector) + k * sizeof(BearingVector);
+    report.NormalizedBytes = sizeof(NodeHandle) + sizeof(NodeVector) + k * sizeof(BearingVectorRef);
+    return report;
+}
+
+// Bearing rotations
+const BearingRotationSet& Vertex::ReadBearingRotations() const {
+    if (!_bearingRotationsValid) {
+        _bearingRotations->Clear();
+        for (std::size_t i = 0; i < BearingCount(); ++i) {
+            _bearingRotations->PushBack(ReadBearingDirection(i));
+        }
+        _bearingRotationsValid = true;
+    }
+    return *_bearingRotations;
+}
+
+// JSON Serialization
+json Vertex::toJson() const {
+    json bearings = json::array();
+    for (std::size_t i = 0; i < BearingCount(); ++i) {
+        bearings.push_back(ReadBearingVector(i).toJson());
+    }
+    return {
+        {"index", index},
+        {"node", ReadNodeVector().toJson()},
+        {"bearings", bearings}
+    };
+}
+
+Vertex Vertex::fromJson(const json& j) {
+    return fromJson(j, nullptr);
+}
+
+Vertex Vertex::fromJson(const json& j, std::shared_ptr<NodeTable> nodeTable) {
+    Vertex vertex(std::move(nodeTable));
+    vertex.UpdateNodeVector(NodeVector::fromJson(j.at("node")));
+    for (const auto& bearing : j.at("bearings")) {
+        vertex.PostBearingVector(BearingVector::fromJson(bearing));
     }
+    return vertex;
 }
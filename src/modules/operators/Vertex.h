@@ -3,7 +3,9 @@
 #define VERTEX_H
 
 #include <vector>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <ostream>
 
 // Json
@@ -16,6 +18,34 @@ using json = nlohmann::json;
 #include "Vector3.h"
 #include "NodeVector.h"
 #include "BearingVector.h"
+#include "NodeTable.h"
+#include "BearingRotation.h"
+
+/**
+ * @brief How a Vertex stores its node and bearings
+ *
+ * Embedded:   own NodeVector plus BearingVectors that each embed a node copy (node stored k + 1 times)
+ * Normalized: node lives in a shared NodeTable; bearings are BearingVectorRefs holding a NodeHandle
+ */
+enum class BearingStorage
+{
+    Embedded,
+    Normalized
+};
+
+/**
+ * @brief Per-vertex payload bytes of both storages for the current bearing count
+ *
+ * Container headers and allocator overhead are identical for both and left out.
+ */
+struct VertexMemoryReport
+{
+    std::size_t BearingCount;
+    std::size_t EmbeddedBytes;   // NodeVector + k * BearingVector
+    std::size_t NormalizedBytes; // NodeHandle + one NodeTable entry + k * BearingVectorRef
+
+    std::size_t BytesSaved() const { return EmbeddedBytes - NormalizedBytes; }
+};
 
 /**
  * @brief Vertex class
@@ -27,6 +57,23 @@ private:
     std::unique_ptr<NodeVector> _node; // Essential Component
     std::unique_ptr<std::vector<BearingVector>> _bearingVectorList;
 
+    // Normalized storage (null table in Embedded mode)
+    std::shared_ptr<NodeTable> _nodeTable;
+    NodeHandle _nodeHandle;
+    std::unique_ptr<std::vector<BearingVectorRef>> _bearingRefList;
+
+    // EditEpoch stamp of the last mutator (see GetVersion)
+    uint64_t _version;
+
+    // Normalized storage: _bearingVectorList holds _bearingRefList resolved at this GetVersion();
+    // the mutex (boxed so Vertex stays movable) serializes the rebuild between concurrent readers
+    mutable uint64_t _bearingListVersion;
+    mutable std::unique_ptr<std::mutex> _bearingListMutex;
+
+    // Rotation cache for _bearingVectorList; built on first read, then kept in step with bearing edits
+    mutable std::unique_ptr<BearingRotationSet> _bearingRotations;
+    mutable bool _bearingRotationsValid;
+
     // NodeVector
     void CreateNodeVector(const NodeVector& node);
     void DeleteNodeVector();
@@ -42,12 +89,20 @@ private:
     FRIEND_TEST(VertexTest, UpdateAndDeleteBearingVectors);
     FRIEND_TEST(VertexTest, BearingVectorListLifecycle);
     FRIEND_TEST(VertexTest, DeleteNodeVector);
+    FRIEND_TEST(VertexTest, BearingRotationCacheFollowsEdits);
+    FRIEND_TEST(VertexTest, NormalizedStorageSharesNodes);
+    FRIEND_TEST(VertexTest, VersionBumpsOnEdits);
+    FRIEND_TEST(VertexTest, NormalizedListRebuildsOnlyAfterEdits);
 
 public:
     // Constructors and Destructors
     Vertex();
+    explicit Vertex(std::shared_ptr<NodeTable> nodeTable); // Normalized storage
     ~Vertex();
 
+    Vertex(Vertex&& other) noexcept;
+    Vertex& operator=(Vertex&& other) noexcept;
+
     // NodeVector Methods
     void UpdateNodeVector(const NodeVector& node);
 
@@ -59,13 +114,41 @@ public:
     // Getter for index
     int GetIndex() const { return index; }
 
+    /**
+     * @brief Monotonic stamp that changes whenever the node or a bearing changes
+     *
+     * Normalized storage also takes the NodeTable revisions of this vertex's node and bearing
+     * nodes, so an edit to one of those made through another vertex changes this stamp while
+     * edits to unrelated nodes of the same table do not. Writing an unchanged node keeps it.
+     */
+    uint64_t GetVersion() const;
+
+    // Storage
+    BearingStorage GetBearingStorage() const { return _nodeTable ? BearingStorage::Normalized : BearingStorage::Embedded; }
+    const std::shared_ptr<NodeTable>& GetNodeTable() const { return _nodeTable; }
+    VertexMemoryReport ReportMemory() const;
+
     // Getter Methods
-    const NodeVector& ReadNodeVector() const { return *(_node); }
-    const std::vector<BearingVector>& ReadBearingVectorList() const { return *(_bearingVectorList); }
+    const NodeVector& ReadNodeVector() const;
+
+    // Normalized storage resolves the list again after each edit (to this vertex or its NodeTable);
+    // the reference stays valid until then. Prefer the per-bearing accessors there
+    const std::vector<BearingVector>& ReadBearingVectorList() const;
+
+    // Per-bearing accessors (no copies in either storage)
+    std::size_t BearingCount() const;
+    const Vector3& ReadBearingForce(std::size_t i) const;
+    const Vector3& ReadBearingDirection(std::size_t i) const;
+    const NodeVector& ReadBearingNode(std::size_t i) const;
+    BearingVector ReadBearingVector(std::size_t i) const;
+
+    // Cached R_i for every bearing (BearingRotation.h); not thread-safe on first read
+    const BearingRotationSet& ReadBearingRotations() const;
 
-    // JSON Serialization
+    // JSON Serialization; both storages produce the same document
     json toJson() const;
     static Vertex fromJson(const json& j);
+    static Vertex fromJson(const json& j, std::shared_ptr<NodeTable> nodeTable);
     
     // Output Operator Overload Declaration
     friend std::ostream& operator<<(std::ostream& os, const Vertex& vertex);
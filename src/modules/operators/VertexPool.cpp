@@ -0,0 +1,192 @@
+/**
+ * VertexPool.cpp
+ * Linked file: VertexPool.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ */
+
+#include "VertexPool.h"
+#include "BinaryCodec.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    // Placeholder for unused arena slots
+    const BearingVectorRef kEmptySlot(kInvalidNodeHandle, Vector3(), Vector3());
+
+    uint32_t CheckedU32(std::size_t value)
+    {
+        if (value > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("VertexPool: exceeds 32-bit arena limit");
+        return static_cast<uint32_t>(value);
+    }
+}
+
+void VertexPool::Reserve(std::size_t vertices, std::size_t bearings)
+{
+    _vertexNodes.reserve(vertices);
+    _spans.reserve(vertices);
+    _arena.reserve(bearings);
+}
+
+VertexId VertexPool::Create(const NodeVector& node, std::size_t bearingCapacity)
+{
+    VertexId id = CheckedU32(_vertexNodes.size());
+    NodeHandle handle = _nodes.Intern(node);
+    _nodes.Update(handle, node);
+    _vertexNodes.push_back(handle);
+
+    uint32_t capacity = CheckedU32(bearingCapacity);
+    _spans.push_back(Span{capacity ? Allocate(capacity) : 0, 0, capacity});
+    return id;
+}
+
+void VertexPool::Clear()
+{
+    _nodes.Clear();
+    _vertexNodes.clear();
+    _spans.clear();
+    _arena.clear();
+    _liveBearings = 0;
+}
+
+// NodeVector Methods
+void VertexPool::UpdateNodeVector(VertexId id, const NodeVector& node)
+{
+    NodeHandle& handle = _vertexNodes[id];
+    // As in Vertex: a new Index rebinds to that node
+    if (_nodes.Get(handle).Index != node.Index)
+        handle = _nodes.Intern(node);
+    _nodes.Update(handle, node);
+}
+
+// BearingVector Methods
+void VertexPool::PostBearingVector(VertexId id, const BearingVector& bearing)
+{
+    if (_spans[id].Length == _spans[id].Capacity)
+        Grow(id);
+    Span& span = _spans[id];
+    _arena[span.Offset + span.Length] = BearingVectorRef::FromBearing(bearing, _nodes);
+    ++span.Length;
+    ++_liveBearings;
+}
+
+void VertexPool::PutBearingVector(VertexId id, const BearingVector& bearing)
+{
+    const Span& span = _spans[id];
+    if (span.Length != 0)
+        _arena[span.Offset + span.Length - 1] = BearingVectorRef::FromBearing(bearing, _nodes);
+}
+
+void VertexPool::DeleteBearingVector(VertexId id)
+{
+    Span& span = _spans[id];
+    if (span.Length != 0)
+    {
+        --span.Length;
+        --_liveBearings;
+    }
+}
+
+BearingSpan VertexPool::ReadBearings(VertexId id) const
+{
+    const Span& span = _spans[id];
+    return BearingSpan{_arena.data() + span.Offset, span.Length};
+}
+
+// Conversion to and from Vertex objects
+VertexId VertexPool::Import(const Vertex& vertex)
+{
+    const std::size_t count = vertex.BearingCount();
+    VertexId id = Create(vertex.ReadNodeVector(), count);
+    for (std::size_t i = 0; i < count; ++i)
+        PostBearingVector(id, vertex.ReadBearingVector(i));
+    return id;
+}
+
+void VertexPool::Export(VertexId id, Vertex& vertex) const
+{
+    vertex.UpdateNodeVector(ReadNodeVector(id));
+    while (vertex.BearingCount() != 0)
+        vertex.DeleteBearingVector();
+    for (const BearingVectorRef& ref : ReadBearings(id))
+        vertex.PostBearingVector(ref.Resolve(_nodes));
+}
+
+VertexId VertexPool::Load(const BinaryView& view)
+{
+    if (view.Type() != BinaryRecordType::Vertex)
+        throw std::runtime_error("VertexPool: block does not hold Vertex records");
+
+    const VertexId first = CheckedU32(Size());
+    Reserve(Size() + view.Count(), _arena.size() + view.BearingCount());
+
+    // Block node slot -> pool handle
+    std::vector<NodeHandle> handles(view.NodeCount());
+    for (std::size_t slot = 0; slot < view.NodeCount(); ++slot)
+    {
+        NodeVector node = view.Node(slot);
+        handles[slot] = _nodes.Intern(node);
+        _nodes.Update(handles[slot], node);
+    }
+
+    for (std::size_t i = 0; i < view.Count(); ++i)
+    {
+        const std::size_t count = view.VertexBearingCount(i);
+        const uint32_t offset = CheckedU32(_arena.size());
+        const std::size_t firstBearing = view.VertexFirstBearing(i);
+        for (std::size_t b = firstBearing; b < firstBearing + count; ++b)
+            _arena.emplace_back(handles[view.BearingNodeSlot(b)], view.BearingForce(b), view.BearingDirection(b));
+
+        _vertexNodes.push_back(handles[view.VertexNodeSlot(i)]);
+        _spans.push_back(Span{offset, CheckedU32(count), CheckedU32(count)});
+        _liveBearings += count;
+    }
+    return first;
+}
+
+// Arena maintenance
+uint32_t VertexPool::Allocate(uint32_t capacity)
+{
+    const uint32_t offset = CheckedU32(_arena.size());
+    CheckedU32(_arena.size() + capacity);
+    _arena.insert(_arena.end(), capacity, kEmptySlot);
+    return offset;
+}
+
+void VertexPool::Grow(VertexId id)
+{
+    Span& span = _spans[id];
+    const uint32_t capacity = span.Capacity < kMinSpanCapacity ? kMinSpanCapacity : span.Capacity * 2;
+
+    // The last span of the arena can grow in place
+    if (span.Capacity != 0 && span.Offset + span.Capacity == _arena.size())
+    {
+        Allocate(capacity - span.Capacity);
+        span.Capacity = capacity;
+        return;
+    }
+
+    const uint32_t offset = Allocate(capacity);
+    std::copy(_arena.begin() + span.Offset, _arena.begin() + span.Offset + span.Length, _arena.begin() + offset);
+    span.Offset = offset;
+    span.Capacity = capacity;
+}
+
+void VertexPool::Compact()
+{
+    std::vector<BearingVectorRef> packed;
+    packed.reserve(_liveBearings);
+    for (Span& span : _spans)
+    {
+        const uint32_t offset = CheckedU32(packed.size());
+        packed.insert(packed.end(), _arena.begin() + span.Offset, _arena.begin() + span.Offset + span.Length);
+        span.Offset = offset;
+        span.Capacity = span.Length;
+    }
+    _arena.swap(packed);
+}
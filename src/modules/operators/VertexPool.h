@@ -0,0 +1,114 @@
+/**
+ * VertexPool.h
+ * Linked file: VertexPool.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Arena storage for large vertex sets
+ *
+ * A Vertex makes three heap allocations (node, bearing list, list buffer). VertexPool instead
+ * keeps every node in one NodeTable and every bearing in one arena of BearingVectorRef; a vertex
+ * is a VertexId owning an offset / length / capacity span of that arena. Bearing edits follow
+ * Vertex::PostBearingVector / PutBearingVector / DeleteBearingVector. A span that outgrows its
+ * capacity moves to the end of the arena; Compact() packs the arena again.
+ */
+
+#ifndef VERTEXPOOL_H
+#define VERTEXPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "NodeVector.h"
+#include "NodeTable.h"
+#include "BearingVector.h"
+#include "Vertex.h"
+
+class BinaryView;
+
+using VertexId = uint32_t;
+
+/**
+ * @brief Read-only view of one vertex's bearings inside the arena
+ * @note Invalidated by any bearing edit or Compact()
+ */
+struct BearingSpan
+{
+    const BearingVectorRef* Data;
+    std::size_t Size;
+
+    const BearingVectorRef* begin() const { return Data; }
+    const BearingVectorRef* end() const { return Data + Size; }
+    const BearingVectorRef& operator[](std::size_t i) const { return Data[i]; }
+    bool Empty() const { return Size == 0; }
+};
+
+class VertexPool
+{
+public:
+    VertexPool() = default;
+
+    void Reserve(std::size_t vertices, std::size_t bearings);
+
+    // Vertices
+    VertexId Create(const NodeVector& node, std::size_t bearingCapacity = 0);
+    std::size_t Size() const { return _vertexNodes.size(); }
+    void Clear();
+
+    // NodeVector Methods
+    void UpdateNodeVector(VertexId id, const NodeVector& node);
+    const NodeVector& ReadNodeVector(VertexId id) const { return _nodes.Get(_vertexNodes[id]); }
+
+    // BearingVector Methods (same semantics as Vertex)
+    void PostBearingVector(VertexId id, const BearingVector& bearing);
+    void PutBearingVector(VertexId id, const BearingVector& bearing);
+    void DeleteBearingVector(VertexId id);
+
+    // Per-bearing accessors (same names as Vertex)
+    std::size_t BearingCount(VertexId id) const { return _spans[id].Length; }
+    BearingSpan ReadBearings(VertexId id) const;
+    const Vector3& ReadBearingForce(VertexId id, std::size_t i) const { return _arena[_spans[id].Offset + i].Force; }
+    const Vector3& ReadBearingDirection(VertexId id, std::size_t i) const { return _arena[_spans[id].Offset + i].Vector; }
+    const NodeVector& ReadBearingNode(VertexId id, std::size_t i) const { return _nodes.Get(_arena[_spans[id].Offset + i].Node); }
+    BearingVector ReadBearingVector(VertexId id, std::size_t i) const { return _arena[_spans[id].Offset + i].Resolve(_nodes); }
+
+    // Conversion to and from Vertex objects
+    VertexId Import(const Vertex& vertex);
+    void Export(VertexId id, Vertex& vertex) const;
+
+    /**
+     * @brief Bulk-load every record of a BinaryCodec Vertex block
+     * @return Id of the first loaded vertex; ids are consecutive
+     */
+    VertexId Load(const BinaryView& view);
+
+    // Arena maintenance
+    void Compact();
+    std::size_t ArenaSize() const { return _arena.size(); }
+    std::size_t LiveBearings() const { return _liveBearings; }
+
+    const NodeTable& Nodes() const { return _nodes; }
+
+private:
+    struct Span
+    {
+        uint32_t Offset;
+        uint32_t Length;
+        uint32_t Capacity;
+    };
+
+    static constexpr uint32_t kMinSpanCapacity = 4;
+
+    NodeTable _nodes;
+    std::vector<NodeHandle> _vertexNodes; // by VertexId
+    std::vector<Span> _spans;             // by VertexId
+    std::vector<BearingVectorRef> _arena;
+    std::size_t _liveBearings = 0;
+
+    uint32_t Allocate(uint32_t capacity);
+    void Grow(VertexId id);
+};
+
+#endif // VERTEXPOOL_H
@@ -0,0 +1,115 @@
+// AABB.cpp
+
+#include "AABB.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+AABB::AABB()
+    : Min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+      Max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max())
+{
+}
+
+// Box of the control polygon (Equ. 1)
+AABB AABB::FromPoints(const Vector3* points, std::size_t count)
+{
+    AABB box;
+    for (std::size_t i = 0; i < count; ++i)
+        box.Expand(points[i]);
+    return box;
+}
+
+void AABB::Expand(const Vector3& point)
+{
+    Min = Vector3(std::min(Min.x, point.x), std::min(Min.y, point.y), std::min(Min.z, point.z));
+    Max = Vector3(std::max(Max.x, point.x), std::max(Max.y, point.y), std::max(Max.z, point.z));
+}
+
+void AABB::Expand(const AABB& box)
+{
+    if (box.IsEmpty())
+        return;
+    Expand(box.Min);
+    Expand(box.Max);
+}
+
+float AABB::SurfaceArea() const
+{
+    if (IsEmpty())
+        return 0.0f;
+    Vector3 e = Extent();
+    return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+}
+
+bool AABB::Contains(const Vector3& point) const
+{
+    return point.x >= Min.x && point.x <= Max.x &&
+           point.y >= Min.y && point.y <= Max.y &&
+           point.z >= Min.z && point.z <= Max.z;
+}
+
+bool AABB::Intersects(const AABB& box) const
+{
+    return Min.x <= box.Max.x && box.Min.x <= Max.x &&
+           Min.y <= box.Max.y && box.Min.y <= Max.y &&
+           Min.z <= box.Max.z && box.Min.z <= Max.z;
+}
+
+// Equ. 3
+float AABB::DistanceSquared(const Vector3& point) const
+{
+    float dx = std::max(std::max(Min.x - point.x, 0.0f), point.x - Max.x);
+    float dy = std::max(std::max(Min.y - point.y, 0.0f), point.y - Max.y);
+    float dz = std::max(std::max(Min.z - point.z, 0.0f), point.z - Max.z);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+float AABB::DistanceSquared(const AABB& box) const
+{
+    float dx = std::max(std::max(Min.x - box.Max.x, 0.0f), box.Min.x - Max.x);
+    float dy = std::max(std::max(Min.y - box.Max.y, 0.0f), box.Min.y - Max.y);
+    float dz = std::max(std::max(Min.z - box.Max.z, 0.0f), box.Min.z - Max.z);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+bool AABB::IntersectsSphere(const Vector3& center, float radius) const
+{
+    return !IsEmpty() && DistanceSquared(center) <= radius * radius;
+}
+
+// Equ. 2
+bool AABB::IntersectsRay(const Vector3& origin, const Vector3& inverseDirection, float maxT, float* entry) const
+{
+    if (IsEmpty())
+        return false;
+
+    float tMin = 0.0f;
+    float tMax = maxT;
+    const float o[3] = {origin.x, origin.y, origin.z};
+    const float inv[3] = {inverseDirection.x, inverseDirection.y, inverseDirection.z};
+    const float lo[3] = {Min.x, Min.y, Min.z};
+    const float hi[3] = {Max.x, Max.y, Max.z};
+    for (int k = 0; k < 3; ++k)
+    {
+        if (std::isinf(inv[k]))
+        {
+            // Parallel to the slab: inside it or never
+            if (o[k] < lo[k] || o[k] > hi[k])
+                return false;
+            continue;
+        }
+        float t0 = (lo[k] - o[k]) * inv[k];
+        float t1 = (hi[k] - o[k]) * inv[k];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax)
+            return false;
+    }
+    if (entry)
+        *entry = tMin;
+    return true;
+}
@@ -0,0 +1,69 @@
+/**
+ * AABB.h
+ * Linked file: AABB.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Axis-aligned bounding box for segment culling and spatial queries
+ *
+ * Equations
+ * Equ(1): \vec{B}\left(t\right)\in\mathrm{conv}\{\vec{P_0},\dots,\vec{P_n}\}\subseteq\left[\min_i\vec{P_i},\max_i\vec{P_i}\right],\emsp0\le t\le1
+ * Equ(2): t_{\mathrm{entry}}=\max_k\min\left(\frac{m_k-o_k}{d_k},\frac{M_k-o_k}{d_k}\right),\emsp t_{\mathrm{exit}}=\min_k\max\left(\frac{m_k-o_k}{d_k},\frac{M_k-o_k}{d_k}\right)
+ * Equ(3): \mathrm{dist}^2\left(\vec{c},\mathrm{box}\right)=\sum_k\max\left(m_k-c_k,0,c_k-M_k\right)^2
+ */
+
+#ifndef AABB_H
+#define AABB_H
+
+#include <cstddef>
+#include <vector>
+
+#include "Vector3.h"
+
+/**
+ * @brief Axis-aligned box [Min, Max]
+ *
+ * A default-constructed box is empty (Min > Max) and absorbs the first point or box it is
+ * expanded by. A Bezier or B-spline lies inside the box of its control points (Equ. 1), so
+ * FromPoints over the control polygon is a conservative bound of the curve.
+ */
+struct AABB
+{
+    Vector3 Min;
+    Vector3 Max;
+
+    AABB();
+    AABB(const Vector3& min, const Vector3& max) : Min(min), Max(max) {}
+
+    static AABB FromPoints(const Vector3* points, std::size_t count);
+    static AABB FromPoints(const std::vector<Vector3>& points) { return FromPoints(points.data(), points.size()); }
+
+    bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z; }
+
+    void Expand(const Vector3& point);
+    void Expand(const AABB& box);
+
+    Vector3 Center() const { return (Min + Max) * 0.5f; }
+    Vector3 Extent() const { return Max - Min; }
+    float SurfaceArea() const;
+
+    bool Contains(const Vector3& point) const;
+    bool Intersects(const AABB& box) const;
+
+    // Squared distance from point to the box, 0 inside (Equ. 3)
+    float DistanceSquared(const Vector3& point) const;
+    // Squared gap between two boxes, 0 when they overlap
+    float DistanceSquared(const AABB& box) const;
+    bool IntersectsSphere(const Vector3& center, float radius) const;
+
+    /**
+     * @brief Slab test (Equ. 2) for origin + t * direction, t in [0, maxT]
+     *
+     * inverseDirection is 1 / direction per axis (inf for zero components). entry receives the
+     * first t inside the box (0 when the origin is inside).
+     */
+    bool IntersectsRay(const Vector3& origin, const Vector3& inverseDirection, float maxT, float* entry = nullptr) const;
+};
+
+#endif // AABB_H
@@ -0,0 +1,201 @@
+// AdaptiveTessellator.cpp
+
+#include "AdaptiveTessellator.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+namespace
+{
+    struct Interval
+    {
+        float t0, t1;
+        Vector3 p0, p1;
+        float error;
+        int left, right; // Children after a split, -1 for leaves
+    };
+
+    // Bezier curve sampled through a chosen evaluator back end; derivatives use the cached hodographs
+    class EvaluatorCurve : public ParametricCurve
+    {
+    public:
+        EvaluatorCurve(const CurveDerivatives& derivatives, const BezierEvaluator& evaluator)
+            : _derivatives(derivatives), _evaluator(evaluator)
+        {
+        }
+
+        Vector3 Point(float t) const override { return _evaluator.Evaluate(_derivatives.ControlPoints(), t); }
+        Vector3 FirstDerivative(float t) const override { return Evaluate(_derivatives.First(), t); }
+        Vector3 SecondDerivative(float t) const override { return Evaluate(_derivatives.Second(), t); }
+
+    private:
+        Vector3 Evaluate(const std::vector<Vector3>& points, float t) const
+        {
+            return points.empty() ? Vector3() : _evaluator.Evaluate(points, t);
+        }
+
+        const CurveDerivatives& _derivatives;
+        const BezierEvaluator& _evaluator;
+    };
+
+    class IntervalError
+    {
+    public:
+        IntervalError(const ParametricCurve& curve, const AdaptiveTessellationOptions& options)
+            : _curve(curve), _options(options)
+        {
+        }
+
+        float operator()(const Interval& interval) const
+        {
+            float h = interval.t1 - interval.t0;
+            float tm = interval.t0 + 0.5f * h;
+            if (_options.criterion == AdaptiveCriterion::Curvature)
+            {
+                // Equ. 3
+                Vector3 d1 = _curve.FirstDerivative(tm);
+                Vector3 d2 = _curve.SecondDerivative(tm);
+                float speed = d1.magnitude();
+                float chord = (interval.p1 - interval.p0).magnitude();
+                if (speed == 0.0f)
+                    return chord;
+                float kappa = d2.cross(d1).magnitude() / (speed * speed * speed);
+                return kappa * chord * chord * 0.125f;
+            }
+
+            // Equ. 1
+            float error = 0.0f;
+            for (float s : {0.25f, 0.5f, 0.75f})
+            {
+                Vector3 p = _curve.Point(interval.t0 + s * h);
+                error = std::max(error, AdaptiveTessellator::DistanceToChord(p, interval.p0, interval.p1));
+            }
+            return error;
+        }
+
+    private:
+        const ParametricCurve& _curve;
+        const AdaptiveTessellationOptions& _options;
+    };
+}
+
+float AdaptiveTessellator::DistanceToChord(const Vector3& p, const Vector3& a, const Vector3& b)
+{
+    Vector3 ab = b - a;
+    float lengthSq = ab.dot(ab);
+    if (lengthSq == 0.0f)
+        return p.distance(a);
+    float s = std::min(1.0f, std::max(0.0f, (p - a).dot(ab) / lengthSq));
+    return p.distance(a + ab * s);
+}
+
+void AdaptiveTessellator::Tessellate(const std::vector<Vector3>& controlPoints,
+                                     const AdaptiveTessellationOptions& options,
+                                     const BezierEvaluator& evaluator,
+                                     std::vector<Vector3>& points,
+                                     std::vector<float>& params)
+{
+    Tessellate(CurveDerivatives(controlPoints), options, evaluator, points, params);
+}
+
+void AdaptiveTessellator::Tessellate(const CurveDerivatives& derivatives,
+                                     const AdaptiveTessellationOptions& options,
+                                     const BezierEvaluator& evaluator,
+                                     std::vector<Vector3>& points,
+                                     std::vector<float>& params)
+{
+    points.clear();
+    params.clear();
+    if (derivatives.ControlPoints().empty())
+        return;
+
+    EvaluatorCurve curve(derivatives, evaluator);
+    Tessellate(curve, options, points, params);
+}
+
+void AdaptiveTessellator::Tessellate(const ParametricCurve& curve,
+                                     const AdaptiveTessellationOptions& options,
+                                     std::vector<Vector3>& points,
+                                     std::vector<float>& params)
+{
+    points.clear();
+    params.clear();
+
+    int maxPoints = std::max(2, options.maxPoints);
+    int initial = std::max(1, std::min(options.minSegments, maxPoints - 1));
+    IntervalError measure(curve, options);
+
+    // Initial uniform split
+    std::vector<Interval> intervals;
+    intervals.reserve(static_cast<std::size_t>(maxPoints) * 2);
+    Vector3 previous = curve.Point(0.0f);
+    for (int i = 0; i < initial; ++i)
+    {
+        float t0 = static_cast<float>(i) / initial;
+        float t1 = (i + 1 == initial) ? 1.0f : static_cast<float>(i + 1) / initial;
+        Vector3 next = curve.Point(t1);
+        Interval interval{t0, t1, previous, next, 0.0f, -1, -1};
+        interval.error = measure(interval);
+        intervals.push_back(interval);
+        previous = next;
+    }
+
+    // Worst-first refinement until every leaf is within tolerance or the budget is spent
+    using Entry = std::pair<float, int>;
+    std::priority_queue<Entry> queue;
+    for (int i = 0; i < initial; ++i)
+        queue.emplace(intervals[i].error, i);
+
+    int leaves = initial;
+    while (!queue.empty() && leaves + 1 < maxPoints)
+    {
+        Entry worst = queue.top();
+        if (worst.first <= options.tolerance)
+            break;
+        queue.pop();
+
+        Interval parent = intervals[worst.second];
+        float tm = 0.5f * (parent.t0 + parent.t1);
+        if (tm <= parent.t0 || tm >= parent.t1)
+            continue; // float resolution reached
+
+        Vector3 pm = curve.Point(tm);
+        Interval left{parent.t0, tm, parent.p0, pm, 0.0f, -1, -1};
+        Interval right{tm, parent.t1, pm, parent.p1, 0.0f, -1, -1};
+        left.error = measure(left);
+        right.error = measure(right);
+
+        int leftIndex = static_cast<int>(intervals.size());
+        intervals.push_back(left);
+        intervals.push_back(right);
+        intervals[worst.second].left = leftIndex;
+        intervals[worst.second].right = leftIndex + 1;
+        queue.emplace(left.error, leftIndex);
+        queue.emplace(right.error, leftIndex + 1);
+        ++leaves;
+    }
+
+    // Emit the leaves in t order with an explicit stack (children are pushed right first)
+    points.reserve(leaves + 1);
+    params.reserve(leaves + 1);
+    points.push_back(intervals[0].p0);
+    params.push_back(0.0f);
+    std::vector<int> stack;
+    for (int i = initial - 1; i >= 0; --i)
+        stack.push_back(i);
+    while (!stack.empty())
+    {
+        int index = stack.back();
+        stack.pop_back();
+        const Interval& interval = intervals[index];
+        if (interval.left >= 0)
+        {
+            stack.push_back(interval.right);
+            stack.push_back(interval.left);
+            continue;
+        }
+        points.push_back(interval.p1);
+        params.push_back(interval.t1);
+    }
+}
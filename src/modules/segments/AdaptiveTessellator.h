@@ -0,0 +1,96 @@
+/**
+ * AdaptiveTessellator.h
+ * Linked file: AdaptiveTessellator.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Shape-aware sampling of a Bezier curve by recursive interval subdivision
+ *
+ * Equations
+ * Equ(1): \delta\left(t_a,t_b\right)=\max_{s\in\{\frac14,\frac12,\frac34\}}\mathrm{dist}\left(\vec{B}\left(t_a+s\left(t_b-t_a\right)\right),\overline{\vec{B}\left(t_a\right)\vec{B}\left(t_b\right)}\right)
+ * Equ(2): \kappa\left(t\right)=\frac{|\vec{B^{\prime\prime}}\left(t\right)\times\vec{B^\prime}\left(t\right)|}{|\vec{B^\prime}\left(t\right)|^3}
+ * Equ(3): \delta_\kappa\left(t_a,t_b\right)=\frac{\kappa\left(t_m\right)\,|\vec{B}\left(t_b\right)-\vec{B}\left(t_a\right)|^2}{8},\emsp t_m=\frac{t_a+t_b}{2}
+ * Derivatives for Equ. 2 come from the CurveDerivatives hodographs.
+ */
+
+#ifndef ADAPTIVETESSELLATOR_H
+#define ADAPTIVETESSELLATOR_H
+
+#include <vector>
+
+#include "Vector3.h"
+#include "BezierEvaluator.h"
+#include "ParametricCurve.h"
+#include "CurveDerivatives.h"
+
+/**
+ * @brief Sampling strategy of a LinearSegment
+ */
+enum class TessellationMode
+{
+    Uniform,  // numSegments equal steps in t
+    Adaptive  // AdaptiveTessellator; dense where the curve bends, sparse where it is straight
+};
+
+/**
+ * @brief Error estimate used to decide whether an interval is split
+ */
+enum class AdaptiveCriterion
+{
+    ChordDeviation, // Equ. 1; measured distance from the chord, catches inflections
+    Curvature       // Equ. 3; sagitta predicted from the Equ. 2 curvature at the midpoint
+};
+
+/**
+ * @brief Tolerances and budget for adaptive sampling
+ *
+ * maxPoints is a hard cap on the output size (including both end points). Intervals are split
+ * worst-first, so a budget that runs out leaves the error spread as evenly as possible.
+ */
+struct AdaptiveTessellationOptions
+{
+    AdaptiveCriterion criterion = AdaptiveCriterion::ChordDeviation;
+    float tolerance = 1e-2f;  // Maximum allowed deviation in world units
+    int minSegments = 4;      // Initial uniform split; guards against S-curves that look straight
+    int maxPoints = 1024;     // Hard point budget, at least 2
+};
+
+/**
+ * @brief Adaptive curve tessellator
+ *
+ * Stateless; works on any ParametricCurve. The Bezier overload samples through any
+ * BezierEvaluator back end that supports single evaluations.
+ */
+class AdaptiveTessellator
+{
+public:
+    /**
+     * @brief Sample controlPoints adaptively
+     *
+     * points and params are overwritten; params[i] is the curve parameter of points[i] and is
+     * strictly increasing from 0 to 1.
+     */
+    static void Tessellate(const std::vector<Vector3>& controlPoints,
+                           const AdaptiveTessellationOptions& options,
+                           const BezierEvaluator& evaluator,
+                           std::vector<Vector3>& points,
+                           std::vector<float>& params);
+
+    // Same, for a curve whose hodographs are already cached (e.g. a LinearSegment snapshot)
+    static void Tessellate(const CurveDerivatives& derivatives,
+                           const AdaptiveTessellationOptions& options,
+                           const BezierEvaluator& evaluator,
+                           std::vector<Vector3>& points,
+                           std::vector<float>& params);
+
+    static void Tessellate(const ParametricCurve& curve,
+                           const AdaptiveTessellationOptions& options,
+                           std::vector<Vector3>& points,
+                           std::vector<float>& params);
+
+    // Distance from p to the segment [a, b]
+    static float DistanceToChord(const Vector3& p, const Vector3& a, const Vector3& b);
+};
+
+#endif // ADAPTIVETESSELLATOR_H
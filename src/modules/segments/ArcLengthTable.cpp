@@ -0,0 +1,180 @@
+// ArcLengthTable.cpp
+
+#include "ArcLengthTable.h"
+#include "CurveDerivatives.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    // 5-point Gauss-Legendre nodes and weights on [-1, 1] (Equ. 3)
+    constexpr double kNodes[5] = {0.0, -0.5384693101056831, 0.5384693101056831, -0.9061798459386640, 0.9061798459386640};
+    constexpr double kWeights[5] = {0.5688888888888889, 0.4786286704993665, 0.4786286704993665, 0.2369268850561891, 0.2369268850561891};
+}
+
+ArcLengthTable::ArcLengthTable(const std::vector<Vector3>& controlPoints, int intervals)
+{
+    Build(controlPoints, intervals);
+}
+
+ArcLengthTable::ArcLengthTable(std::shared_ptr<const ParametricCurve> curve, int intervals)
+{
+    Build(std::move(curve), intervals);
+}
+
+void ArcLengthTable::Build(const std::vector<Vector3>& controlPoints, int intervals)
+{
+    if (controlPoints.empty())
+    {
+        _curve.reset();
+        _lengths.clear();
+        return;
+    }
+    Build(std::make_shared<CurveDerivatives>(controlPoints), intervals);
+}
+
+void ArcLengthTable::Build(std::shared_ptr<const ParametricCurve> curve, int intervals)
+{
+    _curve = std::move(curve);
+    _lengths.clear();
+    if (!_curve)
+        return;
+
+    intervals = std::max(1, intervals);
+    _lengths.resize(intervals + 1);
+    _lengths[0] = 0.0;
+    for (int i = 0; i < intervals; ++i)
+    {
+        double a = static_cast<double>(i) / intervals;
+        double b = static_cast<double>(i + 1) / intervals;
+        _lengths[i + 1] = _lengths[i] + Integrate(a, b);
+    }
+}
+
+double ArcLengthTable::Speed(double t) const
+{
+    return _curve ? Vector3d(_curve->FirstDerivative(static_cast<float>(t))).magnitude() : 0.0;
+}
+
+double ArcLengthTable::Integrate(double a, double b) const
+{
+    double half = 0.5 * (b - a);
+    double mid = 0.5 * (a + b);
+    double sum = 0.0;
+    for (int k = 0; k < 5; ++k)
+        sum += kWeights[k] * Speed(half * kNodes[k] + mid);
+    return sum * half;
+}
+
+float ArcLengthTable::SpeedAt(float t) const
+{
+    return static_cast<float>(Speed(t));
+}
+
+Vector3 ArcLengthTable::PointAt(float t) const
+{
+    return _curve ? _curve->Point(t) : Vector3();
+}
+
+float ArcLengthTable::LengthAt(float t) const
+{
+    if (_lengths.empty())
+        return 0.0f;
+    int intervals = Intervals();
+    double clamped = std::min(1.0, std::max(0.0, static_cast<double>(t)));
+    int i = std::min(intervals - 1, static_cast<int>(clamped * intervals));
+    double a = static_cast<double>(i) / intervals;
+    return static_cast<float>(_lengths[i] + Integrate(a, clamped));
+}
+
+float ArcLengthTable::ParameterAt(float s) const
+{
+    if (_lengths.empty() || _lengths.back() <= 0.0)
+        return 0.0f;
+    if (s <= 0.0f)
+        return 0.0f;
+    if (s >= _lengths.back())
+        return 1.0f;
+
+    // Knot interval containing s
+    auto it = std::upper_bound(_lengths.begin(), _lengths.end(), static_cast<double>(s));
+    int i = static_cast<int>(it - _lengths.begin()) - 1;
+    int intervals = Intervals();
+    double lo = static_cast<double>(i) / intervals;
+    double hi = static_cast<double>(i + 1) / intervals;
+    double target = s - _lengths[i];
+    double span = _lengths[i + 1] - _lengths[i];
+
+    // Linear initial guess, then bracketed Newton (Equ. 4)
+    double t = span > 0.0 ? lo + (hi - lo) * (target / span) : lo;
+    double left = lo, right = hi;
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        double f = Integrate(lo, t) - target;
+        if (std::abs(f) < 1e-9 * std::max(1.0, _lengths.back()))
+            break;
+        if (f > 0.0) right = t; else left = t;
+        double speed = Speed(t);
+        double next = speed > 0.0 ? t - f / speed : 0.5 * (left + right);
+        if (next <= left || next >= right)
+            next = 0.5 * (left + right);
+        t = next;
+    }
+    return static_cast<float>(t);
+}
+
+void ArcLengthTable::Resample(int count, std::vector<Vector3>& out, std::vector<float>* params) const
+{
+    out.clear();
+    if (params)
+        params->clear();
+    if (!_curve)
+        return;
+
+    count = std::max(2, count);
+    out.reserve(count);
+    if (params)
+        params->reserve(count);
+    double total = _lengths.back();
+    for (int k = 0; k < count; ++k)
+    {
+        float t = (k == 0) ? 0.0f : (k == count - 1) ? 1.0f : ParameterAt(static_cast<float>(total * k / (count - 1)));
+        out.push_back(PointAt(t));
+        if (params)
+            params->push_back(t);
+    }
+}
+
+void ArcLengthTable::ResampleBySpacing(float spacing, std::vector<Vector3>& out, std::vector<float>* params) const
+{
+    float total = TotalLength();
+    int steps = 1;
+    if (spacing > 0.0f && total > 0.0f)
+    {
+        // Check in float before converting; a tiny spacing would overflow int
+        float exact = std::ceil(total / spacing - 1e-4f);
+        if (!(exact <= static_cast<float>(kMaxResampleSteps)))
+            throw std::invalid_argument("ArcLengthTable: spacing too small for the curve length");
+        steps = static_cast<int>(exact);
+    }
+    out.clear();
+    if (params)
+        params->clear();
+    if (!_curve)
+        return;
+
+    steps = std::max(1, steps);
+    out.reserve(steps + 1);
+    if (params)
+        params->reserve(steps + 1);
+    for (int k = 0; k <= steps; ++k)
+    {
+        float t = (k == steps) ? 1.0f : ParameterAt(spacing * k);
+        out.push_back(PointAt(t));
+        if (params)
+            params->push_back(t);
+    }
+}
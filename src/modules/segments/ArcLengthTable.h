@@ -0,0 +1,81 @@
+/**
+ * ArcLengthTable.h
+ * Linked file: ArcLengthTable.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Arc-length parameterization of a Bezier curve and equal-spacing resampling
+ *
+ * Equations
+ * Equ(1): \vec{B^\prime}\left(t\right)=n\sum_{i=0}^{n-1}b_{i,n-1}\left(t\right)\left(\vec{P_{i+1}}-\vec{P_i}\right)
+ * Equ(2): s\left(t\right)=\int_0^t|\vec{B^\prime}\left(u\right)|\,du
+ * Equ(3): \int_a^b f\left(u\right)du\approx\frac{b-a}{2}\sum_{k=1}^{5}w_kf\left(\frac{b-a}{2}x_k+\frac{a+b}{2}\right)   (5-point Gauss-Legendre)
+ * Equ(4): t_{m+1}=t_m-\frac{s\left(t_m\right)-s^\ast}{|\vec{B^\prime}\left(t_m\right)|}   (Newton step, bracketed)
+ */
+
+#ifndef ARCLENGTHTABLE_H
+#define ARCLENGTHTABLE_H
+
+#include <vector>
+#include <memory>
+
+#include "Vector3.h"
+#include "ParametricCurve.h"
+
+/**
+ * @brief Cumulative arc length of a curve at uniform knots t_i = i / intervals
+ *
+ * Built from Bezier control points (Equ. 1) or from any ParametricCurve, which is kept alive
+ * by the table. Each knot interval is integrated with Equ. 3, so the table is exact to quadrature accuracy at
+ * the knots. ParameterAt binary-searches the knots and refines inside the interval with Equ. 4.
+ */
+class ArcLengthTable
+{
+public:
+    static constexpr int kDefaultIntervals = 64;
+    static constexpr int kMaxResampleSteps = 1 << 20; // ResampleBySpacing output cap
+
+    ArcLengthTable() = default;
+    explicit ArcLengthTable(const std::vector<Vector3>& controlPoints, int intervals = kDefaultIntervals);
+    explicit ArcLengthTable(std::shared_ptr<const ParametricCurve> curve, int intervals = kDefaultIntervals);
+
+    void Build(const std::vector<Vector3>& controlPoints, int intervals = kDefaultIntervals);
+    void Build(std::shared_ptr<const ParametricCurve> curve, int intervals = kDefaultIntervals);
+
+    // Total length s(1)
+    float TotalLength() const { return _lengths.empty() ? 0.0f : static_cast<float>(_lengths.back()); }
+    int Intervals() const { return static_cast<int>(_lengths.size()) - 1; }
+
+    // s(t) for t in [0, 1] (Equ. 2)
+    float LengthAt(float t) const;
+
+    // t(s) for s in [0, TotalLength()], O(log intervals)
+    float ParameterAt(float s) const;
+
+    // Speed |B'(t)| (Equ. 1)
+    float SpeedAt(float t) const;
+
+    // Point on the curve
+    Vector3 PointAt(float t) const;
+
+    /**
+     * @brief Points at equal arc length, both end points included
+     *
+     * count < 2 yields the end points. params (optional) receives the matching t values.
+     */
+    void Resample(int count, std::vector<Vector3>& out, std::vector<float>* params = nullptr) const;
+
+    // Points every `spacing` world units; the last step is shortened to end on the curve end.
+    // Throws std::invalid_argument if that takes more than kMaxResampleSteps steps
+    void ResampleBySpacing(float spacing, std::vector<Vector3>& out, std::vector<float>* params = nullptr) const;
+
+private:
+    double Integrate(double a, double b) const;
+    double Speed(double t) const;
+
+    std::shared_ptr<const ParametricCurve> _curve;
+    std::vector<double> _lengths; // _lengths[i] = s(i / intervals)
+};
+
+#endif // ARCLENGTHTABLE_H
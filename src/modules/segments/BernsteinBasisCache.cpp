@@ -0,0 +1,220 @@
+// BernsteinBasisCache.cpp
+
+#include "BernsteinBasisCache.h"
+
+#include <mutex>
+
+namespace
+{
+    // levels[k][i] = b_{i,k}(t) for every k <= degree, built with Equ. 2
+    void BuildLevels(int degree, double t, std::vector<std::vector<double>>& levels)
+    {
+        double u = 1.0 - t;
+        levels.assign(degree + 1, std::vector<double>());
+        levels[0] = { 1.0 };
+        for (int k = 1; k <= degree; ++k)
+        {
+            const std::vector<double>& prev = levels[k - 1];
+            std::vector<double>& cur = levels[k];
+            cur.assign(k + 1, 0.0);
+            for (int i = 0; i <= k; ++i)
+            {
+                double left = (i < k) ? prev[i] : 0.0;
+                double right = (i > 0) ? prev[i - 1] : 0.0;
+                cur[i] = u * left + t * right;
+            }
+        }
+    }
+
+    Vector3 Row(const float* row, const std::vector<Vector3>& controlPoints)
+    {
+        Vector3 result(0.0f, 0.0f, 0.0f);
+        for (size_t i = 0; i < controlPoints.size(); ++i)
+        {
+            result += controlPoints[i] * row[i];
+        }
+        return result;
+    }
+
+    std::uint64_t MakeKey(int degree, int numSegments)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(degree)) << 32) |
+               static_cast<std::uint32_t>(numSegments);
+    }
+}
+
+BernsteinBasis::BernsteinBasis(int degree, int numSegments)
+    : degree(degree),
+      numSegments(numSegments)
+{
+    const int rows = Rows();
+    const int cols = Columns();
+    weights.assign(static_cast<size_t>(rows) * cols, 0.0f);
+    first.assign(static_cast<size_t>(rows) * cols, 0.0f);
+    second.assign(static_cast<size_t>(rows) * cols, 0.0f);
+
+    std::vector<std::vector<double>> levels;
+    for (int k = 0; k < rows; ++k)
+    {
+        double t = (numSegments > 0) ? static_cast<double>(k) / numSegments : 0.0;
+        BuildLevels(degree, t, levels);
+
+        float* w = &weights[static_cast<size_t>(k) * cols];
+        float* d1 = &first[static_cast<size_t>(k) * cols];
+        float* d2 = &second[static_cast<size_t>(k) * cols];
+        for (int i = 0; i <= degree; ++i)
+        {
+            w[i] = static_cast<float>(levels[degree][i]);
+
+            // Equ. 3
+            if (degree >= 1)
+            {
+                const std::vector<double>& b1 = levels[degree - 1];
+                double left = (i >= 1) ? b1[i - 1] : 0.0;
+                double right = (i <= degree - 1) ? b1[i] : 0.0;
+                d1[i] = static_cast<float>(degree * (left - right));
+            }
+
+            // Equ. 4
+            if (degree >= 2)
+            {
+                const std::vector<double>& b2 = levels[degree - 2];
+                double a = (i >= 2) ? b2[i - 2] : 0.0;
+                double b = (i >= 1 && i - 1 <= degree - 2) ? b2[i - 1] : 0.0;
+                double c = (i <= degree - 2) ? b2[i] : 0.0;
+                d2[i] = static_cast<float>(degree * (degree - 1) * (a - 2.0 * b + c));
+            }
+        }
+    }
+}
+
+Vector3 BernsteinBasis::Point(const std::vector<Vector3>& controlPoints, int sample) const
+{
+    return Row(&weights[static_cast<size_t>(sample) * Columns()], controlPoints);
+}
+
+Vector3 BernsteinBasis::FirstDerivative(const std::vector<Vector3>& controlPoints, int sample) const
+{
+    return Row(&first[static_cast<size_t>(sample) * Columns()], controlPoints);
+}
+
+Vector3 BernsteinBasis::SecondDerivative(const std::vector<Vector3>& controlPoints, int sample) const
+{
+    return Row(&second[static_cast<size_t>(sample) * Columns()], controlPoints);
+}
+
+void BernsteinBasis::EvaluateAll(const std::vector<Vector3>& controlPoints, std::vector<Vector3>& out) const
+{
+    const int cols = Columns();
+    out.resize(Rows());
+    for (int k = 0; k < Rows(); ++k)
+    {
+        const float* row = &weights[static_cast<size_t>(k) * cols];
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        for (int i = 0; i < cols; ++i)
+        {
+            x += row[i] * controlPoints[i].x;
+            y += row[i] * controlPoints[i].y;
+            z += row[i] * controlPoints[i].z;
+        }
+        out[k] = Vector3(x, y, z);
+    }
+}
+
+BernsteinBasisCache& BernsteinBasisCache::Instance()
+{
+    static BernsteinBasisCache instance;
+    return instance;
+}
+
+std::shared_ptr<const BernsteinBasis> BernsteinBasisCache::Get(int degree, int numSegments)
+{
+    if (degree < 0 || numSegments < 0)
+        return nullptr;
+
+    BernsteinBasisCache& cache = Instance();
+    const std::uint64_t key = MakeKey(degree, numSegments);
+
+    // Fast path: shared lock for lookups
+    {
+        std::shared_lock<std::shared_mutex> lock(cache._mutex);
+        auto it = cache._tables.find(key);
+        if (it != cache._tables.end())
+        {
+            it->second.LastUse.store(++cache._clock, std::memory_order_relaxed);
+            return it->second.Table;
+        }
+    }
+
+    // Build outside the lock; if another thread wins the race its table is kept
+    auto table = std::make_shared<const BernsteinBasis>(degree, numSegments);
+    std::unique_lock<std::shared_mutex> lock(cache._mutex);
+    auto it = cache._tables.find(key);
+    if (it != cache._tables.end())
+    {
+        it->second.LastUse.store(++cache._clock, std::memory_order_relaxed);
+        return it->second.Table;
+    }
+    if (table->Bytes() > cache._maxBytes)
+        return table; // Would evict everything and still not fit
+
+    cache.MakeRoom(table->Bytes());
+    Entry& entry = cache._tables[key];
+    entry.Table = table;
+    entry.LastUse.store(++cache._clock, std::memory_order_relaxed);
+    cache._bytes += table->Bytes();
+    return table;
+}
+
+void BernsteinBasisCache::MakeRoom(std::size_t incoming)
+{
+    // Tables are few (one per distinct sample count in use), so a linear scan per eviction is fine
+    while (!_tables.empty() && _bytes + incoming > _maxBytes)
+    {
+        auto oldest = _tables.begin();
+        for (auto it = _tables.begin(); it != _tables.end(); ++it)
+        {
+            if (it->second.LastUse.load(std::memory_order_relaxed) < oldest->second.LastUse.load(std::memory_order_relaxed))
+                oldest = it;
+        }
+        _bytes -= oldest->second.Table->Bytes();
+        _tables.erase(oldest);
+    }
+}
+
+void BernsteinBasisCache::Clear()
+{
+    BernsteinBasisCache& cache = Instance();
+    std::unique_lock<std::shared_mutex> lock(cache._mutex);
+    cache._tables.clear();
+    cache._bytes = 0;
+}
+
+size_t BernsteinBasisCache::Size()
+{
+    BernsteinBasisCache& cache = Instance();
+    std::shared_lock<std::shared_mutex> lock(cache._mutex);
+    return cache._tables.size();
+}
+
+size_t BernsteinBasisCache::Bytes()
+{
+    BernsteinBasisCache& cache = Instance();
+    std::shared_lock<std::shared_mutex> lock(cache._mutex);
+    return cache._bytes;
+}
+
+size_t BernsteinBasisCache::MaxBytes()
+{
+    BernsteinBasisCache& cache = Instance();
+    std::shared_lock<std::shared_mutex> lock(cache._mutex);
+    return cache._maxBytes;
+}
+
+void BernsteinBasisCache::SetMaxBytes(size_t maxBytes)
+{
+    BernsteinBasisCache& cache = Instance();
+    std::unique_lock<std::shared_mutex> lock(cache._mutex);
+    cache._maxBytes = maxBytes;
+    cache.MakeRoom(0);
+}
@@ -0,0 +1,104 @@
+/**
+ * BernsteinBasisCache.h
+ * Linked file: BernsteinBasisCache.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Process-wide cache of Bernstein basis matrices sampled at t_k = k / numSegments
+ *
+ * Equations
+ * Equ(1): b_{i,n}\left(t\right)=\binom{n}{i}\left(1-t\right)^{n-i}t^i
+ * Equ(2): b_{i,n}\left(t\right)=\left(1-t\right)b_{i,n-1}\left(t\right)+t\,b_{i-1,n-1}\left(t\right)
+ * Equ(3): b_{i,n}^\prime\left(t\right)=n\left(b_{i-1,n-1}\left(t\right)-b_{i,n-1}\left(t\right)\right)
+ * Equ(4): b_{i,n}^{\prime\prime}\left(t\right)=n\left(n-1\right)\left(b_{i-2,n-2}\left(t\right)-2b_{i-1,n-2}\left(t\right)+b_{i,n-2}\left(t\right)\right)
+ * Equ(5): \vec{B^{(r)}}\left(t_k\right)=\sum_{i=0}^{n}b_{i,n}^{(r)}\left(t_k\right)\vec{P_i}
+ */
+
+#ifndef BERNSTEINBASISCACHE_H
+#define BERNSTEINBASISCACHE_H
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <shared_mutex>
+#include <atomic>
+
+#include "Vector3.h"
+
+/**
+ * @brief Basis weights for one (degree, numSegments) pair
+ *
+ * Each table is row-major with (numSegments + 1) rows and (degree + 1) columns, so a sample is
+ * the dot product of one row with the control points (Equ. 5).
+ */
+struct BernsteinBasis
+{
+    int degree;
+    int numSegments;
+    std::vector<float> weights;  // Equ. 1
+    std::vector<float> first;    // Equ. 3
+    std::vector<float> second;   // Equ. 4
+
+    BernsteinBasis(int degree, int numSegments);
+
+    int Columns() const { return degree + 1; }
+    int Rows() const { return numSegments + 1; }
+    std::size_t Bytes() const { return (weights.size() + first.size() + second.size()) * sizeof(float); }
+
+    Vector3 Point(const std::vector<Vector3>& controlPoints, int sample) const;
+    Vector3 FirstDerivative(const std::vector<Vector3>& controlPoints, int sample) const;
+    Vector3 SecondDerivative(const std::vector<Vector3>& controlPoints, int sample) const;
+
+    // Evaluate every row into out; out is overwritten
+    void EvaluateAll(const std::vector<Vector3>& controlPoints, std::vector<Vector3>& out) const;
+};
+
+/**
+ * @brief Thread-safe shared cache of BernsteinBasis tables
+ *
+ * Resident tables are capped in bytes; inserting past the cap evicts the least recently used
+ * ones. Evicted tables stay valid for whoever still holds them, and a table larger than the
+ * whole cap is returned without being cached. Hits take only the shared lock and stamp the
+ * entry's last use atomically.
+ */
+class BernsteinBasisCache
+{
+private:
+    struct Entry
+    {
+        std::shared_ptr<const BernsteinBasis> Table;
+        std::atomic<std::uint64_t> LastUse{0};
+    };
+
+    std::shared_mutex _mutex;
+    std::unordered_map<std::uint64_t, Entry> _tables;
+    std::size_t _bytes = 0;
+    std::size_t _maxBytes = kDefaultMaxBytes;
+    std::atomic<std::uint64_t> _clock{0};
+
+    BernsteinBasisCache() = default;
+    static BernsteinBasisCache& Instance();
+
+    // Evict least recently used tables until incoming more bytes fit; needs the unique lock
+    void MakeRoom(std::size_t incoming);
+
+public:
+    static constexpr std::size_t kDefaultMaxBytes = 32u << 20;
+
+    // Returns the shared table, building it on first request
+    static std::shared_ptr<const BernsteinBasis> Get(int degree, int numSegments);
+
+    // Drops all tables; tables still held by callers stay valid
+    static void Clear();
+    static size_t Size();
+
+    // Resident bytes, and the cap on them (lowering it evicts at once)
+    static size_t Bytes();
+    static size_t MaxBytes();
+    static void SetMaxBytes(size_t maxBytes);
+};
+
+#endif // BERNSTEINBASISCACHE_H
@@ -0,0 +1,260 @@
+// BezierEvaluator.cpp
+
+#include "BezierEvaluator.h"
+#include "BernsteinBasisCache.h"
+#include "FixedDegreeBezier.h"
+
+namespace
+{
+    // Horner evaluation in double precision; used wherever the result seeds further accumulation
+    Vector3d HornerDouble(const std::vector<Vector3>& controlPoints, double t)
+    {
+        int n = static_cast<int>(controlPoints.size()) - 1;
+        double u = 1.0 - t;
+        double bc = 1.0;
+        double tn = 1.0;
+        Vector3d tmp = Vector3d(controlPoints[0]) * u;
+        for (int i = 1; i < n; ++i)
+        {
+            tn *= t;
+            bc = bc * (n - i + 1) / i;
+            tmp = (tmp + Vector3d(controlPoints[i]) * (tn * bc)) * u;
+        }
+        tn *= t;
+        return tmp + Vector3d(controlPoints[n]) * tn;
+    }
+}
+
+// Default uniform sampling: one Evaluate per sample
+void BezierEvaluator::EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const
+{
+    out.clear();
+    if (numSegments < 1)
+    {
+        out.push_back(Evaluate(controlPoints, 0.0f));
+        return;
+    }
+    out.reserve(numSegments + 1);
+    for (int i = 0; i <= numSegments; ++i)
+    {
+        float t = static_cast<float>(i) / numSegments;
+        out.push_back(Evaluate(controlPoints, t));
+    }
+}
+
+const BezierEvaluator& BezierEvaluator::Get(BezierMethod method)
+{
+    static const DeCasteljauEvaluator deCasteljau;
+    static const HornerEvaluator horner;
+    static const ForwardDifferenceEvaluator forwardDifference;
+    static const BasisTableEvaluator basisTable;
+    static const FixedDegreeEvaluator fixedDegree;
+
+    switch (method)
+    {
+    case BezierMethod::DeCasteljau:
+        return deCasteljau;
+    case BezierMethod::ForwardDifference:
+        return forwardDifference;
+    case BezierMethod::BasisTable:
+        return basisTable;
+    case BezierMethod::FixedDegree:
+        return fixedDegree;
+    case BezierMethod::Horner:
+    default:
+        return horner;
+    }
+}
+
+// de Casteljau (Equ. 2)
+Vector3 DeCasteljauEvaluator::Evaluate(const std::vector<Vector3>& controlPoints, float t) const
+{
+    if (controlPoints.empty())
+        return Vector3(0.0f, 0.0f, 0.0f);
+
+    std::vector<Vector3> scratch(controlPoints);
+    float u = 1.0f - t;
+    for (size_t r = scratch.size() - 1; r > 0; --r)
+    {
+        for (size_t i = 0; i < r; ++i)
+        {
+            scratch[i] = scratch[i] * u + scratch[i + 1] * t;
+        }
+    }
+    return scratch[0];
+}
+
+void DeCasteljauEvaluator::EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const
+{
+    if (controlPoints.empty() || numSegments < 1)
+    {
+        BezierEvaluator::EvaluateUniform(controlPoints, numSegments, out);
+        return;
+    }
+
+    // Reuse one scratch buffer for every sample
+    std::vector<Vector3> scratch(controlPoints.size());
+    out.clear();
+    out.reserve(numSegments + 1);
+    for (int s = 0; s <= numSegments; ++s)
+    {
+        float t = static_cast<float>(s) / numSegments;
+        float u = 1.0f - t;
+        scratch.assign(controlPoints.begin(), controlPoints.end());
+        for (size_t r = scratch.size() - 1; r > 0; --r)
+        {
+            for (size_t i = 0; i < r; ++i)
+            {
+                scratch[i] = scratch[i] * u + scratch[i + 1] * t;
+            }
+        }
+        out.push_back(scratch[0]);
+    }
+}
+
+// Horner-form Bernstein (Equ. 3)
+Vector3 HornerEvaluator::Evaluate(const std::vector<Vector3>& controlPoints, float t) const
+{
+    if (controlPoints.empty())
+        return Vector3(0.0f, 0.0f, 0.0f);
+
+    int n = static_cast<int>(controlPoints.size()) - 1;
+    if (n == 0)
+        return controlPoints[0];
+
+    float u = 1.0f - t;
+    float bc = 1.0f;
+    float tn = 1.0f;
+    Vector3 tmp = controlPoints[0] * u;
+    for (int i = 1; i < n; ++i)
+    {
+        tn *= t;
+        bc = bc * (n - i + 1) / i;
+        tmp = (tmp + controlPoints[i] * (tn * bc)) * u;
+    }
+    return tmp + controlPoints[n] * (tn * t);
+}
+
+// Forward differencing (Equ. 4)
+Vector3 ForwardDifferenceEvaluator::Evaluate(const std::vector<Vector3>& controlPoints, float t) const
+{
+    if (controlPoints.empty())
+        return Vector3(0.0f, 0.0f, 0.0f);
+    return Vector3(HornerDouble(controlPoints, t));
+}
+
+void ForwardDifferenceEvaluator::EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const
+{
+    const int n = static_cast<int>(controlPoints.size()) - 1;
+    if (n < 1 || n > kMaxDegree || numSegments < 1)
+    {
+        BezierEvaluator::EvaluateUniform(controlPoints, numSegments, out);
+        return;
+    }
+
+    const double h = 1.0 / numSegments;
+
+    // Power basis: a_k = C(n,k) * sum_i (-1)^(k-i) C(k,i) P_i
+    std::vector<Vector3d> power(n + 1);
+    double cnk = 1.0;
+    for (int k = 0; k <= n; ++k)
+    {
+        Vector3d a;
+        double cki = 1.0;
+        for (int i = 0; i <= k; ++i)
+        {
+            double w = ((k - i) % 2 == 0 ? cki : -cki);
+            a += Vector3d(controlPoints[i]) * w;
+            cki = cki * (k - i) / (i + 1);
+        }
+        power[k] = a * cnk;
+        cnk = cnk * (n - k) / (k + 1);
+    }
+
+    // surjection[m][j] = j! * S(m, j), maps scaled Taylor coefficients to forward differences
+    std::vector<std::vector<double>> surjection(n + 1, std::vector<double>(n + 1, 0.0));
+    surjection[0][0] = 1.0;
+    for (int m = 1; m <= n; ++m)
+    {
+        for (int j = 1; j <= m; ++j)
+            surjection[m][j] = j * (surjection[m - 1][j] + surjection[m - 1][j - 1]);
+    }
+
+    std::vector<Vector3d> taylor(n + 1);
+    std::vector<Vector3d> diff(n + 1);
+
+    out.clear();
+    out.reserve(numSegments + 1);
+
+    for (int s = 0; s <= numSegments; ++s)
+    {
+        if (s % kReseedInterval == 0)
+        {
+            // Shift the power basis to t0 so that taylor[m] multiplies (t - t0)^m
+            const double t0 = s * h;
+            taylor = power;
+            for (int k = 0; k < n; ++k)
+            {
+                for (int j = n - 1; j >= k; --j)
+                    taylor[j] += taylor[j + 1] * t0;
+            }
+
+            // D_j = sum_m j! S(m, j) h^m taylor[m]
+            double hm = 1.0;
+            for (int m = 0; m <= n; ++m)
+            {
+                taylor[m] *= hm;
+                hm *= h;
+            }
+            for (int j = 0; j <= n; ++j)
+            {
+                Vector3d d;
+                for (int m = j; m <= n; ++m)
+                    d += taylor[m] * surjection[m][j];
+                diff[j] = d;
+            }
+        }
+        else
+        {
+            // Additions only between seeds
+            for (int j = 0; j < n; ++j)
+                diff[j] += diff[j + 1];
+        }
+        out.push_back(Vector3(diff[0]));
+    }
+}
+
+// Precomputed basis table
+void BasisTableEvaluator::EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const
+{
+    if (controlPoints.empty() || numSegments < 1)
+    {
+        BezierEvaluator::EvaluateUniform(controlPoints, numSegments, out);
+        return;
+    }
+
+    auto basis = BernsteinBasisCache::Get(static_cast<int>(controlPoints.size()) - 1, numSegments);
+    basis->EvaluateAll(controlPoints, out);
+}
+
+// Fixed-degree kernels
+Vector3 FixedDegreeEvaluator::Evaluate(const std::vector<Vector3>& controlPoints, float t) const
+{
+    const BezierKernelSet* kernel = FixedDegreeBezier::ForControlPoints(controlPoints);
+    if (!kernel)
+        return HornerEvaluator::Evaluate(controlPoints, t);
+    return kernel->Point(controlPoints.data(), t);
+}
+
+void FixedDegreeEvaluator::EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const
+{
+    const BezierKernelSet* kernel = FixedDegreeBezier::ForControlPoints(controlPoints);
+    if (!kernel || numSegments < 1)
+    {
+        BasisTableEvaluator::EvaluateUniform(controlPoints, numSegments, out);
+        return;
+    }
+    auto basis = BernsteinBasisCache::Get(kernel->Degree, numSegments);
+    out.resize(basis->Rows());
+    kernel->EvaluateRows(controlPoints.data(), basis->weights.data(), basis->Rows(), out.data());
+}
@@ -0,0 +1,116 @@
+/**
+ * BezierEvaluator.h
+ * Linked file: BezierEvaluator.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Interchangeable back ends for evaluating the Bezier curve of a LinearSegment
+ *
+ * Equations
+ * Equ(1): \vec{B}\left(t\right)=\sum_{i=0}^{n}\binom{n}{i}\left(1-t\right)^{n-i}t^i\vec{P_i},\emsp0\le t\le1
+ * Equ(2): \vec{P_i^{(r)}}=\left(1-t\right)\vec{P_i^{(r-1)}}+t\vec{P_{i+1}^{(r-1)}},\emsp\vec{B}\left(t\right)=\vec{P_0^{(n)}}
+ * Equ(3): \vec{B}\left(t\right)=\left(1-t\right)^n\sum_{i=0}^{n}\binom{n}{i}\left(\frac{t}{1-t}\right)^i\vec{P_i}
+ * Equ(4): \Delta^{k}\vec{B}\left(t+h\right)=\Delta^{k}\vec{B}\left(t\right)+\Delta^{k+1}\vec{B}\left(t\right)
+ */
+
+#ifndef BEZIEREVALUATOR_H
+#define BEZIEREVALUATOR_H
+
+#include <vector>
+
+#include "Vector3.h"
+
+/**
+ * @brief Evaluation back ends selectable per LinearSegment
+ */
+enum class BezierMethod
+{
+    DeCasteljau,       // Equ. 2; repeated interpolation, most stable
+    Horner,            // Equ. 3; nested Bernstein sum, O(n) per sample
+    ForwardDifference, // Equ. 4; uniform steps only, O(n) per sample without multiplications
+    BasisTable,        // Shared BernsteinBasisCache rows; uniform steps only, no basis math per segment
+    FixedDegree        // FixedDegreeBezier kernels for degree 1..10, BasisTable above
+};
+
+/**
+ * @brief Bezier evaluator interface
+ *
+ * Implementations are stateless; use Get() to obtain the shared instance of a method.
+ */
+class BezierEvaluator
+{
+public:
+    virtual ~BezierEvaluator() = default;
+
+    // Evaluate B(t) for a single parameter (Equ. 1)
+    virtual Vector3 Evaluate(const std::vector<Vector3>& controlPoints, float t) const = 0;
+
+    // Evaluate B(i / numSegments) for i = 0..numSegments; out is overwritten
+    virtual void EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const;
+
+    // Shared instance for the requested method
+    static const BezierEvaluator& Get(BezierMethod method);
+};
+
+/**
+ * @brief de Casteljau back end (Equ. 2)
+ */
+class DeCasteljauEvaluator : public BezierEvaluator
+{
+public:
+    Vector3 Evaluate(const std::vector<Vector3>& controlPoints, float t) const override;
+    void EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const override;
+};
+
+/**
+ * @brief Horner-form Bernstein back end (Equ. 3)
+ */
+class HornerEvaluator : public BezierEvaluator
+{
+public:
+    Vector3 Evaluate(const std::vector<Vector3>& controlPoints, float t) const override;
+};
+
+/**
+ * @brief Forward differencing back end (Equ. 4)
+ *
+ * The difference table is derived analytically from the power basis at each seed point and
+ * reseeded every kReseedInterval steps. Curves above kMaxDegree fall back to Horner.
+ */
+class ForwardDifferenceEvaluator : public BezierEvaluator
+{
+public:
+    static constexpr int kReseedInterval = 64;
+    static constexpr int kMaxDegree = 20;
+
+    Vector3 Evaluate(const std::vector<Vector3>& controlPoints, float t) const override;
+    void EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const override;
+};
+
+/**
+ * @brief Precomputed basis back end
+ *
+ * Uniform sampling is a matrix-vector product against the shared BernsteinBasisCache table
+ * for (degree, numSegments). Single evaluations fall back to Horner.
+ */
+class BasisTableEvaluator : public HornerEvaluator
+{
+public:
+    void EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const override;
+};
+
+/**
+ * @brief Compile-time degree kernels (FixedDegreeBezier.h)
+ *
+ * The kernel is looked up once per call from the control point count; degrees outside the
+ * compiled range use the basis table for uniform sampling and Horner for single evaluations.
+ */
+class FixedDegreeEvaluator : public BasisTableEvaluator
+{
+public:
+    Vector3 Evaluate(const std::vector<Vector3>& controlPoints, float t) const override;
+    void EvaluateUniform(const std::vector<Vector3>& controlPoints, int numSegments, std::vector<Vector3>& out) const override;
+};
+
+#endif // BEZIEREVALUATOR_H
@@ -0,0 +1,184 @@
+// CubicBSpline.cpp
+
+#include "CubicBSpline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    // Derivative control points and knots (Equ. 4)
+    void Differentiate(const std::vector<Vector3>& points, const std::vector<float>& knots, int degree,
+                       std::vector<Vector3>& outPoints, std::vector<float>& outKnots)
+    {
+        outPoints.clear();
+        outKnots.clear();
+        if (degree <= 0 || points.size() < 2)
+            return;
+        for (std::size_t i = 0; i + 1 < points.size(); ++i)
+        {
+            float span = knots[i + degree + 1] - knots[i + 1];
+            outPoints.push_back(span > 0.0f ? (points[i + 1] - points[i]) * (degree / span) : Vector3());
+        }
+        outKnots.assign(knots.begin() + 1, knots.end() - 1);
+    }
+
+    // de Boor evaluation at knot parameter u (Equ. 3); interior knots are integers, so the span is a floor
+    Vector3 DeBoor(const std::vector<Vector3>& points, const std::vector<float>& knots, int degree, float u)
+    {
+        if (points.empty())
+            return Vector3();
+        const int n = static_cast<int>(points.size()) - 1;
+        int k = degree + static_cast<int>(std::floor(u - knots[degree]));
+        k = std::min(n, std::max(degree, k));
+
+        Vector3 d[4];
+        for (int j = 0; j <= degree; ++j)
+            d[j] = points[j + k - degree];
+        for (int r = 1; r <= degree; ++r)
+        {
+            for (int j = degree; j >= r; --j)
+            {
+                float lo = knots[j + k - degree];
+                float hi = knots[j + 1 + k - r];
+                float alpha = hi > lo ? (u - lo) / (hi - lo) : 0.0f;
+                d[j] = d[j - 1] * (1.0f - alpha) + d[j] * alpha;
+            }
+        }
+        return d[degree];
+    }
+
+    // Blossom f(args[0], .., args[degree - 1]) on span k: de Boor with a separate argument per level (Equ. 6)
+    Vector3 Blossom(const std::vector<Vector3>& points, const std::vector<float>& knots, int degree, int k, const float* args)
+    {
+        Vector3 d[4];
+        for (int j = 0; j <= degree; ++j)
+            d[j] = points[j + k - degree];
+        for (int r = 1; r <= degree; ++r)
+        {
+            for (int j = degree; j >= r; --j)
+            {
+                float lo = knots[j + k - degree];
+                float hi = knots[j + 1 + k - r];
+                float alpha = hi > lo ? (args[r - 1] - lo) / (hi - lo) : 0.0f;
+                d[j] = d[j - 1] * (1.0f - alpha) + d[j] * alpha;
+            }
+        }
+        return d[degree];
+    }
+}
+
+CubicBSpline::CubicBSpline(const std::vector<Vector3>& controlPoints, BSplineKnots knots)
+{
+    Build(controlPoints, knots);
+}
+
+void CubicBSpline::Build(const std::vector<Vector3>& controlPoints, BSplineKnots knots)
+{
+    _points = controlPoints;
+    _knotLayout = knots;
+    _knots.clear();
+    _first.clear();
+    _firstKnots.clear();
+    _second.clear();
+    _secondKnots.clear();
+    if (_points.empty())
+    {
+        _degree = 0;
+        _domain = 0.0f;
+        return;
+    }
+
+    const int n = static_cast<int>(_points.size()) - 1;
+    _degree = std::min(3, n);
+    const int p = _degree;
+
+    // Equ. 2
+    _knots.resize(n + p + 2);
+    for (int i = 0; i < n + p + 2; ++i)
+    {
+        if (knots == BSplineKnots::Clamped)
+            _knots[i] = static_cast<float>(std::min(std::max(i - p, 0), n - p + 1));
+        else
+            _knots[i] = static_cast<float>(i - p);
+    }
+    _domain = _knots[n + 1] - _knots[p];
+
+    // Equ. 4 and 5: derivatives with respect to t
+    Differentiate(_points, _knots, p, _first, _firstKnots);
+    for (Vector3& q : _first)
+        q *= _domain;
+    Differentiate(_first, _firstKnots, p - 1, _second, _secondKnots);
+    for (Vector3& q : _second)
+        q *= _domain;
+}
+
+float CubicBSpline::ToKnot(float t) const
+{
+    float clamped = std::min(1.0f, std::max(0.0f, t));
+    return _knots.empty() ? 0.0f : _knots[_degree] + clamped * _domain;
+}
+
+Vector3 CubicBSpline::Point(float t) const
+{
+    return DeBoor(_points, _knots, _degree, ToKnot(t));
+}
+
+Vector3 CubicBSpline::FirstDerivative(float t) const
+{
+    return _degree < 1 ? Vector3() : DeBoor(_first, _firstKnots, _degree - 1, ToKnot(t));
+}
+
+Vector3 CubicBSpline::SecondDerivative(float t) const
+{
+    return _degree < 2 ? Vector3() : DeBoor(_second, _secondKnots, _degree - 2, ToKnot(t));
+}
+
+bool CubicBSpline::BezierPieces(std::vector<BezierPiece>& pieces) const
+{
+    pieces.clear();
+    if (_points.empty())
+        return false;
+    if (_degree == 0 || _domain <= 0.0f)
+    {
+        pieces.push_back(BezierPiece{0.0f, 1.0f, std::vector<Vector3>(1, _points[0])});
+        return true;
+    }
+
+    const int n = static_cast<int>(_points.size()) - 1;
+    for (int k = _degree; k <= n; ++k)
+    {
+        float u0 = _knots[k];
+        float u1 = _knots[k + 1];
+        if (u1 <= u0)
+            continue;
+        BezierPiece piece{(u0 - _knots[_degree]) / _domain, (u1 - _knots[_degree]) / _domain, {}};
+        piece.ControlPoints.reserve(_degree + 1);
+        for (int j = 0; j <= _degree; ++j)
+        {
+            float args[3];
+            for (int a = 0; a < _degree; ++a)
+                args[a] = a < _degree - j ? u0 : u1;
+            piece.ControlPoints.push_back(Blossom(_points, _knots, _degree, k, args));
+        }
+        pieces.push_back(std::move(piece));
+    }
+    return !pieces.empty();
+}
+
+void CubicBSpline::SupportOf(int i, float& t0, float& t1) const
+{
+    if (_knots.empty() || _domain <= 0.0f)
+    {
+        t0 = 0.0f;
+        t1 = 1.0f;
+        return;
+    }
+    // N_{i,p} is non-zero on [U_i, U_{i+p+1}); out-of-range indices take the nearest end point
+    i = std::min(std::max(i, 0), static_cast<int>(_points.size()) - 1);
+    float u0 = _knots[i];
+    float u1 = _knots[i + _degree + 1];
+    t0 = std::min(1.0f, std::max(0.0f, (u0 - _knots[_degree]) / _domain));
+    t1 = std::min(1.0f, std::max(0.0f, (u1 - _knots[_degree]) / _domain));
+}
@@ -0,0 +1,93 @@
+/**
+ * CubicBSpline.h
+ * Linked file: CubicBSpline.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Piecewise cubic B-spline over the LinearSegment control polygon (Equ. 9-13 there)
+ *
+ * Equations
+ * Equ(1): \vec{C}\left(u\right)=\sum_{i=0}^{n}N_{i,p}\left(u\right)\vec{P_i},\emsp p=\min\left(3,n\right)
+ * Equ(2): U_{\mathrm{clamped}}=\{\underbrace{0,\dots,0}_{p+1},1,\dots,n-p,\underbrace{n-p+1,\dots,n-p+1}_{p+1}\},\emsp U_{\mathrm{uniform}}=\{i-p\}_{i=0}^{n+p+1}
+ * Equ(3): \vec{d_j^{(r)}}=\left(1-\alpha_{j}^{(r)}\right)\vec{d_{j-1}^{(r-1)}}+\alpha_{j}^{(r)}\vec{d_j^{(r-1)}},\emsp\alpha_{j}^{(r)}=\frac{u-U_{j+k-p}}{U_{j+1+k-r}-U_{j+k-p}}   (de Boor)
+ * Equ(4): \vec{Q_i}=\frac{p\left(\vec{P_{i+1}}-\vec{P_i}\right)}{U_{i+p+1}-U_{i+1}},\emsp\vec{C^\prime}\left(u\right)=\sum_{i=0}^{n-1}N_{i,p-1}\left(u\right)\vec{Q_i}
+ * Equ(5): u=U_p+t\left(U_{n+1}-U_p\right),\emsp\frac{d\vec{C}}{dt}=\left(U_{n+1}-U_p\right)\frac{d\vec{C}}{du}
+ * Equ(6): \vec{b_j}=f\left(\underbrace{U_k,\dots,U_k}_{p-j},\underbrace{U_{k+1},\dots,U_{k+1}}_{j}\right),\emsp j=0,\dots,p   (Bezier points of span k from the blossom f)
+ */
+
+#ifndef CUBICBSPLINE_H
+#define CUBICBSPLINE_H
+
+#include <vector>
+
+#include "Vector3.h"
+#include "ParametricCurve.h"
+
+/**
+ * @brief Curve representation used by a LinearSegment
+ */
+enum class CurveRepresentation
+{
+    Bezier,        // Single Bezier of degree D1 + D2 + 2 (Equ. 8)
+    PiecewiseCubic // CubicBSpline over the same control polygon; local support, O(1) per sample
+};
+
+/**
+ * @brief Knot vector layout (Equ. 2)
+ */
+enum class BSplineKnots
+{
+    Clamped, // Interpolates the first and last control points; same end tangents as the Bezier
+    Uniform  // Unclamped uniform knots; smoother, but the ends sit inside the control polygon
+};
+
+/**
+ * @brief Piecewise cubic B-spline with precomputed derivative splines
+ *
+ * Interior knots are consecutive integers in both layouts, so the knot span of a parameter is
+ * found with one floor instead of a search. Polygons with fewer than four points reduce the
+ * degree to n; a clamped spline of four points is exactly the cubic Bezier.
+ */
+class CubicBSpline : public ParametricCurve
+{
+public:
+    CubicBSpline() = default;
+    explicit CubicBSpline(const std::vector<Vector3>& controlPoints, BSplineKnots knots = BSplineKnots::Clamped);
+
+    void Build(const std::vector<Vector3>& controlPoints, BSplineKnots knots = BSplineKnots::Clamped);
+
+    int Degree() const { return _degree; }
+    int SpanCount() const { return static_cast<int>(_points.size()) - _degree; }
+    BSplineKnots Knots() const { return _knotLayout; }
+    const std::vector<Vector3>& ControlPoints() const { return _points; }
+    const std::vector<float>& KnotVector() const { return _knots; }
+
+    Vector3 Point(float t) const override;
+    Vector3 FirstDerivative(float t) const override;
+    Vector3 SecondDerivative(float t) const override;
+
+    // One Bezier per non-empty knot span (Equ. 6)
+    bool BezierPieces(std::vector<BezierPiece>& pieces) const override;
+
+    // Range of t affected by moving control point i (local support); i is clamped to [0, ControlPoints().size())
+    void SupportOf(int i, float& t0, float& t1) const;
+
+private:
+    float ToKnot(float t) const;
+
+    int _degree = 0;
+    BSplineKnots _knotLayout = BSplineKnots::Clamped;
+    float _domain = 0.0f; // U_{n+1} - U_p
+
+    std::vector<Vector3> _points;
+    std::vector<float> _knots;
+
+    // Derivative splines (Equ. 4), already scaled by the domain length (Equ. 5)
+    std::vector<Vector3> _first;
+    std::vector<float> _firstKnots;
+    std::vector<Vector3> _second;
+    std::vector<float> _secondKnots;
+};
+
+#endif // CUBICBSPLINE_H
@@ -0,0 +1,138 @@
+// CurveDerivatives.cpp
+
+#include "CurveDerivatives.h"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr std::size_t kBlock = 64;
+
+    std::vector<Vector3> Difference(const std::vector<Vector3>& controlPoints)
+    {
+        std::vector<Vector3> hodograph;
+        int n = static_cast<int>(controlPoints.size()) - 1;
+        if (n <= 0)
+            return hodograph;
+        hodograph.reserve(n);
+        for (int i = 0; i < n; ++i)
+            hodograph.push_back((controlPoints[i + 1] - controlPoints[i]) * static_cast<float>(n));
+        return hodograph;
+    }
+
+    /**
+     * Horner-form Bernstein sum over a block of samples:
+     * tmp = P0 u; tmp = (tmp + C(n,i) t^i P_i) u for 0 < i < n; B = tmp + t^n P_n
+     * The loop over samples is innermost and free of dependencies, so it vectorizes.
+     */
+    void HornerBlock(const std::vector<Vector3>& cps, const float* ts, std::size_t count, float* x, float* y, float* z)
+    {
+        const int n = static_cast<int>(cps.size()) - 1;
+        if (n < 0)
+        {
+            std::fill(x, x + count, 0.0f);
+            std::fill(y, y + count, 0.0f);
+            std::fill(z, z + count, 0.0f);
+            return;
+        }
+        if (n == 0)
+        {
+            std::fill(x, x + count, cps[0].x);
+            std::fill(y, y + count, cps[0].y);
+            std::fill(z, z + count, cps[0].z);
+            return;
+        }
+
+        float tn[kBlock];
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            float u = 1.0f - ts[s];
+            x[s] = cps[0].x * u;
+            y[s] = cps[0].y * u;
+            z[s] = cps[0].z * u;
+            tn[s] = 1.0f;
+        }
+
+        float bc = 1.0f;
+        for (int i = 1; i < n; ++i)
+        {
+            bc = bc * (n - i + 1) / i;
+            const float px = cps[i].x * bc, py = cps[i].y * bc, pz = cps[i].z * bc;
+            for (std::size_t s = 0; s < count; ++s)
+            {
+                float t = ts[s];
+                float u = 1.0f - t;
+                tn[s] *= t;
+                x[s] = (x[s] + px * tn[s]) * u;
+                y[s] = (y[s] + py * tn[s]) * u;
+                z[s] = (z[s] + pz * tn[s]) * u;
+            }
+        }
+
+        const Vector3& last = cps[n];
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            float t = tn[s] * ts[s];
+            x[s] += last.x * t;
+            y[s] += last.y * t;
+            z[s] += last.z * t;
+        }
+    }
+
+    Vector3 HornerOne(const std::vector<Vector3>& cps, float t)
+    {
+        float x, y, z;
+        HornerBlock(cps, &t, 1, &x, &y, &z);
+        return Vector3(x, y, z);
+    }
+}
+
+CurveDerivatives::CurveDerivatives(const std::vector<Vector3>& controlPoints)
+{
+    Build(controlPoints);
+}
+
+void CurveDerivatives::Build(const std::vector<Vector3>& controlPoints)
+{
+    _points = controlPoints;
+    _first = Difference(_points);
+    _second = Difference(_first);
+}
+
+Vector3 CurveDerivatives::Point(float t) const
+{
+    return HornerOne(_points, t);
+}
+
+Vector3 CurveDerivatives::FirstDerivative(float t) const
+{
+    return HornerOne(_first, t);
+}
+
+Vector3 CurveDerivatives::SecondDerivative(float t) const
+{
+    return HornerOne(_second, t);
+}
+
+void CurveDerivatives::CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const
+{
+    float d1x[kBlock], d1y[kBlock], d1z[kBlock];
+    float d2x[kBlock], d2y[kBlock], d2z[kBlock];
+    for (std::size_t begin = 0; begin < count; begin += kBlock)
+    {
+        std::size_t block = std::min(kBlock, count - begin);
+        HornerBlock(_first, ts + begin, block, d1x, d1y, d1z);
+        HornerBlock(_second, ts + begin, block, d2x, d2y, d2z);
+        for (std::size_t s = 0; s < block; ++s)
+            out[begin + s] = Frame(Vector3(d1x[s], d1y[s], d1z[s]), Vector3(d2x[s], d2y[s], d2z[s]));
+    }
+}
+
+bool CurveDerivatives::BezierPieces(std::vector<BezierPiece>& pieces) const
+{
+    pieces.clear();
+    if (_points.empty())
+        return false;
+    pieces.push_back(BezierPiece{0.0f, 1.0f, _points});
+    return true;
+}
@@ -0,0 +1,62 @@
+/**
+ * CurveDerivatives.h
+ * Linked file: CurveDerivatives.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Cached hodograph control points and batch curvature / Frenet frame evaluation
+ *
+ * Equations
+ * Equ(1): \vec{D_i}=n\left(\vec{P_{i+1}}-\vec{P_i}\right),\emsp\vec{B^\prime}\left(t\right)=\sum_{i=0}^{n-1}b_{i,n-1}\left(t\right)\vec{D_i}
+ * Equ(2): \vec{E_i}=\left(n-1\right)\left(\vec{D_{i+1}}-\vec{D_i}\right),\emsp\vec{B^{\prime\prime}}\left(t\right)=\sum_{i=0}^{n-2}b_{i,n-2}\left(t\right)\vec{E_i}
+ * Curvature and frame follow ParametricCurve.h (Equ. 1 and 2 there).
+ */
+
+#ifndef CURVEDERIVATIVES_H
+#define CURVEDERIVATIVES_H
+
+#include <vector>
+#include <cstddef>
+
+#include "Vector3.h"
+#include "ParametricCurve.h"
+
+/**
+ * @brief Control points of a Bezier curve together with its first and second hodographs
+ *
+ * Batch calls evaluate the Bernstein sums control point by control point over blocks of
+ * samples held in structure-of-arrays form, so the inner loop runs across samples and
+ * vectorizes; no binomials or powf are computed per sample.
+ */
+class CurveDerivatives : public ParametricCurve
+{
+public:
+    CurveDerivatives() = default;
+    explicit CurveDerivatives(const std::vector<Vector3>& controlPoints);
+
+    void Build(const std::vector<Vector3>& controlPoints);
+
+    const std::vector<Vector3>& ControlPoints() const { return _points; }
+    const std::vector<Vector3>& First() const { return _first; }   // Equ. 1
+    const std::vector<Vector3>& Second() const { return _second; } // Equ. 2
+
+    // Single evaluations
+    Vector3 Point(float t) const override;
+    Vector3 FirstDerivative(float t) const override;
+    Vector3 SecondDerivative(float t) const override;
+
+    // Curvature, tangent and normal for ts[0..count); out must hold count samples
+    using ParametricCurve::CurvatureProfile;
+    void CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const override;
+
+    // The whole curve is one piece
+    bool BezierPieces(std::vector<BezierPiece>& pieces) const override;
+
+private:
+    std::vector<Vector3> _points;
+    std::vector<Vector3> _first;
+    std::vector<Vector3> _second;
+};
+
+#endif // CURVEDERIVATIVES_H
@@ -0,0 +1,429 @@
+// CurveQuery.cpp
+
+#include "CurveQuery.h"
+#include "AABB.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    struct Piece
+    {
+        float t0, t1;
+        int depth;
+        std::vector<Vector3> points;
+        AABB box;
+        bool flat;
+    };
+
+    // de Casteljau split at t = 1/2 (Equ. 1)
+    void Split(const std::vector<Vector3>& points, std::vector<Vector3>& left, std::vector<Vector3>& right)
+    {
+        std::vector<Vector3> work(points);
+        const std::size_t n = points.size();
+        left.resize(n);
+        right.resize(n);
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            left[r] = work[0];
+            right[n - 1 - r] = work[n - 1 - r];
+            for (std::size_t i = 0; i + 1 < n - r; ++i)
+                work[i] = (work[i] + work[i + 1]) * 0.5f;
+        }
+    }
+
+    // Largest distance of an interior control point from the chord
+    float Deviation(const std::vector<Vector3>& points)
+    {
+        const Vector3& a = points.front();
+        Vector3 ab = points.back() - a;
+        float lengthSq = ab.dot(ab);
+        float deviation = 0.0f;
+        for (std::size_t i = 1; i + 1 < points.size(); ++i)
+        {
+            Vector3 ap = points[i] - a;
+            float s = lengthSq > 0.0f ? std::min(1.0f, std::max(0.0f, ap.dot(ab) / lengthSq)) : 0.0f;
+            deviation = std::max(deviation, (ap - ab * s).magnitude());
+        }
+        return deviation;
+    }
+
+    // Below this the control points are float rounding noise and a piece cannot get flatter
+    float RoundingFloor(const AABB& box)
+    {
+        float scale = std::max({std::abs(box.Min.x), std::abs(box.Min.y), std::abs(box.Min.z),
+                                std::abs(box.Max.x), std::abs(box.Max.y), std::abs(box.Max.z), 1.0f});
+        return 16.0f * std::numeric_limits<float>::epsilon() * scale;
+    }
+
+    Piece MakePiece(float t0, float t1, int depth, std::vector<Vector3> points)
+    {
+        Piece piece{t0, t1, depth, std::move(points), AABB(), false};
+        piece.box = AABB::FromPoints(piece.points);
+        piece.flat = depth >= CurveQuery::kMaxDepth || piece.points.size() <= 2 ||
+                     Deviation(piece.points) <= std::max(CurveQuery::kFlatness * piece.box.Extent().magnitude(),
+                                                         RoundingFloor(piece.box));
+        return piece;
+    }
+
+    void Halve(const Piece& piece, Piece& first, Piece& second)
+    {
+        std::vector<Vector3> left, right;
+        Split(piece.points, left, right);
+        float middle = 0.5f * (piece.t0 + piece.t1);
+        first = MakePiece(piece.t0, middle, piece.depth + 1, std::move(left));
+        second = MakePiece(middle, piece.t1, piece.depth + 1, std::move(right));
+    }
+
+    std::vector<Piece> RootPieces(const std::vector<BezierPiece>& pieces)
+    {
+        std::vector<Piece> roots;
+        for (const BezierPiece& piece : pieces)
+        {
+            if (!piece.ControlPoints.empty())
+                roots.push_back(MakePiece(piece.T0, piece.T1, 0, piece.ControlPoints));
+        }
+        return roots;
+    }
+
+    // Distance to a point (Equ. 3)
+    struct PointMetric
+    {
+        Vector3 point;
+
+        bool MayContainCloser(const AABB& box, float best) const
+        {
+            return box.DistanceSquared(point) <= best * best;
+        }
+
+        float Distance(const Vector3& x, float& along) const
+        {
+            along = 0.0f;
+            return x.distance(point);
+        }
+
+        float ChordParameter(const Vector3& a, const Vector3& b) const
+        {
+            Vector3 ab = b - a;
+            float lengthSq = ab.dot(ab);
+            return lengthSq > 0.0f ? std::min(1.0f, std::max(0.0f, (point - a).dot(ab) / lengthSq)) : 0.0f;
+        }
+
+        void Residual(const Vector3& c, const Vector3& c1, const Vector3& c2, float& f, float& df) const
+        {
+            Vector3 q = c - point;
+            f = q.dot(c1);
+            df = c1.dot(c1) + q.dot(c2);
+        }
+    };
+
+    // Perpendicular distance to a ray (Equ. 4)
+    struct RayMetric
+    {
+        Vector3 origin;
+        Vector3 direction; // unit
+        Vector3 inverse;
+
+        bool MayContainCloser(const AABB& box, float best) const
+        {
+            Vector3 pad(best, best, best);
+            return AABB(box.Min - pad, box.Max + pad).IntersectsRay(origin, inverse, std::numeric_limits<float>::max());
+        }
+
+        float Distance(const Vector3& x, float& along) const
+        {
+            Vector3 q = x - origin;
+            along = std::max(0.0f, q.dot(direction));
+            return (q - direction * along).magnitude();
+        }
+
+        // Closest point of the chord to the ray line
+        float ChordParameter(const Vector3& a, const Vector3& b) const
+        {
+            Vector3 u = b - a;
+            Vector3 w = a - origin;
+            float uu = u.dot(u);
+            float ud = u.dot(direction);
+            float denominator = uu - ud * ud;
+            if (uu <= 0.0f || denominator <= 1e-12f * uu)
+                return 0.0f;
+            float s = (ud * w.dot(direction) - u.dot(w)) / denominator;
+            return std::min(1.0f, std::max(0.0f, s));
+        }
+
+        void Residual(const Vector3& c, const Vector3& c1, const Vector3& c2, float& f, float& df) const
+        {
+            Vector3 q = c - origin;
+            Vector3 r = q - direction * q.dot(direction);
+            Vector3 r1 = c1 - direction * c1.dot(direction);
+            Vector3 r2 = c2 - direction * c2.dot(direction);
+            f = r.dot(r1);
+            df = r1.dot(r1) + r.dot(r2);
+        }
+    };
+
+    // Newton on the stationarity condition of the metric (Equ. 3, 4)
+    template <typename Metric>
+    float Refine(const ParametricCurve& curve, const Metric& metric, float t)
+    {
+        for (int iteration = 0; iteration < 8; ++iteration)
+        {
+            float f = 0.0f, df = 0.0f;
+            metric.Residual(curve.Point(t), curve.FirstDerivative(t), curve.SecondDerivative(t), f, df);
+            if (!(df > 0.0f))
+                break; // not locally convex; keep the chord estimate
+            float next = std::min(1.0f, std::max(0.0f, t - f / df));
+            bool converged = std::abs(next - t) < 1e-7f;
+            t = next;
+            if (converged)
+                break;
+        }
+        return t;
+    }
+
+    template <typename Metric>
+    bool Search(const ParametricCurve& curve, const std::vector<BezierPiece>& pieces, const Metric& metric,
+                float limit, CurveHit& hit)
+    {
+        float best = limit;
+        bool found = false;
+        auto consider = [&](float t, const Vector3& point) {
+            float along = 0.0f;
+            float distance = metric.Distance(point, along);
+            if (distance <= best && (!found || distance < hit.Distance))
+            {
+                best = distance;
+                found = true;
+                hit = CurveHit{t, point, distance, along};
+            }
+        };
+
+        std::vector<Piece> stack = RootPieces(pieces);
+        std::reverse(stack.begin(), stack.end());
+        while (!stack.empty())
+        {
+            Piece piece = std::move(stack.back());
+            stack.pop_back();
+            if (!metric.MayContainCloser(piece.box, best))
+                continue;
+
+            if (piece.flat)
+            {
+                // End points lie on the curve; the chord estimate is refined on the full curve
+                const Vector3& a = piece.points.front();
+                const Vector3& b = piece.points.back();
+                consider(piece.t0, a);
+                consider(piece.t1, b);
+                float t = piece.t0 + metric.ChordParameter(a, b) * (piece.t1 - piece.t0);
+                t = Refine(curve, metric, t);
+                consider(t, curve.Point(t));
+                continue;
+            }
+
+            Piece first, second;
+            Halve(piece, first, second);
+
+            // Nearer half on top of the stack
+            float along = 0.0f;
+            if (metric.Distance(first.box.Center(), along) < metric.Distance(second.box.Center(), along))
+                std::swap(first, second);
+            stack.push_back(std::move(first));
+            stack.push_back(std::move(second));
+        }
+        return found;
+    }
+
+    // Closest points of the chords [a0, a1] and [b0, b1] as fractions (s, u) of each
+    void ChordPair(const Vector3& a0, const Vector3& a1, const Vector3& b0, const Vector3& b1, float& s, float& u)
+    {
+        Vector3 d1 = a1 - a0;
+        Vector3 d2 = b1 - b0;
+        Vector3 r = a0 - b0;
+        float a = d1.dot(d1);
+        float e = d2.dot(d2);
+        float f = d2.dot(r);
+        auto clamp = [](float x) { return std::min(1.0f, std::max(0.0f, x)); };
+        if (a <= 0.0f && e <= 0.0f)
+        {
+            s = u = 0.0f;
+            return;
+        }
+        if (a <= 0.0f)
+        {
+            s = 0.0f;
+            u = clamp(f / e);
+            return;
+        }
+        float c = d1.dot(r);
+        if (e <= 0.0f)
+        {
+            u = 0.0f;
+            s = clamp(-c / a);
+            return;
+        }
+        float b = d1.dot(d2);
+        float denominator = a * e - b * b;
+        s = denominator > 0.0f ? clamp((b * f - c * e) / denominator) : 0.0f;
+        u = (b * s + f) / e;
+        if (u < 0.0f)
+        {
+            u = 0.0f;
+            s = clamp(-c / a);
+        }
+        else if (u > 1.0f)
+        {
+            u = 1.0f;
+            s = clamp((b - c) / a);
+        }
+    }
+
+    // Newton on the gradient of |A(s) - B(u)|^2 / 2 (Equ. 5)
+    void RefinePair(const ParametricCurve& curveA, const ParametricCurve& curveB, float& s, float& u)
+    {
+        for (int iteration = 0; iteration < 8; ++iteration)
+        {
+            Vector3 a1 = curveA.FirstDerivative(s);
+            Vector3 b1 = curveB.FirstDerivative(u);
+            Vector3 d = curveA.Point(s) - curveB.Point(u);
+            float gs = d.dot(a1);
+            float gu = -d.dot(b1);
+            float hss = a1.dot(a1) + d.dot(curveA.SecondDerivative(s));
+            float huu = b1.dot(b1) - d.dot(curveB.SecondDerivative(u));
+            float hsu = -a1.dot(b1);
+            float determinant = hss * huu - hsu * hsu;
+            if (!(hss > 0.0f) || !(determinant > 0.0f))
+                break; // not locally convex; keep the chord estimate
+            float nextS = std::min(1.0f, std::max(0.0f, s - (huu * gs - hsu * gu) / determinant));
+            float nextU = std::min(1.0f, std::max(0.0f, u - (hss * gu - hsu * gs) / determinant));
+            bool converged = std::abs(nextS - s) < 1e-7f && std::abs(nextU - u) < 1e-7f;
+            s = nextS;
+            u = nextU;
+            if (converged)
+                break;
+        }
+    }
+}
+
+bool CurveQuery::ClosestPoint(const ParametricCurve& curve, const std::vector<BezierPiece>& pieces,
+                              const Vector3& point, float maxDistance, CurveHit& hit)
+{
+    return Search(curve, pieces, PointMetric{point}, maxDistance, hit);
+}
+
+bool CurveQuery::PickRay(const ParametricCurve& curve, const std::vector<BezierPiece>& pieces,
+                         const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit)
+{
+    float length = direction.magnitude();
+    if (length == 0.0f)
+        return false;
+    Vector3 unit = direction / length;
+    const float inf = std::numeric_limits<float>::infinity();
+    Vector3 inverse(unit.x != 0.0f ? 1.0f / unit.x : inf,
+                    unit.y != 0.0f ? 1.0f / unit.y : inf,
+                    unit.z != 0.0f ? 1.0f / unit.z : inf);
+    return Search(curve, pieces, RayMetric{origin, unit, inverse}, radius, hit);
+}
+
+bool CurveQuery::ClosestPoint(const ParametricCurve& curve, const Vector3& point, float maxDistance, CurveHit& hit)
+{
+    std::vector<BezierPiece> pieces;
+    curve.BezierPieces(pieces);
+    return ClosestPoint(curve, pieces, point, maxDistance, hit);
+}
+
+bool CurveQuery::PickRay(const ParametricCurve& curve, const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit)
+{
+    std::vector<BezierPiece> pieces;
+    curve.BezierPieces(pieces);
+    return PickRay(curve, pieces, origin, direction, radius, hit);
+}
+
+bool CurveQuery::ClosestPair(const ParametricCurve& curveA, const std::vector<BezierPiece>& piecesA,
+                             const ParametricCurve& curveB, const std::vector<BezierPiece>& piecesB,
+                             float maxDistance, CurvePairHit& hit)
+{
+    float best = maxDistance;
+    bool found = false;
+    auto consider = [&](float s, float u) {
+        Vector3 a = curveA.Point(s);
+        Vector3 b = curveB.Point(u);
+        float distance = a.distance(b);
+        if (distance <= best && (!found || distance < hit.Distance))
+        {
+            best = distance;
+            found = true;
+            hit = CurvePairHit{s, u, a, b, distance};
+        }
+    };
+
+    // Subdivision trees of both curves; a piece is split once and its halves shared by every pair
+    std::vector<Piece> treeA = RootPieces(piecesA);
+    std::vector<Piece> treeB = RootPieces(piecesB);
+    std::vector<std::size_t> childrenA(treeA.size(), 0); // Index of the first half, 0 = not split yet
+    std::vector<std::size_t> childrenB(treeB.size(), 0);
+    auto children = [](std::vector<Piece>& tree, std::vector<std::size_t>& index, std::size_t piece) {
+        if (index[piece] == 0)
+        {
+            Piece first, second;
+            Halve(tree[piece], first, second);
+            index[piece] = tree.size();
+            tree.push_back(std::move(first));
+            tree.push_back(std::move(second));
+            index.resize(tree.size(), 0);
+        }
+        return index[piece];
+    };
+
+    // Every root pair, then the larger non-flat side is split until both are flat (Equ. 2 on both boxes)
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    for (std::size_t a = 0; a < treeA.size(); ++a)
+    {
+        for (std::size_t b = 0; b < treeB.size(); ++b)
+            stack.emplace_back(a, b);
+    }
+    while (!stack.empty())
+    {
+        std::size_t indexA = stack.back().first;
+        std::size_t indexB = stack.back().second;
+        stack.pop_back();
+        const Piece& a = treeA[indexA];
+        const Piece& b = treeB[indexB];
+        if (a.box.DistanceSquared(b.box) > best * best)
+            continue;
+
+        if (a.flat && b.flat)
+        {
+            float s = 0.0f, u = 0.0f;
+            ChordPair(a.points.front(), a.points.back(), b.points.front(), b.points.back(), s, u);
+            s = a.t0 + s * (a.t1 - a.t0);
+            u = b.t0 + u * (b.t1 - b.t0);
+            consider(s, u);
+            RefinePair(curveA, curveB, s, u);
+            consider(s, u);
+            continue;
+        }
+
+        bool splitA = !a.flat && (b.flat || a.box.Extent().dot(a.box.Extent()) >= b.box.Extent().dot(b.box.Extent()));
+        if (splitA)
+        {
+            AABB other = b.box;
+            std::size_t first = children(treeA, childrenA, indexA);
+            // Nearer pair on top of the stack
+            bool firstNearer = treeA[first].box.DistanceSquared(other) < treeA[first + 1].box.DistanceSquared(other);
+            stack.emplace_back(firstNearer ? first + 1 : first, indexB);
+            stack.emplace_back(firstNearer ? first : first + 1, indexB);
+        }
+        else
+        {
+            AABB other = a.box;
+            std::size_t first = children(treeB, childrenB, indexB);
+            bool firstNearer = treeB[first].box.DistanceSquared(other) < treeB[first + 1].box.DistanceSquared(other);
+            stack.emplace_back(indexA, firstNearer ? first + 1 : first);
+            stack.emplace_back(indexA, firstNearer ? first : first + 1);
+        }
+    }
+    return found;
+}
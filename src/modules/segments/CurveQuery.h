@@ -0,0 +1,95 @@
+/**
+ * CurveQuery.h
+ * Linked file: CurveQuery.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Closest-point, ray-pick and curve-to-curve queries by control-polygon subdivision and Newton refinement
+ *
+ * Equations
+ * Equ(1): \vec{b_i^{(r)}}=\frac{1}{2}\left(\vec{b_i^{(r-1)}}+\vec{b_{i+1}^{(r-1)}}\right)   (de Casteljau split at the midpoint)
+ * Equ(2): \min_{t\in\left[t_a,t_b\right]}|\vec{C}\left(t\right)-\vec{p}|\ge\mathrm{dist}\left(\vec{p},\mathrm{box}\{\vec{b_i}\}\right)   (convex hull bound)
+ * Equ(3): f\left(t\right)=\left(\vec{C}-\vec{p}\right)\cdot\vec{C^\prime},\emsp f^\prime\left(t\right)=\vec{C^\prime}\cdot\vec{C^\prime}+\left(\vec{C}-\vec{p}\right)\cdot\vec{C^{\prime\prime}},\emsp t\leftarrow t-\frac{f}{f^\prime}
+ * Equ(4): \vec{r}\left(t\right)=\vec{q}-\left(\vec{q}\cdot\hat{d}\right)\hat{d},\emsp\vec{q}=\vec{C}\left(t\right)-\vec{o}   (offset from the ray line)
+ * Equ(5): \vec{d}=\vec{A}\left(s\right)-\vec{B}\left(u\right),\emsp\nabla=\begin{pmatrix}\vec{d}\cdot\vec{A^\prime}\\-\vec{d}\cdot\vec{B^\prime}\end{pmatrix},\emsp H=\begin{pmatrix}\vec{A^\prime}\cdot\vec{A^\prime}+\vec{d}\cdot\vec{A^{\prime\prime}}&-\vec{A^\prime}\cdot\vec{B^\prime}\\-\vec{A^\prime}\cdot\vec{B^\prime}&\vec{B^\prime}\cdot\vec{B^\prime}-\vec{d}\cdot\vec{B^{\prime\prime}}\end{pmatrix}
+ */
+
+#ifndef CURVEQUERY_H
+#define CURVEQUERY_H
+
+#include <vector>
+
+#include "Vector3.h"
+#include "ParametricCurve.h"
+
+/**
+ * @brief Result of a query against one curve
+ */
+struct CurveHit
+{
+    float Parameter;   // t on the curve
+    Vector3 Point;     // C(t)
+    float Distance;    // To the query point, or perpendicular to the ray
+    float RayDistance; // Along the ray to the foot of the perpendicular (0 for point queries)
+};
+
+/**
+ * @brief Result of a query between two curves
+ */
+struct CurvePairHit
+{
+    float ParameterA;
+    float ParameterB;
+    Vector3 PointA;
+    Vector3 PointB;
+    float Distance; // 0 where the curves cross
+};
+
+/**
+ * @brief Queries on curves that expose Bezier pieces (ParametricCurve::BezierPieces)
+ *
+ * Each piece is split at t = 1/2 (Equ. 1), nearer half first, and pruned with the box of its
+ * control points (Equ. 2) against the best distance so far. Flat pieces are resolved by
+ * projecting onto the chord and refining with Newton on the full curve (Equ. 3, 4), so the
+ * result is exact to float precision rather than to a sampling step. Stateless and
+ * thread-safe for a curve that is not being rebuilt.
+ */
+class CurveQuery
+{
+public:
+    // Relative flatness at which a piece stops splitting (control polygon deviation / chord);
+    // pieces at float rounding level, e.g. around a cusp, count as flat too
+    static constexpr float kFlatness = 1e-3f;
+    static constexpr int kMaxDepth = 24;
+
+    // Closest point on the curve to point; false if none is within maxDistance
+    static bool ClosestPoint(const ParametricCurve& curve, const std::vector<BezierPiece>& pieces,
+                             const Vector3& point, float maxDistance, CurveHit& hit);
+
+    /**
+     * @brief Curve point nearest to the ray origin + s * direction, s >= 0
+     *
+     * false if no point is within radius of the ray. direction need not be unit length;
+     * RayDistance is in world units.
+     */
+    static bool PickRay(const ParametricCurve& curve, const std::vector<BezierPiece>& pieces,
+                        const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit);
+
+    /**
+     * @brief Closest pair of points between two curves; false if none is within maxDistance
+     *
+     * Both control polygons are subdivided, the larger piece first, pruning pairs whose boxes
+     * are farther apart than the best distance so far; flat pairs start from the closest points
+     * of their chords and are refined with 2D Newton (Equ. 5).
+     */
+    static bool ClosestPair(const ParametricCurve& curveA, const std::vector<BezierPiece>& piecesA,
+                            const ParametricCurve& curveB, const std::vector<BezierPiece>& piecesB,
+                            float maxDistance, CurvePairHit& hit);
+
+    // Convenience overloads that take the pieces from the curve
+    static bool ClosestPoint(const ParametricCurve& curve, const Vector3& point, float maxDistance, CurveHit& hit);
+    static bool PickRay(const ParametricCurve& curve, const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit);
+};
+
+#endif // CURVEQUERY_H
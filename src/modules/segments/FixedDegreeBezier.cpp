@@ -0,0 +1,30 @@
+// FixedDegreeBezier.cpp
+
+#include "FixedDegreeBezier.h"
+
+namespace
+{
+    template <int N>
+    constexpr BezierKernelSet MakeSet()
+    {
+        return BezierKernelSet{N, &BezierKernel<N>::Point, &BezierKernel<N>::FirstDerivative,
+                               &BezierKernel<N>::SecondDerivative, &BezierKernel<N>::EvaluateRows};
+    }
+
+    template <std::size_t... I>
+    constexpr std::array<BezierKernelSet, sizeof...(I)> MakeTable(std::index_sequence<I...>)
+    {
+        return {MakeSet<FixedDegreeBezier::kMinDegree + static_cast<int>(I)>()...};
+    }
+
+    // Dispatch table indexed by degree - kMinDegree
+    constexpr std::array<BezierKernelSet, FixedDegreeBezier::kMaxDegree - FixedDegreeBezier::kMinDegree + 1> kKernels =
+        MakeTable(std::make_index_sequence<FixedDegreeBezier::kMaxDegree - FixedDegreeBezier::kMinDegree + 1>{});
+}
+
+const BezierKernelSet* FixedDegreeBezier::Find(int degree)
+{
+    if (degree < kMinDegree || degree > kMaxDegree)
+        return nullptr;
+    return &kKernels[degree - kMinDegree];
+}
@@ -0,0 +1,155 @@
+/**
+ * FixedDegreeBezier.h
+ * Linked file: FixedDegreeBezier.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Bezier kernels specialized per degree at compile time, selected through a dispatch table
+ *
+ * Equations
+ * Equ(1): \vec{B}\left(t\right)=\sum_{i=0}^{N}\binom{N}{i}\left(1-t\right)^{N-i}t^i\vec{P_i}
+ * Equ(2): \vec{B^\prime}\left(t\right)=N\sum_{i=0}^{N-1}\binom{N-1}{i}\left(1-t\right)^{N-1-i}t^i\left(\vec{P_{i+1}}-\vec{P_i}\right)
+ * Equ(3): \vec{B^{\prime\prime}}\left(t\right)=N\left(N-1\right)\sum_{i=0}^{N-2}\binom{N-2}{i}\left(1-t\right)^{N-2-i}t^i\left(\vec{P_{i+2}}-2\vec{P_{i+1}}+\vec{P_i}\right)
+ */
+
+#ifndef FIXEDDEGREEBEZIER_H
+#define FIXEDDEGREEBEZIER_H
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "Vector3.h"
+
+namespace FixedDegreeDetail
+{
+    // Binomial row of degree N as a constant array
+    template <int N>
+    constexpr std::array<float, N + 1> Binomials()
+    {
+        std::array<float, N + 1> row{};
+        row[0] = 1.0f;
+        for (int i = 1; i <= N; ++i)
+            row[i] = row[i - 1] * static_cast<float>(N - i + 1) / static_cast<float>(i);
+        return row;
+    }
+
+    // Bernstein sum of N + 1 points in nested (Horner) form; binomials are constants and the
+    // index_sequence expands every step at compile time
+    template <int N, std::size_t... I>
+    inline Vector3 Sum(const Vector3* points, float t, std::index_sequence<I...>)
+    {
+        constexpr std::array<float, N + 1> binomials = Binomials<N>();
+        if constexpr (N == 0)
+        {
+            return points[0];
+        }
+        else
+        {
+            const float u = 1.0f - t;
+            float tn = 1.0f;
+            Vector3 sum = points[0] * u;
+            // Steps i = 1..N-1: sum = (sum + C(N,i) t^i P_i) u
+            ((I >= 1 && I < N ? (tn *= t, sum = (sum + points[I] * (binomials[I] * tn)) * u, 0) : 0), ...);
+            return sum + points[N] * (tn * t);
+        }
+    }
+
+    // Row-by-row dot product with a precomputed basis table of N + 1 columns
+    template <int N, std::size_t... I>
+    inline void Rows(const Vector3* points, const float* weights, int rows, Vector3* out, std::index_sequence<I...>)
+    {
+        const float px[N + 1] = {points[I].x...};
+        const float py[N + 1] = {points[I].y...};
+        const float pz[N + 1] = {points[I].z...};
+        for (int k = 0; k < rows; ++k)
+        {
+            const float* row = weights + static_cast<std::size_t>(k) * (N + 1);
+            out[k] = Vector3(((row[I] * px[I]) + ...), ((row[I] * py[I]) + ...), ((row[I] * pz[I]) + ...));
+        }
+    }
+
+    template <int N, std::size_t... I>
+    inline void Differences(const Vector3* points, Vector3* out, std::index_sequence<I...>)
+    {
+        ((out[I] = points[I + 1] - points[I]), ...);
+    }
+}
+
+/**
+ * @brief Kernels for one degree N (N + 1 control points)
+ */
+template <int N>
+struct BezierKernel
+{
+    static_assert(N >= 1, "degree 0 is a constant and needs no kernel");
+
+    // Equ. 1
+    static Vector3 Point(const Vector3* points, float t)
+    {
+        return FixedDegreeDetail::Sum<N>(points, t, std::make_index_sequence<N + 1>{});
+    }
+
+    // Equ. 2
+    static Vector3 FirstDerivative(const Vector3* points, float t)
+    {
+        Vector3 d[N];
+        FixedDegreeDetail::Differences<N>(points, d, std::make_index_sequence<N>{});
+        return FixedDegreeDetail::Sum<N - 1>(d, t, std::make_index_sequence<N>{}) * static_cast<float>(N);
+    }
+
+    // Equ. 3
+    static Vector3 SecondDerivative(const Vector3* points, float t)
+    {
+        if constexpr (N < 2)
+        {
+            return Vector3();
+        }
+        else
+        {
+            Vector3 d[N];
+            Vector3 dd[N - 1];
+            FixedDegreeDetail::Differences<N>(points, d, std::make_index_sequence<N>{});
+            FixedDegreeDetail::Differences<N - 1>(d, dd, std::make_index_sequence<N - 1>{});
+            return FixedDegreeDetail::Sum<N - 2>(dd, t, std::make_index_sequence<N - 1>{}) * static_cast<float>(N * (N - 1));
+        }
+    }
+
+    // Uniform samples from a BernsteinBasis weight table with N + 1 columns
+    static void EvaluateRows(const Vector3* points, const float* weights, int rows, Vector3* out)
+    {
+        FixedDegreeDetail::Rows<N>(points, weights, rows, out, std::make_index_sequence<N + 1>{});
+    }
+};
+
+/**
+ * @brief Function table for one degree
+ */
+struct BezierKernelSet
+{
+    int Degree;
+    Vector3 (*Point)(const Vector3*, float);
+    Vector3 (*FirstDerivative)(const Vector3*, float);
+    Vector3 (*SecondDerivative)(const Vector3*, float);
+    void (*EvaluateRows)(const Vector3*, const float*, int, Vector3*);
+};
+
+/**
+ * @brief Runtime dispatch over the compiled degrees
+ */
+class FixedDegreeBezier
+{
+public:
+    static constexpr int kMinDegree = 1;
+    static constexpr int kMaxDegree = 10;
+
+    // Kernel set for degree, or nullptr if it is outside [kMinDegree, kMaxDegree]
+    static const BezierKernelSet* Find(int degree);
+    static const BezierKernelSet* ForControlPoints(const std::vector<Vector3>& controlPoints)
+    {
+        return Find(static_cast<int>(controlPoints.size()) - 1);
+    }
+};
+
+#endif // FIXEDDEGREEBEZIER_H
@@ -1,21 +1,36 @@
 // LinearSegment.cpp
 
 #include "LinearSegment.h"
+#include "EditEpoch.h"
+#include <atomic>
 #include <cmath>
 #include <iostream>
 
 // Constructor
-LinearSegment::LinearSegment(const Vertex& start, const Vertex& end, float alpha, int numSegments)
+LinearSegment::LinearSegment(const Vertex& start, const Vertex& end, float alpha, int numSegments, bool deferred)
     : index(0), // Initialize index (modify as needed)
       LOD(1),    // Initialize LOD (default to 1)
-      startVertex(start),
-      endVertex(end),
+      startVertex(&start),
+      endVertex(&end),
       alpha(alpha),
       numSegments(numSegments),
-      _linearSegmentCache(std::make_shared<std::vector<Vector3>>())
+      bezierMethod(BezierMethod::FixedDegree),
+      tessellationMode(TessellationMode::Uniform),
+      adaptiveOptions(),
+      curveRepresentation(CurveRepresentation::Bezier),
+      bsplineKnots(BSplineKnots::Clamped),
+      _snapshot(std::make_shared<LinearSegmentSnapshot>()),
+      _arcLengthTable(),
+      _startVersion(0),
+      _endVersion(0),
+      _rebuildCount(0),
+      _dirty(deferred),
+      _deferredRecompute(deferred),
+      _batchDepth(0)
 {
-    // Automatically perform calculations upon creation
-    CreateBSpline();
+    // Automatically perform calculations upon creation, unless the owner builds later (SegmentManager)
+    if (!deferred)
+        CreateBSpline();
 }
 
 // Destructor
@@ -94,28 +109,26 @@ std::vector<Vector3> LinearSegment::CalculateControlPoints(float alpha) const
     std::vector<Vector3> controlPoints;
 
     // P0 = StartVertex's NodeVector (Equ. 17)
-    controlPoints.push_back(startVertex.ReadNodeVector().Vector);
+    controlPoints.push_back(startVertex->ReadNodeVector().Vector);
     // std::cout << "P0: " << controlPoints.back() << std::endl;
 
     // P1 ~ P_D1 (Equ. 18)
-    const std::vector<BearingVector>& startBearings = startVertex.ReadBearingVectorList();
     std::vector<Vector3> C_start;
-    for (const auto& bearing : startBearings)
+    for (std::size_t i = 0; i < startVertex->BearingCount(); ++i)
     {
-        Vector3 C_i = bearing.Vector * bearing.Force.magnitude(); // Assuming Force magnitude as scalar
+        Vector3 C_i = startVertex->ReadBearingDirection(i) * startVertex->ReadBearingForce(i).magnitude(); // Assuming Force magnitude as scalar
         C_start.push_back(C_i);
-        Vector3 Pi = startVertex.ReadNodeVector().Vector + C_i;
+        Vector3 Pi = startVertex->ReadNodeVector().Vector + C_i;
         controlPoints.push_back(Pi);
         // std::cout << "Pi: " << Pi << std::endl;
     }
 
     // P_(D1+1) = alpha * (N1 + C_(1,D1)) + (1 - alpha) * (N2 - C_(2,D2)) (Equ. 19)
     Vector3 C_end;
-    const std::vector<BearingVector>& endBearings = endVertex.ReadBearingVectorList();
-    if (!endBearings.empty())
+    const std::size_t endBearingCount = endVertex->BearingCount();
+    if (endBearingCount != 0)
     {
-        const auto& lastBearingEnd = endBearings.back();
-        C_end = lastBearingEnd.Vector * lastBearingEnd.Force.magnitude(); // Assuming Force magnitude as scalar
+        C_end = endVertex->ReadBearingDirection(endBearingCount - 1) * endVertex->ReadBearingForce(endBearingCount - 1).magnitude(); // Assuming Force magnitude as scalar
     }
     else
     {
@@ -125,65 +138,164 @@ std::vector<Vector3> LinearSegment::CalculateControlPoints(float alpha) const
     Vector3 P_D1_plus_1;
     if (!C_start.empty())
     {
-        P_D1_plus_1 = (startVertex.ReadNodeVector().Vector + C_start.back()) * alpha +
-                      (endVertex.ReadNodeVector().Vector - C_end) * (1.0f - alpha);
+        P_D1_plus_1 = (startVertex->ReadNodeVector().Vector + C_start.back()) * alpha +
+                      (endVertex->ReadNodeVector().Vector - C_end) * (1.0f - alpha);
     }
     else
     {
-        P_D1_plus_1 = startVertex.ReadNodeVector().Vector * alpha +
-                      (endVertex.ReadNodeVector().Vector - C_end) * (1.0f - alpha);
+        P_D1_plus_1 = startVertex->ReadNodeVector().Vector * alpha +
+                      (endVertex->ReadNodeVector().Vector - C_end) * (1.0f - alpha);
     }
     controlPoints.push_back(P_D1_plus_1);
     // std::cout << "P_D1_plus_1: " << P_D1_plus_1 << std::endl;
 
     // P_(D1+2) ~ P_n-1 (Equ. 20)
-    for (int j = static_cast<int>(endBearings.size()) - 1; j >= 0; --j)
+    for (int j = static_cast<int>(endBearingCount) - 1; j >= 0; --j)
     {
-        const auto& bearingEnd = endBearings[j];
-        Vector3 C_j = bearingEnd.Vector * bearingEnd.Force.magnitude(); // Assuming Force magnitude as scalar
-        Vector3 Pj = endVertex.ReadNodeVector().Vector - C_j; // Equ. 19에 따라 수정
+        Vector3 C_j = endVertex->ReadBearingDirection(j) * endVertex->ReadBearingForce(j).magnitude(); // Assuming Force magnitude as scalar
+        Vector3 Pj = endVertex->ReadNodeVector().Vector - C_j; // Equ. 19에 따라 수정
         controlPoints.push_back(Pj);
         // std::cout << "Pj: " << Pj << std::endl;
     }
 
     // Pn = EndVertex's NodeVector (Equ. 21)
-    controlPoints.push_back(endVertex.ReadNodeVector().Vector);
-    // std::cout << "Pn: " << endVertex.ReadNodeVector().Vector << std::endl;
+    controlPoints.push_back(endVertex->ReadNodeVector().Vector);
+    // std::cout << "Pn: " << endVertex->ReadNodeVector().Vector << std::endl;
 
     return controlPoints;
 }
 
-// Create B-Spline Line
-void LinearSegment::CreateBSpline()
+// Create B-Spline Line; builds into a fresh snapshot and publishes it at the end
+void LinearSegment::CreateBSpline() const
 {
+    auto snapshot = std::make_shared<LinearSegmentSnapshot>();
+
+    // Record the versions before reading the vertices
+    snapshot->StartVersion = startVertex->GetVersion();
+    snapshot->EndVersion = endVertex->GetVersion();
+    _startVersion = snapshot->StartVersion;
+    _endVersion = snapshot->EndVersion;
+    ++_rebuildCount;
+    _dirty = false;
+    _arcLengthTable.reset();
+
     // Calculate control points using the member variable alpha
     std::vector<Vector3> controlPoints = CalculateControlPoints(alpha);
+    snapshot->Derivatives = std::make_shared<CurveDerivatives>(controlPoints);
+    snapshot->Bounds = AABB::FromPoints(controlPoints);
+    std::vector<Vector3>& points = snapshot->Points;
+    std::vector<float>& params = snapshot->Parameters;
+    if (curveRepresentation == CurveRepresentation::PiecewiseCubic)
+    {
+        // Same control polygon, local support, O(1) per sample
+        snapshot->Curve = std::make_shared<CubicBSpline>(controlPoints, bsplineKnots);
+        if (tessellationMode == TessellationMode::Adaptive)
+        {
+            AdaptiveTessellator::Tessellate(*snapshot->Curve, adaptiveOptions, points, params);
+        }
+        else
+        {
+            snapshot->Curve->EvaluateUniform(numSegments, points);
+        }
+    }
+    else
+    {
+        snapshot->Curve = snapshot->Derivatives;
 
-    // Calculate B-Spline (approximated using Bezier curve)
-    _linearSegmentCache->clear();
-    for (int i = 0; i <= numSegments; ++i)
+        // Calculate B-Spline (approximated using Bezier curve) with the selected back end
+        const BezierEvaluator& evaluator = BezierEvaluator::Get(bezierMethod);
+        if (tessellationMode == TessellationMode::Adaptive)
+        {
+            AdaptiveTessellator::Tessellate(*snapshot->Derivatives, adaptiveOptions, evaluator, points, params);
+        }
+        else
+        {
+            evaluator.EvaluateUniform(controlPoints, numSegments, points);
+        }
+    }
+
+    if (tessellationMode == TessellationMode::Uniform)
     {
-        float t = static_cast<float>(i) / numSegments;
-        Vector3 point = BezierPoint(controlPoints, t);
-        _linearSegmentCache->push_back(point);
+        params.resize(points.size());
+        for (std::size_t i = 0; i < params.size(); ++i)
+        {
+            params[i] = numSegments > 0 ? static_cast<float>(i) / numSegments : 0.0f;
+        }
     }
+
+    snapshot->Curve->BezierPieces(snapshot->BezierPieces);
+
+    // Decimations for every zoom level, built once per tessellation
+    snapshot->Lod.Build(points);
+
+    // Publish; readers holding the previous snapshot keep it until they drop it
+    std::atomic_store(&_snapshot, std::shared_ptr<const LinearSegmentSnapshot>(std::move(snapshot)));
+}
+
+// Rebuild lazily when a vertex changed
+bool LinearSegment::IsStale() const
+{
+    return _dirty || startVertex->GetVersion() != _startVersion || endVertex->GetVersion() != _endVersion;
+}
+
+void LinearSegment::RefreshIfStale() const
+{
+    if (IsStale())
+        CreateBSpline();
+}
+
+// Mark dirty; rebuild at once only outside deferred mode and batch edits
+void LinearSegment::Invalidate()
+{
+    _dirty = true;
+    EditEpoch::Advance();
+    if (!_deferredRecompute && _batchDepth == 0)
+        CreateBSpline();
+}
+
+void LinearSegment::Commit()
+{
+    RefreshIfStale();
+}
+
+void LinearSegment::SetDeferredRecompute(bool deferred)
+{
+    _deferredRecompute = deferred;
+    // Leaving deferred mode restores the eager contract
+    if (!deferred && _batchDepth == 0)
+        RefreshIfStale();
+}
+
+// Batch edit guard
+LinearSegment::BatchEdit::BatchEdit(LinearSegment& segment)
+    : _segment(segment)
+{
+    ++_segment._batchDepth;
+}
+
+LinearSegment::BatchEdit::~BatchEdit()
+{
+    if (--_segment._batchDepth == 0 && !_segment._deferredRecompute && _segment._dirty)
+        _segment.CreateBSpline();
 }
 
 // Create Polygon Vertices Based on LOD
 std::vector<Vector3> LinearSegment::CreatePolygonVertices(int lod) const
 {
+    RefreshIfStale();
+    const std::vector<Vector3>& cache = _snapshot->Points;
     std::vector<Vector3> polygonVertices;
 
     // Implement vertex creation logic based on LOD (Equ. 26~29)
-    if (!_linearSegmentCache->empty())
+    if (!cache.empty())
     {
-        int step = std::max(1, static_cast<int>(_linearSegmentCache->size()) / lod);
-        for (size_t i = 0; i < _linearSegmentCache->size(); i += step)
+        int step = std::max(1, static_cast<int>(cache.size()) / lod);
+        for (size_t i = 0; i < cache.size(); i += step)
         {
-            polygonVertices.push_back((*_linearSegmentCache)[i]);
+            polygonVertices.push_back(cache[i]);
         }
         // Add the last point if not already included
-        const Vector3& lastPoint = _linearSegmentCache->back();
+        const Vector3& lastPoint = cache.back();
         if (polygonVertices.empty() ||
             std::abs(polygonVertices.back().x - lastPoint.x) > 1e-5 ||
             std::abs(polygonVertices.back().y - lastPoint.y) > 1e-5 ||
@@ -196,60 +308,235 @@ std::vector<Vector3> LinearSegment::CreatePolygonVertices(int lod) const
     return polygonVertices;
 }
 
-// Get Cached Segment Data
-std::shared_ptr<std::vector<Vector3>> LinearSegment::GetLinearSegmentCache() const
+// Published build, as is
+std::shared_ptr<const LinearSegmentSnapshot> LinearSegment::GetSnapshot() const
 {
-    return _linearSegmentCache;
+    return std::atomic_load(&_snapshot);
 }
 
-// Calculate Curvature (Equ. 22)
+// Get Cached Segment Data; shares ownership of the whole snapshot
+std::shared_ptr<const std::vector<Vector3>> LinearSegment::GetLinearSegmentCache() const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    return std::shared_ptr<const std::vector<Vector3>>(snapshot, &snapshot->Points);
+}
+
+// Get Cached Segment Parameters
+std::shared_ptr<const std::vector<float>> LinearSegment::GetLinearSegmentParameters() const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    return std::shared_ptr<const std::vector<float>>(snapshot, &snapshot->Parameters);
+}
+
+// LOD pyramid access
+std::shared_ptr<const LodPyramid> LinearSegment::GetLodPyramid() const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    return std::shared_ptr<const LodPyramid>(snapshot, &snapshot->Lod);
+}
+
+std::shared_ptr<const std::vector<Vector3>> LinearSegment::ReadLodPoints(float maxError) const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    if (snapshot->Lod.Empty())
+        return std::shared_ptr<const std::vector<Vector3>>(snapshot, &snapshot->Points);
+    return std::shared_ptr<const std::vector<Vector3>>(snapshot, &snapshot->Lod.Level(snapshot->Lod.SelectLevel(maxError)).Points);
+}
+
+std::shared_ptr<const std::vector<Vector3>> LinearSegment::ReadLodPointsForScreen(float maxPixelError, float pixelsPerWorldUnit) const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    if (snapshot->Lod.Empty())
+        return std::shared_ptr<const std::vector<Vector3>>(snapshot, &snapshot->Points);
+    return std::shared_ptr<const std::vector<Vector3>>(snapshot, &snapshot->Lod.Level(snapshot->Lod.SelectLevelForScreen(maxPixelError, pixelsPerWorldUnit)).Points);
+}
+
+// Arc-length table, built on first use
+std::shared_ptr<const ArcLengthTable> LinearSegment::GetArcLengthTable() const
+{
+    RefreshIfStale();
+    if (!_arcLengthTable)
+        _arcLengthTable = std::make_shared<ArcLengthTable>(_snapshot->Curve);
+    return _arcLengthTable;
+}
+
+float LinearSegment::CalculateLength() const
+{
+    return GetArcLengthTable()->TotalLength();
+}
+
+float LinearSegment::ParameterAtLength(float s) const
+{
+    return GetArcLengthTable()->ParameterAt(s);
+}
+
+std::vector<Vector3> LinearSegment::ResampleByArcLength(int count) const
+{
+    std::vector<Vector3> points;
+    GetArcLengthTable()->Resample(count, points);
+    return points;
+}
+
+// Control polygon box
+AABB LinearSegment::GetBounds() const
+{
+    RefreshIfStale();
+    return _snapshot->Bounds;
+}
+
+// Curve queries
+std::shared_ptr<const std::vector<BezierPiece>> LinearSegment::GetBezierPieces() const
+{
+    RefreshIfStale();
+    std::shared_ptr<const LinearSegmentSnapshot> snapshot = GetSnapshot();
+    return std::shared_ptr<const std::vector<BezierPiece>>(snapshot, &snapshot->BezierPieces);
+}
+
+bool LinearSegment::ClosestPoint(const Vector3& point, float maxDistance, CurveHit& hit) const
+{
+    RefreshIfStale();
+    return CurveQuery::ClosestPoint(*_snapshot->Curve, _snapshot->BezierPieces, point, maxDistance, hit);
+}
+
+bool LinearSegment::PickRay(const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit) const
+{
+    RefreshIfStale();
+    return CurveQuery::PickRay(*_snapshot->Curve, _snapshot->BezierPieces, origin, direction, radius, hit);
+}
+
+bool LinearSegment::ClosestPair(const LinearSegment& other, float maxDistance, CurvePairHit& hit) const
+{
+    RefreshIfStale();
+    other.RefreshIfStale();
+    const LinearSegmentSnapshot& a = *_snapshot;
+    const LinearSegmentSnapshot& b = *other._snapshot;
+    return CurveQuery::ClosestPair(*a.Curve, a.BezierPieces, *b.Curve, b.BezierPieces, maxDistance, hit);
+}
+
+bool LinearSegment::SharesVertex(const LinearSegment& other) const
+{
+    return startVertex == other.startVertex || startVertex == other.endVertex ||
+           endVertex == other.startVertex || endVertex == other.endVertex;
+}
+
+// Same logical vertices at a new address; versions decide whether the cache is still current
+void LinearSegment::Rebind(const Vertex& start, const Vertex& end)
+{
+    startVertex = &start;
+    endVertex = &end;
+    EditEpoch::Advance();
+}
+
+// Calculate Curvature (Equ. 22) from the cached hodographs
 float LinearSegment::CalculateCurvature(float t) const
 {
-    // Retrieve control points (ensure the same alpha is used)
-    std::vector<Vector3> controlPoints = CalculateControlPoints(alpha);
+    RefreshIfStale();
+    return _snapshot->Curve->Curvature(t).Curvature;
+}
 
-    // Calculate first and second derivatives
-    Vector3 B_prime = BezierFirstDerivative(controlPoints, t);
-    Vector3 B_double_prime = BezierSecondDerivative(controlPoints, t);
+// Cached control points and hodographs
+std::shared_ptr<const CurveDerivatives> LinearSegment::GetCurveDerivatives() const
+{
+    RefreshIfStale();
+    return _snapshot->Derivatives;
+}
 
-    // Calculate curvature: |B''(t) × B'(t)| / |B'(t)|^3 (Equ. 22)
-    Vector3 crossProd = B_double_prime.cross(B_prime);
-    float numerator = crossProd.magnitude();
-    float denominator = powf(B_prime.magnitude(), 3);
+std::shared_ptr<const ParametricCurve> LinearSegment::GetCurve() const
+{
+    RefreshIfStale();
+    return _snapshot->Curve;
+}
 
-    if (denominator == 0.0f)
-        return 0.0f;
+// Batch curvature profile
+void LinearSegment::CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const
+{
+    RefreshIfStale();
+    _snapshot->Curve->CurvatureProfile(ts, count, out);
+}
 
-    return numerator / denominator;
+std::vector<CurvatureSample> LinearSegment::CurvatureProfile(const std::vector<float>& ts) const
+{
+    RefreshIfStale();
+    return _snapshot->Curve->CurvatureProfile(ts);
 }
 
-// Setter for LOD
+// Setter for LOD; LOD only affects CreatePolygonVertices, so the cache stays valid
 void LinearSegment::SetLOD(int newLOD)
 {
     LOD = newLOD;
-    // Automatically perform calculations upon update
-    CreateBSpline();
 }
 
 // Setter for alpha
 void LinearSegment::SetAlpha(float newAlpha)
 {
+    if (alpha == newAlpha)
+        return;
     alpha = newAlpha;
-    // Automatically perform calculations upon update
-    CreateBSpline();
+    Invalidate();
 }
 
 // Setter for numSegments
 void LinearSegment::SetNumSegments(int newNumSegments)
 {
+    if (numSegments == newNumSegments)
+        return;
     numSegments = newNumSegments;
-    // Automatically perform calculations upon update
-    CreateBSpline();
+    Invalidate();
+}
+
+// Setter for Bezier evaluation back end
+void LinearSegment::SetBezierMethod(BezierMethod newMethod)
+{
+    if (bezierMethod == newMethod)
+        return;
+    bezierMethod = newMethod;
+    Invalidate();
+}
+
+// Setter for sampling strategy
+void LinearSegment::SetTessellationMode(TessellationMode newMode)
+{
+    if (tessellationMode == newMode)
+        return;
+    tessellationMode = newMode;
+    Invalidate();
+}
+
+// Setter for adaptive tolerances; only rebuilds while in adaptive mode
+void LinearSegment::SetAdaptiveOptions(const AdaptiveTessellationOptions& newOptions)
+{
+    adaptiveOptions = newOptions;
+    if (tessellationMode == TessellationMode::Adaptive)
+        Invalidate();
+}
+
+// Setter for curve representation
+void LinearSegment::SetCurveRepresentation(CurveRepresentation newRepresentation)
+{
+    if (curveRepresentation == newRepresentation)
+        return;
+    curveRepresentation = newRepresentation;
+    Invalidate();
+}
+
+// Setter for B-spline knot layout; only rebuilds while the B-spline is active
+void LinearSegment::SetBSplineKnots(BSplineKnots newKnots)
+{
+    if (bsplineKnots == newKnots)
+        return;
+    bsplineKnots = newKnots;
+    if (curveRepresentation == CurveRepresentation::PiecewiseCubic)
+        Invalidate();
 }
 
 // Output Operator Overload Definition
 std::ostream& operator<<(std::ostream& os, const LinearSegment& ls)
 {
-    os << "LinearSegment(StartVertex: " << ls.startVertex << ", EndVertex: " << ls.endVertex << ")";
+    os << "LinearSegment(StartVertex: " << *ls.startVertex << ", EndVertex: " << *ls.endVertex << ")";
     return os;
 }
@@ -33,6 +33,34 @@
 
 #include "Vertex.h"
 #include "Vector3.h"
+#include "BezierEvaluator.h"
+#include "AdaptiveTessellator.h"
+#include "LodPyramid.h"
+#include "ArcLengthTable.h"
+#include "CurveDerivatives.h"
+#include "CubicBSpline.h"
+#include "AABB.h"
+#include "CurveQuery.h"
+
+/**
+ * @brief Immutable result of one LinearSegment build
+ *
+ * CreateBSpline fills a fresh snapshot and publishes it with a single atomic store, so a
+ * reader on another thread sees either the previous build or the next one, never a half-built
+ * vector. Whatever a reader holds stays valid until it lets go; the last holder frees it.
+ */
+struct LinearSegmentSnapshot
+{
+    std::vector<Vector3> Points;    // Sampled curve (GetLinearSegmentCache)
+    std::vector<float> Parameters;  // Curve parameter t of every point
+    LodPyramid Lod;                 // Decimations of Points for every zoom level
+    std::shared_ptr<const CurveDerivatives> Derivatives; // Control points and hodographs of the Bezier
+    std::shared_ptr<const ParametricCurve> Curve;        // Active representation
+    AABB Bounds;                    // Box of the control polygon (Equ. 8 convex hull)
+    std::vector<BezierPiece> BezierPieces; // Bezier form of Curve for CurveQuery
+    uint64_t StartVersion = 0;      // Vertex versions the build read
+    uint64_t EndVersion = 0;
+};
 
 /**
  * @brief LinearSegment class
@@ -45,22 +73,42 @@ private:
     // Parameters to be saved.
     int index;
     int LOD;
-    const Vertex& startVertex;
-    const Vertex& endVertex;
+    const Vertex* startVertex; // Never null; a pointer so the owner can rebind after moving the vertex
+    const Vertex* endVertex;
 
     // New Parameters for automatic calculations
     float alpha;
     int numSegments;
+    BezierMethod bezierMethod;
+    TessellationMode tessellationMode;
+    AdaptiveTessellationOptions adaptiveOptions;
+    CurveRepresentation curveRepresentation;
+    BSplineKnots bsplineKnots;
+
+    // Last published build; only ever replaced, never modified (std::atomic_load / std::atomic_store)
+    mutable std::shared_ptr<const LinearSegmentSnapshot> _snapshot;
+
+    // Arc-length table of the current control points; built on first length query
+    mutable std::shared_ptr<const ArcLengthTable> _arcLengthTable;
+
+    // Vertex versions the published snapshot was built from (Vertex::GetVersion); writer side only
+    mutable uint64_t _startVersion;
+    mutable uint64_t _endVersion;
+    mutable std::size_t _rebuildCount;
 
-    // Cached Sampling data.
-    std::shared_ptr<std::vector<Vector3>> _linearSegmentCache;
+    // Deferred recompute: setters only mark the cache dirty (see SetDeferredRecompute, BatchEdit)
+    mutable bool _dirty;
+    bool _deferredRecompute;
+    int _batchDepth;
 
     // Calculation Methods
     Vector3 BezierPoint(const std::vector<Vector3>& controlPoints, float t) const;
     float BinomialCoefficient(int n, int k) const;
     Vector3 BezierFirstDerivative(const std::vector<Vector3>& controlPoints, float t) const;
     Vector3 BezierSecondDerivative(const std::vector<Vector3>& controlPoints, float t) const;
-    void CreateBSpline(); // Modified to use member variables
+    void CreateBSpline() const; // Modified to use member variables
+    void RefreshIfStale() const;
+    void Invalidate();
     std::vector<Vector3> CreatePolygonVertices(int lod) const;
 
     // FRIEND_TEST declarations
@@ -72,10 +120,40 @@ private:
     FRIEND_TEST(LinearSegmentTest, AutomaticBSplineOnNumSegmentsUpdate);
     FRIEND_TEST(LinearSegmentTest, AutomaticBSplineOnStartVertexUpdate);
     FRIEND_TEST(LinearSegmentTest, AutomaticBSplineOnEndVertexUpdate);
+    FRIEND_TEST(LinearSegmentTest, BezierMethodsMatchBezierPoint);
+    FRIEND_TEST(LinearSegmentTest, CurvatureFromBasisTableMatchesDirect);
+    FRIEND_TEST(LinearSegmentTest, RebuildsOnlyWhenVertexVersionChanges);
+    FRIEND_TEST(LinearSegmentTest, DeferredSettersRebuildOnce);
+    FRIEND_TEST(LinearSegmentTest, BatchEditRebuildsOnceOnExit);
+    FRIEND_TEST(LinearSegmentTest, AdaptiveModeUsesFewerPoints);
+    FRIEND_TEST(LinearSegmentTest, LodPyramidFollowsCache);
+    FRIEND_TEST(LinearSegmentTest, ArcLengthResamplingIsEquallySpaced);
+    FRIEND_TEST(LinearSegmentTest, CurvatureProfileMatchesScalar);
+    FRIEND_TEST(LinearSegmentTest, PiecewiseCubicMatchesBezierWhereExpected);
+    FRIEND_TEST(LinearSegmentTest, BoundsContainCurveAndFollowEdits);
+    FRIEND_TEST(LinearSegmentTest, ClosestPointAndPickMatchDenseSampling);
 
 public:
-    // Constructors and Destructors
-    LinearSegment(const Vertex& start, const Vertex& end, float alpha = 0.5f, int numSegments = 100);
+    /**
+     * @brief Scoped batch edit; setters inside the scope only mark the segment dirty
+     *
+     * The outermost guard commits on exit unless deferred recompute is enabled, in which case
+     * the rebuild waits for the next read. Guards nest.
+     */
+    class BatchEdit
+    {
+    public:
+        explicit BatchEdit(LinearSegment& segment);
+        ~BatchEdit();
+        BatchEdit(const BatchEdit&) = delete;
+        BatchEdit& operator=(const BatchEdit&) = delete;
+
+    private:
+        LinearSegment& _segment;
+    };
+
+    // Constructors and Destructors; deferred == true skips the initial build and starts in deferred mode
+    LinearSegment(const Vertex& start, const Vertex& end, float alpha = 0.5f, int numSegments = 100, bool deferred = false);
     ~LinearSegment();
 
     // Output Operator Overload Declaration
@@ -83,22 +161,108 @@ public:
 
     // Getter Methods
     int ReadLOD() const { return LOD; }
+    BezierMethod ReadBezierMethod() const { return bezierMethod; }
+    TessellationMode ReadTessellationMode() const { return tessellationMode; }
+    const AdaptiveTessellationOptions& ReadAdaptiveOptions() const { return adaptiveOptions; }
+    CurveRepresentation ReadCurveRepresentation() const { return curveRepresentation; }
+    BSplineKnots ReadBSplineKnots() const { return bsplineKnots; }
 
     // Vertex 기반 Getter 메소드 추가
-    const Vertex& GetStartVertex() const { return startVertex; }
-    const Vertex& GetEndVertex() const { return endVertex; }
+    const Vertex& GetStartVertex() const { return *startVertex; }
+    const Vertex& GetEndVertex() const { return *endVertex; }
 
-    // Setter Methods
+    /**
+     * @brief Point the segment at its vertices' new addresses after the owner moved them
+     *
+     * For relocating storage (ObjectManager); the vertices must be the same ones, moved. A moved
+     * Vertex keeps its version, so the cache stays valid unless the vertex was also edited.
+     */
+    void Rebind(const Vertex& start, const Vertex& end);
+
+    // Setter Methods; SetLOD never touches the cache
     void SetLOD(int newLOD);
     void SetAlpha(float newAlpha);
     void SetNumSegments(int newNumSegments);
+    void SetBezierMethod(BezierMethod newMethod);
+    void SetTessellationMode(TessellationMode newMode);
+    void SetAdaptiveOptions(const AdaptiveTessellationOptions& newOptions);
+    void SetCurveRepresentation(CurveRepresentation newRepresentation);
+    void SetBSplineKnots(BSplineKnots newKnots);
+
+    // Deferred mode: setters mark dirty, the cache is rebuilt on the next read or Commit()
+    void SetDeferredRecompute(bool deferred);
+    bool IsDeferredRecompute() const { return _deferredRecompute; }
+
+    // Rebuild now if a setter or a vertex edit left the cache out of date
+    void Commit();
+
+    /**
+     * @brief Last published build, without checking the vertices; safe from any thread
+     *
+     * The getters below first rebuild when something changed, so they belong to the thread that
+     * edits the segment (or to phases when nothing edits it). Other threads, e.g. HTTP handlers
+     * while the solver runs, read through GetSnapshot and see the build as of the last Commit.
+     */
+    std::shared_ptr<const LinearSegmentSnapshot> GetSnapshot() const;
+
+    // Access Cached Data; rebuilt first if either vertex changed since the last build. The vector
+    // is part of a snapshot and never changes; a rebuild publishes a new one
+    std::shared_ptr<const std::vector<Vector3>> GetLinearSegmentCache() const;
 
-    // Access Cached Data
-    std::shared_ptr<std::vector<Vector3>> GetLinearSegmentCache() const;
+    // Curve parameter t of every cached point; uniform mode yields i / numSegments
+    std::shared_ptr<const std::vector<float>> GetLinearSegmentParameters() const;
+
+    // True when a setter or a vertex changed something since the cache was built
+    bool IsStale() const;
+
+    // LOD pyramid of the current cache
+    std::shared_ptr<const LodPyramid> GetLodPyramid() const;
+
+    // Coarsest precomputed decimation within maxError world units; shares ownership of the snapshot, so it outlives a rebuild
+    std::shared_ptr<const std::vector<Vector3>> ReadLodPoints(float maxError) const;
+
+    // Coarsest precomputed decimation within maxPixelError on screen at pixelsPerWorldUnit
+    std::shared_ptr<const std::vector<Vector3>> ReadLodPointsForScreen(float maxPixelError, float pixelsPerWorldUnit) const;
+
+    // Conservative bounds of the curve (either representation), current after any edit
+    AABB GetBounds() const;
+
+    // Bezier pieces of the active curve: one for Bezier, one per knot span for PiecewiseCubic
+    std::shared_ptr<const std::vector<BezierPiece>> GetBezierPieces() const;
+
+    // Closest point of the active curve to point; false if none is within maxDistance
+    bool ClosestPoint(const Vector3& point, float maxDistance, CurveHit& hit) const;
+
+    // Curve point nearest to the ray; false if none is within radius of it
+    bool PickRay(const Vector3& origin, const Vector3& direction, float radius, CurveHit& hit) const;
+
+    // Closest points between this curve (A) and other (B); false if they are not within maxDistance
+    bool ClosestPair(const LinearSegment& other, float maxDistance, CurvePairHit& hit) const;
+
+    // True when both segments use the same vertex object at either end
+    bool SharesVertex(const LinearSegment& other) const;
 
     // Public Calculation Methods
     std::vector<Vector3> CalculateControlPoints(float alpha) const;
     float CalculateCurvature(float t) const;
+
+    // Cached control points and hodographs of the Bezier, whatever the active representation
+    std::shared_ptr<const CurveDerivatives> GetCurveDerivatives() const;
+
+    // Active curve; sampling, curvature and arc length all go through it
+    std::shared_ptr<const ParametricCurve> GetCurve() const;
+
+    // Curvature, tangent and normal for every t in one batch pass
+    void CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const;
+    std::vector<CurvatureSample> CurvatureProfile(const std::vector<float>& ts) const;
+
+    // Arc length (table built lazily, dropped whenever the curve is rebuilt)
+    std::shared_ptr<const ArcLengthTable> GetArcLengthTable() const;
+    float CalculateLength() const;
+    float ParameterAtLength(float s) const;
+
+    // count points at equal arc length along the curve, end points included
+    std::vector<Vector3> ResampleByArcLength(int count) const;
 };
 
 #endif // LINEARSEGMENT_H
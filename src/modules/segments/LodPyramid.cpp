@@ -0,0 +1,64 @@
+// LodPyramid.cpp
+
+#include "LodPyramid.h"
+#include "AdaptiveTessellator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+void LodPyramid::Build(const std::vector<Vector3>& samples)
+{
+    _levels.clear();
+    if (samples.empty())
+        return;
+
+    std::vector<uint32_t> indices(samples.size());
+    for (std::size_t i = 0; i < samples.size(); ++i)
+        indices[i] = static_cast<uint32_t>(i);
+    _levels.push_back(LodLevel{samples, 0.0f});
+
+    while (indices.size() > 2)
+    {
+        // Equ. 1
+        std::vector<uint32_t> coarser;
+        coarser.reserve(indices.size() / 2 + 2);
+        for (std::size_t k = 0; k < indices.size(); k += 2)
+            coarser.push_back(indices[k]);
+        if (coarser.back() != indices.back())
+            coarser.push_back(indices.back());
+
+        // Equ. 2; every original sample lies between two consecutive kept indices
+        float error = _levels.back().Error;
+        LodLevel level;
+        level.Points.reserve(coarser.size());
+        level.Points.push_back(samples[coarser[0]]);
+        for (std::size_t k = 1; k < coarser.size(); ++k)
+        {
+            const Vector3& a = samples[coarser[k - 1]];
+            const Vector3& b = samples[coarser[k]];
+            for (uint32_t i = coarser[k - 1] + 1; i < coarser[k]; ++i)
+                error = std::max(error, AdaptiveTessellator::DistanceToChord(samples[i], a, b));
+            level.Points.push_back(b);
+        }
+        level.Error = error;
+        _levels.push_back(std::move(level));
+        indices.swap(coarser);
+    }
+}
+
+std::size_t LodPyramid::SelectLevel(float maxError) const
+{
+    // Errors never decrease with the level (Build carries the maximum forward), so bisect
+    auto past = std::partition_point(_levels.begin(), _levels.end(),
+                                     [maxError](const LodLevel& level) { return level.Error <= maxError; });
+    std::size_t qualifying = static_cast<std::size_t>(past - _levels.begin());
+    return qualifying > 1 ? qualifying - 1 : 0;
+}
+
+std::size_t LodPyramid::SelectLevelForScreen(float maxPixelError, float pixelsPerWorldUnit) const
+{
+    if (pixelsPerWorldUnit <= 0.0f)
+        return _levels.empty() ? 0 : _levels.size() - 1;
+    return SelectLevel(maxPixelError / pixelsPerWorldUnit);
+}
@@ -0,0 +1,66 @@
+/**
+ * LodPyramid.h
+ * Linked file: LodPyramid.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Precomputed nested decimations of a sampled curve with a max-deviation error per level
+ *
+ * Equations
+ * Equ(1): I_0=\{0,\dots,N-1\},\emsp I_{l+1}=\{I_l[2k]\}\cup\{N-1\}
+ * Equ(2): \varepsilon_l=\max\left(\varepsilon_{l-1},\max_{i}\mathrm{dist}\left(\vec{Q_i},\overline{\vec{Q_a}\vec{Q_b}}\right)\right),\emsp a\le i\le b,\ a,b\ \mathrm{consecutive\ in}\ I_l
+ * Equ(3): \varepsilon_{\mathrm{world}}=\varepsilon_{\mathrm{pixels}}/\rho,\emsp\rho=\mathrm{pixels\ per\ world\ unit}
+ */
+
+#ifndef LODPYRAMID_H
+#define LODPYRAMID_H
+
+#include <vector>
+#include <cstddef>
+
+#include "Vector3.h"
+
+/**
+ * @brief One level of the pyramid
+ *
+ * Error is the largest distance from any original sample to this level's polyline, made
+ * non-decreasing across levels (Equ. 2) so a threshold maps to a single cut-off level.
+ */
+struct LodLevel
+{
+    std::vector<Vector3> Points;
+    float Error;
+};
+
+/**
+ * @brief LOD pyramid over a sampled curve
+ *
+ * Level 0 is the full sample set; each coarser level keeps every other point of the previous
+ * one plus the last point (Equ. 1), down to the two end points. Errors never decrease with
+ * the level, so selection bisects the log2(N) + 1 levels in O(log log N).
+ */
+class LodPyramid
+{
+public:
+    LodPyramid() = default;
+
+    // Rebuild from samples; O(N log N)
+    void Build(const std::vector<Vector3>& samples);
+    void Clear() { _levels.clear(); }
+
+    std::size_t LevelCount() const { return _levels.size(); }
+    bool Empty() const { return _levels.empty(); }
+    const LodLevel& Level(std::size_t level) const { return _levels.at(level); }
+
+    // Coarsest level whose error is at most maxError (0 if none qualify)
+    std::size_t SelectLevel(float maxError) const;
+
+    // Coarsest level within maxPixelError on screen at pixelsPerWorldUnit (Equ. 3)
+    std::size_t SelectLevelForScreen(float maxPixelError, float pixelsPerWorldUnit) const;
+
+private:
+    std::vector<LodLevel> _levels;
+};
+
+#endif // LODPYRAMID_H
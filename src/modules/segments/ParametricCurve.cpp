@@ -0,0 +1,57 @@
+// ParametricCurve.cpp
+
+#include "ParametricCurve.h"
+
+#include <algorithm>
+
+void ParametricCurve::EvaluateUniform(int numSegments, std::vector<Vector3>& out) const
+{
+    out.clear();
+    if (numSegments <= 0)
+    {
+        out.push_back(Point(0.0f));
+        return;
+    }
+    out.reserve(numSegments + 1);
+    for (int i = 0; i <= numSegments; ++i)
+        out.push_back(Point(static_cast<float>(i) / numSegments));
+}
+
+bool ParametricCurve::BezierPieces(std::vector<BezierPiece>& pieces) const
+{
+    pieces.clear();
+    return false;
+}
+
+void ParametricCurve::CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = Curvature(ts[i]);
+}
+
+std::vector<CurvatureSample> ParametricCurve::CurvatureProfile(const std::vector<float>& ts) const
+{
+    std::vector<CurvatureSample> out(ts.size());
+    CurvatureProfile(ts.data(), ts.size(), out.data());
+    return out;
+}
+
+CurvatureSample ParametricCurve::Curvature(float t) const
+{
+    return Frame(FirstDerivative(t), SecondDerivative(t));
+}
+
+CurvatureSample ParametricCurve::Frame(const Vector3& d1, const Vector3& d2)
+{
+    CurvatureSample sample{0.0f, Vector3(), Vector3()};
+    float speed = d1.magnitude();
+    if (speed == 0.0f)
+        return sample;
+    sample.Tangent = d1 / speed;
+    sample.Curvature = d2.cross(d1).magnitude() / (speed * speed * speed);
+    Vector3 normal = d2 - sample.Tangent * d2.dot(sample.Tangent);
+    float length = normal.magnitude();
+    if (length > 1e-6f * std::max(1.0f, d2.magnitude()))
+        sample.Normal = normal / length;
+    return sample;
+}
@@ -0,0 +1,75 @@
+/**
+ * ParametricCurve.h
+ * Linked file: ParametricCurve.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Common interface of the curve representations a LinearSegment can sample
+ *
+ * Equations
+ * Equ(1): \kappa\left(t\right)=\frac{|\vec{C^{\prime\prime}}\left(t\right)\times\vec{C^\prime}\left(t\right)|}{|\vec{C^\prime}\left(t\right)|^3}
+ * Equ(2): \vec{T}=\frac{\vec{C^\prime}}{|\vec{C^\prime}|},\emsp\vec{N}=\frac{\vec{C^{\prime\prime}}-\left(\vec{C^{\prime\prime}}\cdot\vec{T}\right)\vec{T}}{|\vec{C^{\prime\prime}}-\left(\vec{C^{\prime\prime}}\cdot\vec{T}\right)\vec{T}|}
+ */
+
+#ifndef PARAMETRICCURVE_H
+#define PARAMETRICCURVE_H
+
+#include <vector>
+#include <cstddef>
+
+#include "Vector3.h"
+
+/**
+ * @brief Curvature and Frenet frame at one parameter
+ *
+ * Tangent is zero where the curve is stationary; Normal is zero where the curve is straight.
+ */
+struct CurvatureSample
+{
+    float Curvature; // Equ. 1
+    Vector3 Tangent; // Equ. 2
+    Vector3 Normal;  // Equ. 2
+};
+
+/**
+ * @brief Bezier form of a curve on t in [T0, T1]
+ *
+ * The piece lies in the convex hull of its control points, which is what CurveQuery prunes with.
+ */
+struct BezierPiece
+{
+    float T0;
+    float T1;
+    std::vector<Vector3> ControlPoints;
+};
+
+/**
+ * @brief Curve C(t) on t in [0, 1] with first and second derivatives
+ */
+class ParametricCurve
+{
+public:
+    virtual ~ParametricCurve() = default;
+
+    virtual Vector3 Point(float t) const = 0;
+    virtual Vector3 FirstDerivative(float t) const = 0;
+    virtual Vector3 SecondDerivative(float t) const = 0;
+
+    // C(i / numSegments) for i = 0..numSegments; out is overwritten
+    virtual void EvaluateUniform(int numSegments, std::vector<Vector3>& out) const;
+
+    // Curvature, tangent and normal for ts[0..count); out must hold count samples
+    virtual void CurvatureProfile(const float* ts, std::size_t count, CurvatureSample* out) const;
+    std::vector<CurvatureSample> CurvatureProfile(const std::vector<float>& ts) const;
+
+    CurvatureSample Curvature(float t) const;
+
+    // Bezier pieces covering [0, 1] in order; false (and no pieces) if the representation has none
+    virtual bool BezierPieces(std::vector<BezierPiece>& pieces) const;
+
+    // Equ. 1 and 2 from the derivatives at one parameter
+    static CurvatureSample Frame(const Vector3& d1, const Vector3& d2);
+};
+
+#endif // PARAMETRICCURVE_H
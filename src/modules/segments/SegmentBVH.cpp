@@ -0,0 +1,224 @@
+// SegmentBVH.cpp
+
+#include "SegmentBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+void SegmentBVH::Clear()
+{
+    _nodes.clear();
+    _items.clear();
+    _bounds.clear();
+}
+
+void SegmentBVH::Build(const std::vector<AABB>& bounds)
+{
+    Clear();
+    if (bounds.empty())
+        return;
+
+    std::vector<Vector3> centers;
+    centers.reserve(bounds.size());
+    for (const AABB& box : bounds)
+        centers.push_back(box.IsEmpty() ? Vector3() : box.Center());
+
+    _bounds = bounds;
+    _items.resize(bounds.size());
+    for (std::size_t i = 0; i < bounds.size(); ++i)
+        _items[i] = static_cast<std::uint32_t>(i);
+
+    _nodes.reserve(2 * bounds.size());
+    _nodes.push_back(Node{AABB(), 0, 0});
+    BuildRange(bounds, centers, 0, 0, static_cast<std::uint32_t>(bounds.size()));
+}
+
+void SegmentBVH::BuildRange(const std::vector<AABB>& bounds, const std::vector<Vector3>& centers,
+                            std::uint32_t node, std::uint32_t first, std::uint32_t count)
+{
+    AABB box;
+    AABB centroids;
+    for (std::uint32_t i = first; i < first + count; ++i)
+    {
+        box.Expand(bounds[_items[i]]);
+        centroids.Expand(centers[_items[i]]);
+    }
+    _nodes[node].Bounds = box;
+
+    if (count <= kLeafSize)
+    {
+        _nodes[node].Left = first;
+        _nodes[node].Count = count;
+        return;
+    }
+
+    // Median split on the widest centroid axis (Equ. 2)
+    Vector3 extent = centroids.Extent();
+    int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+    std::uint32_t half = count / 2;
+    auto begin = _items.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [&centers, axis](std::uint32_t a, std::uint32_t b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+
+    std::uint32_t left = static_cast<std::uint32_t>(_nodes.size());
+    _nodes.push_back(Node{AABB(), 0, 0});
+    _nodes.push_back(Node{AABB(), 0, 0});
+    _nodes[node].Left = left;
+    _nodes[node].Count = 0;
+    BuildRange(bounds, centers, left, first, half);
+    BuildRange(bounds, centers, left + 1, first + half, count - half);
+}
+
+// Parents precede children, so one reverse pass is bottom-up (Equ. 1)
+void SegmentBVH::Refit(const std::vector<AABB>& bounds)
+{
+    _bounds = bounds;
+    for (std::size_t n = _nodes.size(); n-- > 0;)
+    {
+        Node& node = _nodes[n];
+        AABB box;
+        if (node.Count > 0)
+        {
+            for (std::uint32_t i = node.Left; i < node.Left + node.Count; ++i)
+                box.Expand(_bounds.at(_items[i]));
+        }
+        else
+        {
+            box.Expand(_nodes[node.Left].Bounds);
+            box.Expand(_nodes[node.Left + 1].Bounds);
+        }
+        node.Bounds = box;
+    }
+}
+
+template <typename Overlaps>
+void SegmentBVH::Collect(const Overlaps& overlaps, std::vector<std::size_t>& out) const
+{
+    if (_nodes.empty())
+        return;
+    std::vector<std::uint32_t> stack{0};
+    while (!stack.empty())
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (!overlaps(node.Bounds))
+            continue;
+        if (node.Count > 0)
+        {
+            for (std::uint32_t i = node.Left; i < node.Left + node.Count; ++i)
+            {
+                if (overlaps(_bounds[_items[i]]))
+                    out.push_back(_items[i]);
+            }
+        }
+        else
+        {
+            stack.push_back(node.Left + 1);
+            stack.push_back(node.Left);
+        }
+    }
+}
+
+void SegmentBVH::QueryBox(const AABB& box, std::vector<std::size_t>& out) const
+{
+    if (box.IsEmpty())
+        return;
+    Collect([&box](const AABB& bounds) { return !bounds.IsEmpty() && bounds.Intersects(box); }, out);
+}
+
+void SegmentBVH::QuerySphere(const Vector3& center, float radius, std::vector<std::size_t>& out) const
+{
+    Collect([&center, radius](const AABB& bounds) { return bounds.IntersectsSphere(center, radius); }, out);
+}
+
+void SegmentBVH::QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<std::size_t>& out,
+                          float radius) const
+{
+    float length = direction.magnitude();
+    if (_nodes.empty() || length == 0.0f)
+        return;
+    Vector3 unit = direction / length;
+    const float inf = std::numeric_limits<float>::infinity();
+    Vector3 inverse(unit.x != 0.0f ? 1.0f / unit.x : inf,
+                    unit.y != 0.0f ? 1.0f / unit.y : inf,
+                    unit.z != 0.0f ? 1.0f / unit.z : inf);
+
+    const Vector3 pad(radius, radius, radius);
+    auto padded = [&pad](const AABB& box) { return box.IsEmpty() ? box : AABB(box.Min - pad, box.Max + pad); };
+
+    // Item boxes give the entry distance the candidates are ordered by
+    std::vector<std::pair<float, std::size_t>> hits;
+    std::vector<std::uint32_t> stack{0};
+    while (!stack.empty())
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (!padded(node.Bounds).IntersectsRay(origin, inverse, maxDistance))
+            continue;
+        if (node.Count > 0)
+        {
+            for (std::uint32_t i = node.Left; i < node.Left + node.Count; ++i)
+            {
+                float entry = 0.0f;
+                if (padded(_bounds[_items[i]]).IntersectsRay(origin, inverse, maxDistance, &entry))
+                    hits.emplace_back(entry, _items[i]);
+            }
+        }
+        else
+        {
+            stack.push_back(node.Left + 1);
+            stack.push_back(node.Left);
+        }
+    }
+    std::sort(hits.begin(), hits.end());
+    out.reserve(out.size() + hits.size());
+    for (const auto& hit : hits)
+        out.push_back(hit.second);
+}
+
+void SegmentBVH::QueryNearest(const Vector3& point, float maxDistance,
+                              const std::function<float(std::size_t item, float radius)>& visit) const
+{
+    if (_nodes.empty())
+        return;
+    float radius = maxDistance;
+
+    // Min-heap of (squared box distance, node); leaf items go in with their own box distance
+    using Entry = std::pair<float, std::int64_t>; // node >= 0, item = -1 - index
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    queue.emplace(_nodes[0].Bounds.DistanceSquared(point), 0);
+    while (!queue.empty())
+    {
+        Entry top = queue.top();
+        queue.pop();
+        if (top.first > radius * radius)
+            break;
+        if (top.second < 0)
+        {
+            radius = visit(static_cast<std::size_t>(-1 - top.second), radius);
+            continue;
+        }
+        const Node& node = _nodes[static_cast<std::size_t>(top.second)];
+        if (node.Count > 0)
+        {
+            for (std::uint32_t i = node.Left; i < node.Left + node.Count; ++i)
+            {
+                const AABB& box = _bounds[_items[i]];
+                if (!box.IsEmpty())
+                    queue.emplace(box.DistanceSquared(point), -1 - static_cast<std::int64_t>(_items[i]));
+            }
+        }
+        else
+        {
+            for (std::uint32_t child = node.Left; child < node.Left + 2; ++child)
+            {
+                if (!_nodes[child].Bounds.IsEmpty())
+                    queue.emplace(_nodes[child].Bounds.DistanceSquared(point), child);
+            }
+        }
+    }
+}
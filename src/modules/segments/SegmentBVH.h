@@ -0,0 +1,94 @@
+/**
+ * SegmentBVH.h
+ * Linked file: SegmentBVH.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Bounding volume hierarchy over segment boxes for box, sphere and ray candidate queries
+ *
+ * Equations
+ * Equ(1): \mathrm{box}\left(v\right)=\bigcup_{c\in\mathrm{children}\left(v\right)}\mathrm{box}\left(c\right)
+ * Equ(2): \mathrm{split}\left(v\right)=\mathrm{median}_{i\in v}\ \vec{c_i}\cdot\vec{e_a},\emsp a=\arg\max_k\left(\mathrm{centroid\ extent}\right)_k
+ */
+
+#ifndef SEGMENTBVH_H
+#define SEGMENTBVH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "AABB.h"
+#include "Vector3.h"
+
+/**
+ * @brief Binary BVH over a list of boxes; items are identified by their index in that list
+ *
+ * Build splits at the centroid median of the widest axis (Equ. 2) down to kLeafSize items per
+ * leaf, O(n log n). Refit keeps the topology and recomputes every box bottom-up (Equ. 1) in
+ * O(n), which stays correct after any edit but loses tightness when items move far; rebuild
+ * when the item count changes or queries slow down.
+ *
+ * Queries return candidates whose own box passes the test; the caller refines them against
+ * the actual curve. Results are appended to out.
+ */
+class SegmentBVH
+{
+public:
+    static constexpr std::size_t kLeafSize = 4;
+
+    SegmentBVH() = default;
+
+    void Build(const std::vector<AABB>& bounds);
+
+    // bounds must have the size given to Build
+    void Refit(const std::vector<AABB>& bounds);
+
+    void Clear();
+
+    bool Empty() const { return _nodes.empty(); }
+    std::size_t ItemCount() const { return _items.size(); }
+    std::size_t NodeCount() const { return _nodes.size(); }
+    AABB Bounds() const { return _nodes.empty() ? AABB() : _nodes[0].Bounds; }
+
+    void QueryBox(const AABB& box, std::vector<std::size_t>& out) const;
+    void QuerySphere(const Vector3& center, float radius, std::vector<std::size_t>& out) const;
+
+    // Candidates hit within maxDistance world units along direction (any length), nearest box entry first;
+    // radius > 0 pads every box, i.e. finds items within radius of the ray
+    void QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<std::size_t>& out,
+                  float radius = 0.0f) const;
+
+    /**
+     * @brief Best-first nearest search around point
+     *
+     * Items are visited in increasing box distance while that distance is within the search
+     * radius; visit(item, radius) returns the new radius (e.g. the exact distance found so far),
+     * so the search shrinks as better items are found. Starts at maxDistance.
+     */
+    void QueryNearest(const Vector3& point, float maxDistance,
+                      const std::function<float(std::size_t item, float radius)>& visit) const;
+
+private:
+    // Children of an inner node are stored consecutively at Left and Left + 1; parents precede children
+    struct Node
+    {
+        AABB Bounds;
+        std::uint32_t Left;  // First child (inner) or first entry in _items (leaf)
+        std::uint32_t Count; // 0 for inner nodes
+    };
+
+    void BuildRange(const std::vector<AABB>& bounds, const std::vector<Vector3>& centers,
+                    std::uint32_t node, std::uint32_t first, std::uint32_t count);
+
+    template <typename Overlaps>
+    void Collect(const Overlaps& overlaps, std::vector<std::size_t>& out) const;
+
+    std::vector<Node> _nodes;
+    std::vector<std::uint32_t> _items; // Item indices, grouped per leaf
+    std::vector<AABB> _bounds;         // Item boxes as of the last Build / Refit
+};
+
+#endif // SEGMENTBVH_H
@@ -0,0 +1,330 @@
+/**
+ * JsonStreamReader.cpp
+ * Linked File: JsonStreamReader.h
+ * Author: Minseok Doo
+ * Date: 2026-10-17
+ */
+
+#include "JsonStreamReader.h"
+
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+namespace {
+
+    enum class ReadMode { Vertices, Nodes, Bearings };
+
+    enum class Frame {
+        Root,        // Root object: "expected_input" / "expected_output" / keyed records
+        Collection,  // Object or array whose values are the records of the current mode
+        Vertex,
+        Bearings,    // "bearings" of a vertex
+        Node,
+        Bearing,
+        Vec3,
+        Skip         // Unknown subtree
+    };
+
+    // Partially parsed records
+    struct PendingNode {
+        int index = 0;
+        Vector3 vector;
+        bool hasIndex = false;
+        bool hasVector = false;
+    };
+
+    struct PendingBearing {
+        Vector3 force;
+        Vector3 vector;
+        PendingNode node;
+        bool hasForce = false;
+        bool hasVector = false;
+        bool hasNode = false;
+    };
+
+    struct PendingVec3 {
+        Vector3* target = nullptr;
+        bool* done = nullptr;
+        int next = 0;   // array position
+        int seen = 0;   // bit mask of x, y, z
+        bool isArray = false;
+    };
+
+    /**
+     * @brief nlohmann SAX handler that builds records in place
+     */
+    class RecordSax : public nlohmann::json_sax<json> {
+    public:
+        RecordSax(ReadMode mode,
+                  std::vector<std::unique_ptr<Vertex>>* vertices,
+                  std::vector<NodeVector>* nodes,
+                  std::vector<BearingVector>* bearings)
+            : _mode(mode), _vertices(vertices), _nodes(nodes), _bearings(bearings) {}
+
+        // Scalars
+        bool null() override { return Scalar(); }
+        bool boolean(bool) override { return Scalar(); }
+        bool string(string_t&) override { return Scalar(); }
+        bool binary(binary_t&) override { return Scalar(); }
+        bool number_integer(number_integer_t value) override { return Number(static_cast<double>(value), true); }
+        bool number_unsigned(number_unsigned_t value) override { return Number(static_cast<double>(value), true); }
+        bool number_float(number_float_t value, const string_t&) override { return Number(value, false); }
+
+        bool key(string_t& value) override {
+            _key = value;
+            return true;
+        }
+
+        // Containers
+        bool start_object(std::size_t) override { return Open(false); }
+        bool start_array(std::size_t) override { return Open(true); }
+        bool end_object() override { return Close(); }
+        bool end_array() override { return Close(); }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+            throw std::runtime_error(std::string("JsonStreamReader: ") + ex.what());
+        }
+
+    private:
+        ReadMode _mode;
+        std::vector<std::unique_ptr<Vertex>>* _vertices;
+        std::vector<NodeVector>* _nodes;
+        std::vector<BearingVector>* _bearings;
+
+        std::vector<Frame> _frames;
+        std::string _key;
+
+        std::unique_ptr<Vertex> _vertex;
+        bool _vertexHasNode = false;
+        PendingNode _node;
+        PendingBearing _bearing;
+        PendingVec3 _vec3;
+
+        [[noreturn]] static void Fail(const std::string& message) {
+            throw std::runtime_error("JsonStreamReader: " + message);
+        }
+
+        Frame Top() const { return _frames.back(); }
+
+        bool Scalar() {
+            if (!_frames.empty() && Top() == Frame::Vec3)
+                Fail("vector components must be numbers");
+            if (!_frames.empty() && Top() == Frame::Node && _key == "index")
+                Fail("node index must be an integer");
+            return true;
+        }
+
+        bool Number(double value, bool integral) {
+            if (_frames.empty())
+                Fail("expected an object or array at the root");
+
+            switch (Top()) {
+            case Frame::Vec3: {
+                int component = _vec3.isArray ? _vec3.next++ :
+                                _key == "x" ? 0 : _key == "y" ? 1 : _key == "z" ? 2 : -1;
+                if (component < 0)
+                    return true; // Unknown key inside {"x", "y", "z"}
+                if (component > 2)
+                    Fail("vector has more than three components");
+                (*_vec3.target)[component] = static_cast<float>(value);
+                _vec3.seen |= 1 << component;
+                return true;
+            }
+            case Frame::Node:
+                if (_key == "index") {
+                    if (!integral)
+                        Fail("node index must be an integer");
+                    _node.index = static_cast<int>(value);
+                    _node.hasIndex = true;
+                }
+                return true;
+            default:
+                return true;
+            }
+        }
+
+        void BeginVec3(Vector3* target, bool* done, bool isArray) {
+            _vec3 = PendingVec3();
+            _vec3.target = target;
+            _vec3.done = done;
+            _vec3.isArray = isArray;
+            _frames.push_back(Frame::Vec3);
+        }
+
+        void BeginNode() {
+            _node = PendingNode();
+            _frames.push_back(Frame::Node);
+        }
+
+        void BeginBearing() {
+            _bearing = PendingBearing();
+            _frames.push_back(Frame::Bearing);
+        }
+
+        void BeginVertex() {
+            _vertex = std::make_unique<Vertex>();
+            _vertexHasNode = false;
+            _frames.push_back(Frame::Vertex);
+        }
+
+        // Frame for a record value of the current mode
+        void BeginRecord(bool isArray) {
+            if (isArray) {
+                Fail("expected a record object");
+            }
+            switch (_mode) {
+            case ReadMode::Vertices: BeginVertex(); break;
+            case ReadMode::Nodes: BeginNode(); break;
+            case ReadMode::Bearings: BeginBearing(); break;
+            }
+        }
+
+        bool Open(bool isArray) {
+            if (_frames.empty()) {
+                _frames.push_back(isArray ? Frame::Collection : Frame::Root);
+                return true;
+            }
+
+            switch (Top()) {
+            case Frame::Root:
+                if (_key == "expected_input")
+                    _frames.push_back(Frame::Collection);
+                else if (_key == "expected_output")
+                    _frames.push_back(Frame::Skip);
+                else
+                    BeginRecord(isArray);
+                break;
+            case Frame::Collection:
+                BeginRecord(isArray);
+                break;
+            case Frame::Vertex:
+                if (_key == "node" && !isArray)
+                    BeginNode();
+                else if (_key == "bearings")
+                    _frames.push_back(Frame::Bearings);
+                else
+                    _frames.push_back(Frame::Skip);
+                break;
+            case Frame::Bearings:
+                if (isArray)
+                    Fail("expected a bearing object");
+                BeginBearing();
+                break;
+            case Frame::Node:
+                if (_key == "vec" || _key == "vector")
+                    BeginVec3(&_node.vector, &_node.hasVector, isArray);
+                else
+                    _frames.push_back(Frame::Skip);
+                break;
+            case Frame::Bearing:
+                if (_key == "force")
+                    BeginVec3(&_bearing.force, &_bearing.hasForce, isArray);
+                else if (_key == "vec" || _key == "vector")
+                    BeginVec3(&_bearing.vector, &_bearing.hasVector, isArray);
+                else if (_key == "node" && !isArray)
+                    BeginNode();
+                else
+                    _frames.push_back(Frame::Skip);
+                break;
+            case Frame::Vec3:
+                Fail("vector components must be numbers");
+            case Frame::Skip:
+                _frames.push_back(Frame::Skip);
+                break;
+            }
+            return true;
+        }
+
+        bool Close() {
+            const Frame frame = Top();
+            _frames.pop_back();
+            const Frame parent = _frames.empty() ? Frame::Skip : Top();
+
+            switch (frame) {
+            case Frame::Vec3:
+                if (_vec3.seen != 0x7)
+                    Fail("vector needs x, y and z");
+                *_vec3.done = true;
+                break;
+            case Frame::Node: {
+                if (!_node.hasIndex || !_node.hasVector)
+                    Fail("node needs \"index\" and \"vec\"");
+                NodeVector node(_node.index, _node.vector);
+                if (parent == Frame::Vertex) {
+                    _vertex->UpdateNodeVector(node);
+                    _vertexHasNode = true;
+                } else if (parent == Frame::Bearing) {
+                    _bearing.node = _node;
+                    _bearing.hasNode = true;
+                } else {
+                    _nodes->push_back(node);
+                }
+                break;
+            }
+            case Frame::Bearing: {
+                if (!_bearing.hasForce || !_bearing.hasVector)
+                    Fail("bearing needs \"force\" and \"vec\"");
+                if (parent == Frame::Bearings) {
+                    // The vertex node is known once "node" precedes "bearings"; otherwise require one per bearing
+                    if (!_bearing.hasNode && !_vertexHasNode)
+                        Fail("bearing has no node; put \"node\" before \"bearings\"");
+                    NodeVector node = _bearing.hasNode ? NodeVector(_bearing.node.index, _bearing.node.vector)
+                                                       : _vertex->ReadNodeVector();
+                    _vertex->PostBearingVector(BearingVector(node, _bearing.force, _bearing.vector));
+                } else {
+                    if (!_bearing.hasNode)
+                        Fail("bearing needs \"node\"");
+                    _bearings->push_back(BearingVector(NodeVector(_bearing.node.index, _bearing.node.vector),
+                                                       _bearing.force, _bearing.vector));
+                }
+                break;
+            }
+            case Frame::Vertex:
+                if (!_vertexHasNode)
+                    Fail("vertex needs \"node\"");
+                _vertices->push_back(std::move(_vertex));
+                break;
+            default:
+                break;
+            }
+            return true;
+        }
+    };
+
+    template <typename Input>
+    void Parse(Input&& input, RecordSax& sax) {
+        json::sax_parse(std::forward<Input>(input), &sax);
+    }
+}
+
+void JsonStreamReader::ReadVertices(std::istream& in, std::vector<std::unique_ptr<Vertex>>& out) {
+    RecordSax sax(ReadMode::Vertices, &out, nullptr, nullptr);
+    Parse(in, sax);
+}
+
+void JsonStreamReader::ReadVertices(const std::string& text, std::vector<std::unique_ptr<Vertex>>& out) {
+    RecordSax sax(ReadMode::Vertices, &out, nullptr, nullptr);
+    Parse(text, sax);
+}
+
+void JsonStreamReader::ReadNodes(std::istream& in, std::vector<NodeVector>& out) {
+    RecordSax sax(ReadMode::Nodes, nullptr, &out, nullptr);
+    Parse(in, sax);
+}
+
+void JsonStreamReader::ReadNodes(const std::string& text, std::vector<NodeVector>& out) {
+    RecordSax sax(ReadMode::Nodes, nullptr, &out, nullptr);
+    Parse(text, sax);
+}
+
+void JsonStreamReader::ReadBearings(std::istream& in, std::vector<BearingVector>& out) {
+    RecordSax sax(ReadMode::Bearings, nullptr, nullptr, &out);
+    Parse(in, sax);
+}
+
+void JsonStreamReader::ReadBearings(const std::string& text, std::vector<BearingVector>& out) {
+    RecordSax sax(ReadMode::Bearings, nullptr, nullptr, &out);
+    Parse(text, sax);
+}
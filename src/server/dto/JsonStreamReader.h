@@ -0,0 +1,47 @@
+/**
+ * JsonStreamReader.h
+ * Linked File: JsonStreamReader.cpp
+ * Author: Minseok Doo
+ * Date: 2026-10-17
+ * Description: Streaming (SAX) JSON ingest for NodeVector, BearingVector and Vertex payloads
+ *
+ * Fills NodeVector / BearingVector / Vertex storage while parsing, so no nlohmann DOM is built.
+ *
+ * Accepted shapes (see the files under json/)
+ * The records are an array or keyed object, either at the root or under "expected_input";
+ * "expected_output" and unknown keys are skipped.
+ *     vertex  { "node": node, "bearings": { "bearing1": bearing, ... } | [bearing, ...] }
+ *     node    { "index": int, "vec": [x, y, z] }              or NodeVector::toJson
+ *     bearing { "force": [x, y, z], "vec": [x, y, z] }        or BearingVector::toJson
+ *   Vectors may be [x, y, z] arrays or {"x", "y", "z"} objects. A bearing without its own
+ *   "node" takes the node of its vertex.
+ *
+ * Malformed JSON or a missing required field throws std::runtime_error.
+ */
+
+#ifndef JSONSTREAMREADER_H
+#define JSONSTREAMREADER_H
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NodeVector.h"
+#include "BearingVector.h"
+#include "Vertex.h"
+
+class JsonStreamReader {
+    public:
+        // Append parsed records to out
+        static void ReadVertices(std::istream& in, std::vector<std::unique_ptr<Vertex>>& out);
+        static void ReadVertices(const std::string& text, std::vector<std::unique_ptr<Vertex>>& out);
+
+        static void ReadNodes(std::istream& in, std::vector<NodeVector>& out);
+        static void ReadNodes(const std::string& text, std::vector<NodeVector>& out);
+
+        static void ReadBearings(std::istream& in, std::vector<BearingVector>& out);
+        static void ReadBearings(const std::string& text, std::vector<BearingVector>& out);
+};
+
+#endif // JSONSTREAMREADER_H
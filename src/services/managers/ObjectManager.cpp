@@ -0,0 +1,173 @@
+// ObjectManager.cpp
+
+#include "ObjectManager.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+ObjectManager::ObjectManager(TaskScheduler& scheduler)
+    : _segments(scheduler)
+{
+}
+
+ObjectManager::~ObjectManager()
+{
+    // _segments (declared after _vertices) is destroyed first and waits for pending tessellation
+}
+
+// Vertices
+VertexHandle ObjectManager::CreateVertex(const NodeVector& node)
+{
+    Vertex vertex;
+    vertex.UpdateNodeVector(node);
+    return CreateVertex(std::move(vertex));
+}
+
+VertexHandle ObjectManager::CreateVertex(Vertex vertex)
+{
+    // A pending tessellation reads the vertices; let it finish before they may move
+    _segments.Wait();
+
+    const Vertex* storage = _vertices.Data();
+    VertexHandle handle = _vertices.Insert(std::move(vertex));
+    if (_adjacency.size() <= handle.Index)
+        _adjacency.resize(handle.Index + 1);
+
+    // Growth moved every vertex
+    if (_vertices.Data() != storage)
+        RebindAll();
+    return handle;
+}
+
+bool ObjectManager::EraseVertex(VertexHandle vertex)
+{
+    if (!_vertices.Contains(vertex))
+        return false;
+    _segments.Wait();
+
+    // Dependents first, so no segment ever points at an erased vertex
+    std::vector<SegmentHandle> dependents = _adjacency[vertex.Index];
+    for (SegmentHandle segment : dependents)
+        EraseLinearSegment(segment);
+    _adjacency[vertex.Index].clear();
+
+    VertexHandle moved;
+    _vertices.Erase(vertex, &moved);
+    if (!moved.IsNull())
+        RebindVertex(moved);
+    return true;
+}
+
+// Segments
+SegmentHandle ObjectManager::CreateLinearSegment(VertexHandle start, VertexHandle end, float alpha, int numSegments)
+{
+    if (!_vertices.Contains(start) || !_vertices.Contains(end))
+        throw std::invalid_argument("ObjectManager: stale vertex handle");
+
+    std::size_t index = _segments.AddLinearSegment(_vertices.Get(start), _vertices.Get(end), alpha, numSegments);
+    SegmentHandle handle = _segments.HandleAt(index);
+    if (_segmentEnds.size() <= handle.Index)
+        _segmentEnds.resize(handle.Index + 1);
+    _segmentEnds[handle.Index] = SegmentEnds{start, end};
+    _adjacency[start.Index].push_back(handle);
+    if (end != start)
+        _adjacency[end.Index].push_back(handle);
+    return handle;
+}
+
+const SegmentEnds& ObjectManager::GetSegmentEnds(SegmentHandle segment) const
+{
+    if (!_segments.ContainsLinearSegment(segment))
+        throw std::out_of_range("ObjectManager: stale segment handle");
+    return _segmentEnds[segment.Index];
+}
+
+bool ObjectManager::EraseLinearSegment(SegmentHandle segment)
+{
+    if (!_segments.ContainsLinearSegment(segment))
+        return false;
+    const SegmentEnds& ends = _segmentEnds[segment.Index];
+    Unlink(ends.Start, segment);
+    Unlink(ends.End, segment);
+    return _segments.EraseLinearSegment(segment);
+}
+
+const std::vector<SegmentHandle>& ObjectManager::SegmentsOf(VertexHandle vertex) const
+{
+    static const std::vector<SegmentHandle> none;
+    return _vertices.Contains(vertex) ? _adjacency[vertex.Index] : none;
+}
+
+// Compaction
+void ObjectManager::Compact()
+{
+    _segments.Wait();
+    const std::size_t segmentCount = _segments.LinearSegmentCount();
+
+    // Vertex order: first reached by a segment, then the unconnected ones as they are
+    const std::size_t vertexCount = _vertices.Size();
+    std::vector<uint32_t> order;
+    std::vector<bool> placed(vertexCount, false);
+    order.reserve(vertexCount);
+    auto place = [&](VertexHandle vertex) {
+        uint32_t dense = static_cast<uint32_t>(_vertices.DenseIndex(vertex));
+        if (!placed[dense])
+        {
+            placed[dense] = true;
+            order.push_back(dense);
+        }
+    };
+    for (std::size_t i = 0; i < segmentCount; ++i)
+    {
+        const SegmentEnds& ends = _segmentEnds[_segments.HandleAt(i).Index];
+        place(ends.Start);
+        place(ends.End);
+    }
+    for (uint32_t dense = 0; dense < vertexCount; ++dense)
+    {
+        if (!placed[dense])
+            order.push_back(dense);
+    }
+    _vertices.Reorder(order);
+    _vertices.ShrinkToFit();
+
+    // Segments by start vertex, ties kept in their current order
+    std::vector<uint32_t> segmentOrder(segmentCount);
+    std::vector<std::size_t> startOf(segmentCount);
+    for (uint32_t i = 0; i < segmentCount; ++i)
+    {
+        segmentOrder[i] = i;
+        startOf[i] = _vertices.DenseIndex(_segmentEnds[_segments.HandleAt(i).Index].Start);
+    }
+    std::stable_sort(segmentOrder.begin(), segmentOrder.end(),
+                     [&](uint32_t a, uint32_t b) { return startOf[a] < startOf[b]; });
+    _segments.ReorderLinearSegments(segmentOrder);
+
+    RebindAll();
+}
+
+// Rebinding after vertices moved
+void ObjectManager::Rebind(std::size_t segmentIndex)
+{
+    const SegmentEnds& ends = _segmentEnds[_segments.HandleAt(segmentIndex).Index];
+    _segments.GetLinearSegment(segmentIndex).Rebind(_vertices.Get(ends.Start), _vertices.Get(ends.End));
+}
+
+void ObjectManager::RebindVertex(VertexHandle vertex)
+{
+    for (SegmentHandle segment : _adjacency[vertex.Index])
+        Rebind(_segments.IndexOf(segment));
+}
+
+void ObjectManager::RebindAll()
+{
+    for (std::size_t i = 0; i < _segments.LinearSegmentCount(); ++i)
+        Rebind(i);
+}
+
+void ObjectManager::Unlink(VertexHandle vertex, SegmentHandle segment)
+{
+    std::vector<SegmentHandle>& segments = _adjacency[vertex.Index];
+    segments.erase(std::remove(segments.begin(), segments.end(), segment), segments.end());
+}
@@ -14,11 +14,44 @@
 #ifndef OBJECTMANAGER_H
 #define OBJECTMANAGER_H
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include "Vector3.h"
 #include "NodeVector.h"
 #include "BearingVector.h"
 #include "SegmentManager.h"
+#include "SlotMap.h"
+#include "Vertex.h"
+#include "LinearSegment.h"
+#include "thread.h"
+
+using VertexHandle = SlotHandle<Vertex>;
 
+/**
+ * @brief Handles of the end vertices of a segment
+ */
+struct SegmentEnds
+{
+    VertexHandle Start;
+    VertexHandle End;
+};
+
+/**
+ * @brief Owner of the vertex / segment graph
+ *
+ * Vertices live in a dense SlotMap and segments in the SegmentManager (itself slot-map backed),
+ * both addressed by generational handles, so erased objects are detected instead of dangling.
+ * Segments are created deferred and registered with the SegmentManager, so they share its
+ * parallel tessellation, BVH and proximity queries; query results are segment indices, which
+ * Segments().HandleAt maps back to handles.
+ *
+ * Segments name their vertices by handle; the LinearSegment's vertex pointers are rebound
+ * whenever a vertex moves (slot map growth, erase, Compact), through the adjacency index in
+ * O(degree). Deleting a vertex deletes the segments that use it. Not thread-safe; readers on
+ * other threads use LinearSegment::GetSnapshot.
+ */
 class ObjectManager
 {
 private:
@@ -29,9 +62,69 @@ private:
      SegmentManager는 NodeVector, BearingVector를 포인터로 참조, 세그먼트 & 버퍼인덱스를 unique_ptr로 선언하는 5차원 포인터 배열임.
      IndexBuffer는 NodeVector, BearingVector, Segments 인덱스를 4차원 포인터 배열로 관리하는 객체임.
      */
+    SlotMap<Vertex> _vertices;   // Declared first: destroyed after the segments that point into it
+    SegmentManager _segments;
+
+    // End vertices by segment slot (SegmentHandle::Index)
+    std::vector<SegmentEnds> _segmentEnds;
+
+    // Segments touching each vertex, by vertex slot (VertexHandle::Index); unaffected by relocation
+    std::vector<std::vector<SegmentHandle>> _adjacency;
+
+    void Rebind(std::size_t segmentIndex);
+    void RebindVertex(VertexHandle vertex); // Segments of one moved vertex
+    void RebindAll();
+    void Unlink(VertexHandle vertex, SegmentHandle segment);
+
 public:
-    ObjectManager(/* args */);
+    explicit ObjectManager(TaskScheduler& scheduler = TaskScheduler::Default());
     ~ObjectManager();
+
+    ObjectManager(const ObjectManager&) = delete;
+    ObjectManager& operator=(const ObjectManager&) = delete;
+
+    // Vertices; a vertex may move in memory on any create, erase or Compact, its handle does not
+    VertexHandle CreateVertex(const NodeVector& node);
+    VertexHandle CreateVertex(Vertex vertex);
+    bool ContainsVertex(VertexHandle vertex) const { return _vertices.Contains(vertex); }
+    Vertex* FindVertex(VertexHandle vertex) { return _vertices.Find(vertex); }
+    const Vertex* FindVertex(VertexHandle vertex) const { return _vertices.Find(vertex); }
+    Vertex& GetVertex(VertexHandle vertex) { return _vertices.Get(vertex); } // std::out_of_range if stale
+    const Vertex& GetVertex(VertexHandle vertex) const { return _vertices.Get(vertex); }
+    std::size_t VertexCount() const { return _vertices.Size(); }
+
+    // Erases the vertex and every segment that uses it; false for a stale handle
+    bool EraseVertex(VertexHandle vertex);
+
+    // Segments; created dirty (TessellateDirty / UpdateSpatialIndex on Segments() builds them).
+    // Throws std::invalid_argument for a stale vertex handle
+    SegmentHandle CreateLinearSegment(VertexHandle start, VertexHandle end, float alpha = 0.5f, int numSegments = 100);
+    bool ContainsLinearSegment(SegmentHandle segment) const { return _segments.ContainsLinearSegment(segment); }
+    LinearSegment* FindLinearSegment(SegmentHandle segment) { return _segments.FindLinearSegment(segment); }
+    LinearSegment& GetLinearSegment(SegmentHandle segment) { return _segments.GetLinearSegment(_segments.IndexOf(segment)); }
+    const SegmentEnds& GetSegmentEnds(SegmentHandle segment) const; // std::out_of_range if stale
+    std::size_t LinearSegmentCount() const { return _segments.LinearSegmentCount(); }
+    bool EraseLinearSegment(SegmentHandle segment);
+
+    // Segments that start or end at vertex (empty for a stale handle); O(1) lookup
+    const std::vector<SegmentHandle>& SegmentsOf(VertexHandle vertex) const;
+
+    /**
+     * @brief Reorder storage for locality and release spare capacity
+     *
+     * Vertices are laid out in the order segments reach them, so walking the segments walks
+     * the vertex array mostly forward; segments are then sorted by their start vertex. Handles
+     * stay valid; every segment is rebound.
+     */
+    void Compact();
+
+    // Dense vertex storage, for iteration
+    const SlotMap<Vertex>& Vertices() const { return _vertices; }
+
+    // Tessellation, spatial index and curve queries over every segment. Add and erase segments
+    // through ObjectManager so the adjacency index stays in step
+    SegmentManager& Segments() { return _segments; }
+    const SegmentManager& Segments() const { return _segments; }
 };
 
-#endif // OBJECTMANAGER_H
\ No newline at end of file
+#endif // OBJECTMANAGER_H
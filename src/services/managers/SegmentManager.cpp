@@ -0,0 +1,317 @@
+// SegmentManager.cpp
+
+#include "SegmentManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+SegmentManager::SegmentManager(TaskScheduler& scheduler, std::size_t grainSize)
+    : _scheduler(scheduler),
+      _grainSize(grainSize == 0 ? kDefaultGrainSize : grainSize),
+      _bvhNeedsBuild(true),
+      _indexEpoch(0)
+{
+}
+
+SegmentManager::~SegmentManager()
+{
+    // Workers may still hold segment pointers
+    if (_pending.valid())
+        _pending.wait();
+}
+
+std::size_t SegmentManager::AddLinearSegment(const Vertex& start, const Vertex& end, float alpha, int numSegments)
+{
+    Wait();
+    _linearSegments.Insert(std::make_unique<LinearSegment>(start, end, alpha, numSegments, true));
+    _bvhNeedsBuild = true;
+    return _linearSegments.Size() - 1;
+}
+
+LinearSegment& SegmentManager::GetLinearSegment(std::size_t index)
+{
+    Wait();
+    if (index >= _linearSegments.Size())
+        throw std::out_of_range("SegmentManager: segment index out of range");
+    return *_linearSegments[index];
+}
+
+void SegmentManager::Clear()
+{
+    Wait();
+    _linearSegments.Clear();
+    _bvh.Clear();
+    _bvhNeedsBuild = true;
+}
+
+std::size_t SegmentManager::IndexOf(SegmentHandle segment) const
+{
+    if (!_linearSegments.Contains(segment))
+        throw std::out_of_range("SegmentManager: stale segment handle");
+    return _linearSegments.DenseIndex(segment);
+}
+
+LinearSegment* SegmentManager::FindLinearSegment(SegmentHandle segment)
+{
+    Wait();
+    std::unique_ptr<LinearSegment>* owned = _linearSegments.Find(segment);
+    return owned ? owned->get() : nullptr;
+}
+
+bool SegmentManager::EraseLinearSegment(SegmentHandle segment)
+{
+    Wait();
+    if (!_linearSegments.Erase(segment))
+        return false;
+    _bvhNeedsBuild = true; // Indices moved
+    return true;
+}
+
+void SegmentManager::ReorderLinearSegments(const std::vector<uint32_t>& order)
+{
+    Wait();
+    _linearSegments.Reorder(order);
+    _bvhNeedsBuild = true;
+}
+
+std::vector<LinearSegment*> SegmentManager::CollectDirty() const
+{
+    std::vector<LinearSegment*> dirty;
+    for (const std::unique_ptr<LinearSegment>& segment : _linearSegments)
+    {
+        if (segment->IsStale())
+            dirty.push_back(segment.get());
+    }
+    return dirty;
+}
+
+std::size_t SegmentManager::CountDirty() const
+{
+    Wait();
+    return CollectDirty().size();
+}
+
+std::size_t SegmentManager::TessellateDirty()
+{
+    Wait();
+    std::vector<LinearSegment*> dirty = CollectDirty();
+    _scheduler.ParallelFor(dirty.size(), _grainSize, [&dirty](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+            dirty[i]->Commit();
+    });
+    return dirty.size();
+}
+
+std::shared_future<std::size_t> SegmentManager::TessellateDirtyAsync()
+{
+    Wait();
+    // The dirty list is taken here, so segments added later wait for the next call
+    auto dirty = std::make_shared<std::vector<LinearSegment*>>(CollectDirty());
+    TaskScheduler* scheduler = &_scheduler;
+    std::size_t grainSize = _grainSize;
+    _pending = _scheduler.Submit([scheduler, grainSize, dirty]() {
+        scheduler->ParallelFor(dirty->size(), grainSize, [&dirty](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+                (*dirty)[i]->Commit();
+        });
+        return dirty->size();
+    }).share();
+    return _pending;
+}
+
+void SegmentManager::Wait() const
+{
+    if (!_pending.valid())
+        return;
+    std::shared_future<std::size_t> pending = std::move(_pending);
+    _pending = std::shared_future<std::size_t>();
+    pending.get();
+}
+
+bool SegmentManager::IsBusy() const
+{
+    return _pending.valid() && _pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+std::vector<AABB> SegmentManager::CollectBounds() const
+{
+    std::vector<AABB> bounds;
+    bounds.reserve(_linearSegments.Size());
+    for (const std::unique_ptr<LinearSegment>& segment : _linearSegments)
+        bounds.push_back(segment->GetBounds());
+    return bounds;
+}
+
+std::size_t SegmentManager::UpdateSpatialIndex()
+{
+    // Read before the scan: an edit racing with it leaves the epoch changed for the next call
+    uint64_t epoch = EditEpoch::Current();
+    std::size_t rebuilt = TessellateDirty();
+    if (_bvhNeedsBuild)
+    {
+        _bvh.Build(CollectBounds());
+        _bvhNeedsBuild = false;
+    }
+    else if (rebuilt > 0 || epoch != _indexEpoch)
+    {
+        // Segments rebuilt elsewhere (TessellateDirty, TessellateDirtyAsync, a getter refresh)
+        // since the last update leave rebuilt == 0 here, so any edit since then refits (O(N))
+        _bvh.Refit(CollectBounds());
+    }
+    _indexEpoch = epoch;
+    return rebuilt;
+}
+
+void SegmentManager::RebuildSpatialIndex()
+{
+    _bvhNeedsBuild = true;
+    UpdateSpatialIndex();
+}
+
+const SegmentBVH& SegmentManager::GetSpatialIndex()
+{
+    // The per-segment dirty scan costs milliseconds on large scenes; skip it when nothing changed
+    if (_bvhNeedsBuild || EditEpoch::Current() != _indexEpoch)
+        UpdateSpatialIndex();
+    else
+        Wait();
+    return _bvh;
+}
+
+std::vector<std::size_t> SegmentManager::QueryBox(const AABB& box)
+{
+    std::vector<std::size_t> candidates;
+    GetSpatialIndex().QueryBox(box, candidates);
+    return candidates;
+}
+
+std::vector<std::size_t> SegmentManager::QuerySphere(const Vector3& center, float radius)
+{
+    std::vector<std::size_t> candidates;
+    GetSpatialIndex().QuerySphere(center, radius, candidates);
+    return candidates;
+}
+
+std::vector<std::size_t> SegmentManager::QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance)
+{
+    std::vector<std::size_t> candidates;
+    GetSpatialIndex().QueryRay(origin, direction, maxDistance, candidates);
+    return candidates;
+}
+
+bool SegmentManager::ClosestSegment(const Vector3& point, float maxDistance, SegmentHit& hit)
+{
+    const SegmentBVH& bvh = GetSpatialIndex();
+    bool found = false;
+    bvh.QueryNearest(point, maxDistance, [&](std::size_t index, float radius) {
+        CurveHit candidate;
+        if (_linearSegments[index]->ClosestPoint(point, radius, candidate) && (!found || candidate.Distance < hit.Hit.Distance))
+        {
+            hit = SegmentHit{index, candidate};
+            found = true;
+            return candidate.Distance;
+        }
+        return radius;
+    });
+    return found;
+}
+
+bool SegmentManager::PickSegment(const Vector3& origin, const Vector3& direction, float radius, SegmentHit& hit)
+{
+    std::vector<std::size_t> candidates;
+    GetSpatialIndex().QueryRay(origin, direction, std::numeric_limits<float>::max(), candidates, radius);
+    if (candidates.empty())
+        return false;
+
+    Vector3 unit = direction.normalized();
+    const float inf = std::numeric_limits<float>::infinity();
+    Vector3 inverse(unit.x != 0.0f ? 1.0f / unit.x : inf,
+                    unit.y != 0.0f ? 1.0f / unit.y : inf,
+                    unit.z != 0.0f ? 1.0f / unit.z : inf);
+
+    bool found = false;
+    float best = radius;
+    for (std::size_t index : candidates)
+    {
+        const LinearSegment& segment = *_linearSegments[index];
+
+        // The curve lies in its box, so a box that the ray misses when grown by the best distance
+        // so far cannot hold a closer point; skip the exact refinement
+        if (found)
+        {
+            AABB box = segment.GetBounds();
+            const Vector3 pad(best, best, best);
+            if (!AABB(box.Min - pad, box.Max + pad).IntersectsRay(origin, inverse, std::numeric_limits<float>::max()))
+                continue;
+        }
+
+        CurveHit candidate;
+        if (segment.PickRay(origin, direction, best, candidate) && (!found || candidate.Distance < hit.Hit.Distance))
+        {
+            hit = SegmentHit{index, candidate};
+            best = candidate.Distance;
+            found = true;
+        }
+    }
+    return found;
+}
+
+std::vector<SegmentProximity> SegmentManager::FindProximities(float clearance, bool skipAdjacent)
+{
+    UpdateSpatialIndex();
+
+    // Every segment is fresh now, so the narrow phase only reads them
+    std::mutex mutex;
+    std::vector<SegmentProximity> found;
+    const Vector3 pad(clearance, clearance, clearance);
+    _scheduler.ParallelFor(_linearSegments.Size(), _grainSize, [&](std::size_t begin, std::size_t end) {
+        std::vector<SegmentProximity> local;
+        std::vector<std::size_t> candidates;
+        for (std::size_t a = begin; a < end; ++a)
+        {
+            const LinearSegment& segmentA = *_linearSegments[a];
+            AABB box = segmentA.GetBounds();
+            if (box.IsEmpty())
+                continue;
+            candidates.clear();
+            _bvh.QueryBox(AABB(box.Min - pad, box.Max + pad), candidates);
+            for (std::size_t b : candidates)
+            {
+                const LinearSegment& segmentB = *_linearSegments[b];
+                if (b <= a || (skipAdjacent && segmentA.SharesVertex(segmentB)))
+                    continue;
+                CurvePairHit hit;
+                if (segmentA.ClosestPair(segmentB, clearance, hit))
+                    local.push_back(SegmentProximity{a, b, hit});
+            }
+        }
+        if (!local.empty())
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            found.insert(found.end(), local.begin(), local.end());
+        }
+    });
+
+    std::sort(found.begin(), found.end(), [](const SegmentProximity& x, const SegmentProximity& y) {
+        return x.SegmentA != y.SegmentA ? x.SegmentA < y.SegmentA : x.SegmentB < y.SegmentB;
+    });
+    return found;
+}
+
+void SegmentManager::CollectVertices(std::vector<Vector3>& out, std::vector<std::size_t>& offsets) const
+{
+    Wait();
+    out.clear();
+    offsets.assign(1, 0);
+    offsets.reserve(_linearSegments.Size() + 1);
+    for (const std::unique_ptr<LinearSegment>& segment : _linearSegments)
+    {
+        std::shared_ptr<const std::vector<Vector3>> cache = segment->GetLinearSegmentCache();
+        out.insert(out.end(), cache->begin(), cache->end());
+        offsets.push_back(out.size());
+    }
+}
@@ -4,33 +4,170 @@
  * Security: Top Secret
  * Author: Minseok Doo
  * Date: Nov 23, 2024
- * Last Modified: Nov 23, 2024
- * 
- * Purpose: 
+ * Last Modified: Oct 17, 2026
+ *
+ * Purpose:
  * Manage LinearSegment, SurfaceSegment and Index Buffer
- * 
+ * Tessellates dirty segments in parallel on the shared TaskScheduler
+ * Keeps a SegmentBVH over the segment bounds for spatial candidate queries
+ *
  */
 
 #ifndef SEGMENTMANAGER_H
 #define SEGMENTMANAGER_H
 
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "EditEpoch.h"
 #include "IndexBuffer.h"
 #include "LinearSegment.h"
 #include "SurfaceSegment.h"
+#include "SegmentBVH.h"
+#include "SlotMap.h"
+#include "thread.h"
+
+// Generational handle of a segment owned by a SegmentManager
+using SegmentHandle = SlotMap<std::unique_ptr<LinearSegment>>::Handle;
+
+/**
+ * @brief Result of a pick or closest-point query over all segments
+ */
+struct SegmentHit
+{
+    std::size_t Segment;
+    CurveHit Hit;
+};
+
+/**
+ * @brief Two segments that come within the clearance distance (Distance 0 where they cross)
+ */
+struct SegmentProximity
+{
+    std::size_t SegmentA; // SegmentA < SegmentB
+    std::size_t SegmentB;
+    CurvePairHit Hit;
+};
 
 /**
  * @brief SegmentManager; 6 dimension pointer array storage for manage segments.
- * 
+ *
  * Expected input_01 [int lod, std::vector<NodeVector> NodeVector StartNode, NodeVector EndNode, std::vector<BearingVector> BearingVector StartNodeBearing, EndNodeBearing]
  * Expected input_02 [std::vector<NodeVector> NodeVector node01, NodeVector node02, NodeVector node03 ..., std::vector<BearingVector> BearingVector bearing01, bearing02, bearing03 ...]
+ *
+ * Owned segments are created in deferred mode: construction and edits only mark them dirty, and
+ * TessellateDirty rebuilds every dirty segment in parallel, in contiguous index ranges. Each
+ * segment writes only its own cache, so the result is identical to a serial rebuild and
+ * CollectVertices always concatenates in index order.
+ *
+ * Spatial queries first bring the index up to date: dirty segments are tessellated, then the
+ * BVH is refit (edits only) or rebuilt (segments added or removed). Candidates are segment
+ * indices whose control-polygon box passes the test.
+ *
+ * Not thread-safe itself: call it from one thread. Accessors wait for a pending
+ * TessellateDirtyAsync first, so the caller never observes a half-built state.
  */
 class SegmentManager
 {
 private:
-    /* data */
+    SlotMap<std::unique_ptr<LinearSegment>> _linearSegments; // Dense, so segment indices are storage positions
+    TaskScheduler& _scheduler;
+    std::size_t _grainSize;
+    mutable std::shared_future<std::size_t> _pending;
+
+    // Spatial index over GetBounds() of every segment, by segment index
+    SegmentBVH _bvh;
+    bool _bvhNeedsBuild;
+    uint64_t _indexEpoch; // EditEpoch when the last UpdateSpatialIndex started
+
+    std::vector<AABB> CollectBounds() const;
+
+    // Dirty segments in index order
+    std::vector<LinearSegment*> CollectDirty() const;
+
 public:
-    SegmentManager(/* args */);
+    static constexpr std::size_t kDefaultGrainSize = 32;
+
+    explicit SegmentManager(TaskScheduler& scheduler = TaskScheduler::Default(), std::size_t grainSize = kDefaultGrainSize);
     ~SegmentManager();
+
+    SegmentManager(const SegmentManager&) = delete;
+    SegmentManager& operator=(const SegmentManager&) = delete;
+
+    // Vertices must outlive the segment; returns the segment index (not tessellated yet)
+    std::size_t AddLinearSegment(const Vertex& start, const Vertex& end, float alpha = 0.5f, int numSegments = 100);
+    LinearSegment& GetLinearSegment(std::size_t index); // std::out_of_range past the end
+    std::size_t LinearSegmentCount() const { return _linearSegments.Size(); }
+    void Clear();
+
+    // Indices (including those in query results) are dense and change when a segment is erased or
+    // the storage reordered; handles stay valid until their own segment is erased or Clear
+    SegmentHandle HandleAt(std::size_t index) const { return _linearSegments.HandleAt(index); }
+    bool ContainsLinearSegment(SegmentHandle segment) const { return _linearSegments.Contains(segment); }
+    std::size_t IndexOf(SegmentHandle segment) const; // std::out_of_range if stale
+    LinearSegment* FindLinearSegment(SegmentHandle segment); // nullptr if stale
+
+    // Swap-remove: the last segment takes the erased index; false for a stale handle
+    bool EraseLinearSegment(SegmentHandle segment);
+
+    // New index i takes the segment at old index order[i], e.g. to follow the vertex layout
+    void ReorderLinearSegments(const std::vector<uint32_t>& order);
+
+    // Segments whose cache is out of date
+    std::size_t CountDirty() const;
+
+    // Rebuild every dirty segment on the scheduler and wait; returns the number rebuilt
+    std::size_t TessellateDirty();
+
+    // Same, without waiting; the future resolves once every dirty segment is rebuilt
+    std::shared_future<std::size_t> TessellateDirtyAsync();
+
+    // Barrier: block until the pending TessellateDirtyAsync (if any) is done; rethrows its error once
+    void Wait() const;
+    bool IsBusy() const;
+
+    // Tessellate dirty segments and refit (or rebuild) the BVH; returns the number of segments rebuilt
+    std::size_t UpdateSpatialIndex();
+
+    // Full rebuild; refits keep the topology, so call this after large moves
+    void RebuildSpatialIndex();
+
+    // Up-to-date index; O(1) when nothing was edited anywhere since the last update (EditEpoch)
+    const SegmentBVH& GetSpatialIndex();
+
+    // Candidate segments for a box, a sphere or a ray (nearest box entry first)
+    std::vector<std::size_t> QueryBox(const AABB& box);
+    std::vector<std::size_t> QuerySphere(const Vector3& center, float radius);
+    std::vector<std::size_t> QueryRay(const Vector3& origin, const Vector3& direction, float maxDistance);
+
+    // Exact curve queries, refined per segment with CurveQuery. Like the candidate queries above they
+    // bring the index up to date first (GetSpatialIndex), so edits made since are never missed.
+
+    // Nearest curve point over all segments; false if none is within maxDistance
+    bool ClosestSegment(const Vector3& point, float maxDistance, SegmentHit& hit);
+
+    // Curve point nearest to the ray over all segments (smallest perpendicular distance); false if none is within radius
+    bool PickSegment(const Vector3& origin, const Vector3& direction, float radius, SegmentHit& hit);
+
+    /**
+     * @brief Every pair of segments whose curves come within clearance, sorted by (SegmentA, SegmentB)
+     *
+     * Brings the spatial index up to date, then in parallel on the scheduler: each segment
+     * queries the BVH with its box grown by clearance (broad phase) and the surviving pairs run
+     * CurveQuery::ClosestPair (narrow phase). One entry per pair, at its closest points.
+     * Segments that share a vertex always touch there; skipAdjacent leaves those pairs out.
+     */
+    std::vector<SegmentProximity> FindProximities(float clearance, bool skipAdjacent = true);
+
+    /**
+     * @brief Concatenate every segment's sample points in index order
+     *
+     * offsets receives LinearSegmentCount() + 1 entries; segment i owns [offsets[i], offsets[i + 1]).
+     * Segments still dirty are rebuilt on the calling thread, so call TessellateDirty first.
+     */
+    void CollectVertices(std::vector<Vector3>& out, std::vector<std::size_t>& offsets) const;
 };
 
-#endif // SEGMENTMANAGER_H
\ No newline at end of file
+#endif // SEGMENTMANAGER_H
@@ -0,0 +1,403 @@
+// thread.cpp
+
+#include "thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace
+{
+    // Chunk counters shared by the caller and the helper tasks of one ParallelFor
+    struct ParallelForState
+    {
+        std::size_t count;
+        std::size_t chunkSize;
+        std::size_t chunks;
+        const std::function<void(std::size_t, std::size_t)>* body;
+
+        std::atomic<std::size_t> next{0};
+        std::size_t finished = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        // Claim and run chunks until none are left
+        void Drain()
+        {
+            for (std::size_t chunk = next.fetch_add(1); chunk < chunks; chunk = next.fetch_add(1))
+            {
+                std::size_t begin = chunk * chunkSize;
+                std::size_t end = std::min(count, begin + chunkSize);
+                std::exception_ptr caught;
+                try
+                {
+                    (*body)(begin, end);
+                }
+                catch (...)
+                {
+                    caught = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (caught && !error)
+                    error = caught;
+                if (++finished == chunks)
+                    done.notify_all();
+            }
+        }
+    };
+}
+
+ThreadPool::ThreadPool(std::size_t threads)
+    : _stopping(false)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    _workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i)
+        _workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _available.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+ThreadPool& ThreadPool::Default()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(std::move(task));
+    }
+    _available.notify_one();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _available.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+            if (_queue.empty())
+                return; // stopping and drained
+            task = std::move(_queue.front());
+            _queue.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, std::size_t chunkSize,
+                             const std::function<void(std::size_t begin, std::size_t end)>& body)
+{
+    if (count == 0)
+        return;
+    chunkSize = std::max<std::size_t>(1, chunkSize);
+
+    auto state = std::make_shared<ParallelForState>();
+    state->count = count;
+    state->chunkSize = chunkSize;
+    state->chunks = (count + chunkSize - 1) / chunkSize;
+    state->body = &body;
+
+    // One helper per worker at most; the caller works as well
+    std::size_t helpers = std::min(Size(), state->chunks - 1);
+    for (std::size_t i = 0; i < helpers; ++i)
+        Enqueue([state]() { state->Drain(); });
+    state->Drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() { return state->finished == state->chunks; });
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+namespace
+{
+    // Worker identity of the current thread, so Spawn and TryRunOne can use the local deque
+    thread_local const TaskScheduler* tlsScheduler = nullptr;
+    thread_local std::size_t tlsWorker = 0;
+}
+
+TaskScheduler::TaskScheduler(std::size_t workers)
+    : _queued(0),
+      _nextQueue(0),
+      _steals(0),
+      _sleeping(0),
+      _stopping(false)
+{
+    if (workers == 0)
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    _queues.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        _queues.push_back(std::make_unique<WorkerQueue>());
+    _workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        _workers.emplace_back(&TaskScheduler::WorkerLoop, this, i);
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+TaskScheduler& TaskScheduler::Default()
+{
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+void TaskScheduler::Spawn(std::function<void()> task)
+{
+    std::size_t index = (tlsScheduler == this)
+                            ? tlsWorker
+                            : _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    {
+        std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+        _queues[index]->tasks.push_back(std::move(task));
+    }
+    _queued.fetch_add(1);
+
+    // Sleepers re-check _queued under _sleepMutex, so taking it here cannot lose the wake-up
+    if (_sleeping.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _wake.notify_one();
+    }
+}
+
+bool TaskScheduler::Pop(std::size_t worker, std::function<void()>& task)
+{
+    WorkerQueue& queue = *_queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    _queued.fetch_sub(1);
+    return true;
+}
+
+bool TaskScheduler::Steal(std::size_t thief, std::function<void()>& task)
+{
+    const std::size_t count = _queues.size();
+    for (std::size_t offset = 1; offset <= count; ++offset)
+    {
+        std::size_t victim = (thief + offset) % count;
+        WorkerQueue& queue = *_queues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        _queued.fetch_sub(1);
+        if (victim != thief)
+            _steals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool TaskScheduler::TryRunOne()
+{
+    std::function<void()> task;
+    bool found = (tlsScheduler == this)
+                     ? (Pop(tlsWorker, task) || Steal(tlsWorker, task))
+                     : Steal(_nextQueue.load(std::memory_order_relaxed) % _queues.size(), task);
+    if (!found)
+        return false;
+    task();
+    return true;
+}
+
+void TaskScheduler::WorkerLoop(std::size_t worker)
+{
+    tlsScheduler = this;
+    tlsWorker = worker;
+    for (;;)
+    {
+        std::function<void()> task;
+        if (Pop(worker, task) || Steal(worker, task))
+        {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleeping.fetch_add(1);
+        _wake.wait(lock, [this]() { return _stopping || _queued.load() > 0; });
+        _sleeping.fetch_sub(1);
+        if (_stopping && _queued.load() == 0)
+            return; // stopping and drained
+    }
+}
+
+void TaskScheduler::ParallelFor(std::size_t count, std::size_t grainSize,
+                                const std::function<void(std::size_t begin, std::size_t end)>& body)
+{
+    if (count == 0)
+        return;
+    if (grainSize == 0)
+        grainSize = std::max<std::size_t>(1, count / (8 * Size()));
+
+    TaskGroup group(*this);
+    // Keep the left half, spawn the right half (see header)
+    std::function<void(std::size_t, std::size_t)> split = [&](std::size_t begin, std::size_t end) {
+        while (end - begin > grainSize)
+        {
+            std::size_t middle = begin + (end - begin) / 2;
+            group.Run([&split, middle, end]() { split(middle, end); });
+            end = middle;
+        }
+        body(begin, end);
+    };
+
+    std::exception_ptr error;
+    try
+    {
+        split(0, count);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    // Always wait: queued pieces reference split and body
+    try
+    {
+        group.Wait();
+    }
+    catch (...)
+    {
+        if (!error)
+            error = std::current_exception();
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+TaskGroup::TaskGroup(TaskScheduler& scheduler)
+    : _scheduler(scheduler),
+      _state(std::make_shared<State>())
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+        // Errors are only reported through an explicit Wait()
+    }
+}
+
+void TaskGroup::Launch(TaskScheduler& scheduler, const std::shared_ptr<State>& state, std::function<void()> task)
+{
+    TaskScheduler* owner = &scheduler;
+    scheduler.Spawn([owner, state, task = std::move(task)]() {
+        std::exception_ptr caught;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            caught = std::current_exception();
+        }
+
+        std::vector<std::function<void()>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (caught && !state->error)
+                state->error = caught;
+            if (--state->pending == 0)
+            {
+                // Continuations join the group before it can be seen idle
+                continuations.swap(state->continuations);
+                state->pending += continuations.size();
+                if (continuations.empty())
+                    state->idle.notify_all();
+            }
+        }
+        for (std::function<void()>& continuation : continuations)
+            Launch(*owner, state, std::move(continuation));
+    });
+}
+
+void TaskGroup::Run(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        ++_state->pending;
+    }
+    Launch(_scheduler, _state, std::move(task));
+}
+
+void TaskGroup::Then(std::function<void()> continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        if (_state->pending != 0)
+        {
+            _state->continuations.push_back(std::move(continuation));
+            return;
+        }
+        ++_state->pending;
+    }
+    Launch(_scheduler, _state, std::move(continuation));
+}
+
+bool TaskGroup::Done() const
+{
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    return _state->pending == 0;
+}
+
+void TaskGroup::Wait()
+{
+    for (;;)
+    {
+        if (Done())
+            break;
+        // Help instead of blocking; this is what keeps nested groups on workers deadlock-free
+        if (_scheduler.TryRunOne())
+            continue;
+        std::unique_lock<std::mutex> lock(_state->mutex);
+        _state->idle.wait_for(lock, std::chrono::milliseconds(1), [this]() { return _state->pending == 0; });
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        error = std::move(_state->error);
+        _state->error = nullptr;
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
@@ -0,0 +1,202 @@
+/**
+ * thread.h
+ * Linked file: thread.cpp
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Shared execution resources for CPU-bound work
+ * ThreadPool: fixed-size pool with one mutex-guarded FIFO queue
+ * TaskScheduler: work-stealing scheduler with per-worker deques, task groups and continuations
+ */
+
+#ifndef THREAD_H
+#define THREAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Fixed-size thread pool with a single FIFO queue
+ *
+ * Workers start in the constructor and are joined in the destructor after the queue drains.
+ * Submit returns a std::future; exceptions thrown by a task are delivered through it.
+ */
+class ThreadPool
+{
+public:
+    // threads == 0 uses std::thread::hardware_concurrency() (at least 1)
+    explicit ThreadPool(std::size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t Size() const { return _workers.size(); }
+
+    // Queue a callable; its result (or exception) is delivered through the returned future
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& task)
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        Enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * @brief Run body(begin, end) over [0, count) in contiguous chunks and wait for all of them
+     *
+     * Chunks are handed out in index order; the calling thread takes chunks too, so calling this
+     * from a worker cannot deadlock. The first exception thrown by body is rethrown here after
+     * every chunk has finished.
+     */
+    void ParallelFor(std::size_t count, std::size_t chunkSize,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    // Shared pool sized to the machine
+    static ThreadPool& Default();
+
+private:
+    void Enqueue(std::function<void()> task);
+    void WorkerLoop();
+
+    std::vector<std::thread> _workers;
+    std::deque<std::function<void()>> _queue;
+    std::mutex _mutex;
+    std::condition_variable _available;
+    bool _stopping;
+};
+
+/**
+ * @brief Work-stealing task scheduler
+ *
+ * Every worker owns a deque. Tasks spawned on a worker go to the back of its own deque and are
+ * popped LIFO (hot in cache); idle workers steal FIFO from the front of the others, which takes
+ * the oldest, largest pieces of a recursive split. Tasks spawned from outside are dealt
+ * round-robin over the deques. Threads that wait on a TaskGroup run queued tasks meanwhile, so
+ * nested parallelism never blocks a worker.
+ *
+ * Default() is the process-wide instance sized from hardware concurrency; segment tessellation,
+ * surface meshing and server request offload are meant to share it rather than own threads.
+ */
+class TaskScheduler
+{
+public:
+    // workers == 0 uses std::thread::hardware_concurrency() (at least 1)
+    explicit TaskScheduler(std::size_t workers = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    std::size_t Size() const { return _workers.size(); }
+
+    // Fire and forget; task must not throw (use Submit or a TaskGroup to propagate errors)
+    void Spawn(std::function<void()> task);
+
+    // Queue a callable; its result (or exception) is delivered through the returned future
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& task)
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> future = packaged->get_future();
+        Spawn([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * @brief Run body(begin, end) over [0, count) and wait
+     *
+     * The range is split in halves until a piece is at most grainSize long; the right half is
+     * spawned and the left half is kept, so thieves take big pieces and the owner walks its
+     * range in order. grainSize == 0 picks count / (8 * Size()). The first exception thrown by
+     * body is rethrown after every piece has finished.
+     */
+    void ParallelFor(std::size_t count, std::size_t grainSize,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    // Run one queued task on the calling thread; false when every deque is empty
+    bool TryRunOne();
+
+    // Tasks taken from another worker's deque since construction
+    std::size_t StealCount() const { return _steals.load(std::memory_order_relaxed); }
+
+    static TaskScheduler& Default();
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool Pop(std::size_t worker, std::function<void()>& task);
+    bool Steal(std::size_t thief, std::function<void()>& task);
+    void WorkerLoop(std::size_t worker);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _workers;
+    std::atomic<std::size_t> _queued;
+    std::atomic<std::size_t> _nextQueue;
+    std::atomic<std::size_t> _steals;
+
+    // Idle workers sleep here; _sleeping lets Spawn skip the lock when everybody is busy
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    std::atomic<std::size_t> _sleeping;
+    bool _stopping;
+};
+
+/**
+ * @brief Set of tasks that can be waited on together
+ *
+ * Wait() runs queued tasks while the group is busy and rethrows the first exception of any
+ * member. Then() registers a continuation that is spawned into the group the next time it
+ * becomes idle (at once if it already is), so Wait() also covers continuations. The destructor
+ * waits but swallows errors.
+ */
+class TaskGroup
+{
+public:
+    explicit TaskGroup(TaskScheduler& scheduler = TaskScheduler::Default());
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void Run(std::function<void()> task);
+    void Then(std::function<void()> continuation);
+    void Wait();
+    bool Done() const;
+
+private:
+    // Shared with the queued tasks, so a finishing task never touches a destroyed group
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable idle;
+        std::size_t pending = 0;
+        std::vector<std::function<void()>> continuations;
+        std::exception_ptr error;
+    };
+
+    static void Launch(TaskScheduler& scheduler, const std::shared_ptr<State>& state, std::function<void()> task);
+
+    TaskScheduler& _scheduler;
+    std::shared_ptr<State> _state;
+};
+
+#endif // THREAD_H
@@ -0,0 +1,69 @@
+// NodeTableTest.cc
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "NodeTable.h"
+#include "BearingVector.h"
+
+// 테스트 케이스 1: Index 기준 중복 제거
+TEST(NodeTableTest, InternDeduplicatesByIndex) {
+    NodeTable table;
+    NodeHandle a = table.Intern(NodeVector(3, Vector3(1.0f, 2.0f, 3.0f)));
+    NodeHandle b = table.Intern(NodeVector(4, Vector3(0.0f, 0.0f, 0.0f)));
+    NodeHandle c = table.Intern(NodeVector(3, Vector3(9.0f, 9.0f, 9.0f))); // 기존 항목 유지
+
+    EXPECT_EQ(a, c);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(table.Size(), 2);
+    EXPECT_EQ(table.Get(a).Vector, Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(table.Find(4), b);
+    EXPECT_EQ(table.Find(5), kInvalidNodeHandle);
+}
+
+// 테스트 케이스 2: Update 및 Index 충돌
+TEST(NodeTableTest, UpdateRekeysAndRejectsConflicts) {
+    NodeTable table;
+    NodeHandle a = table.Intern(NodeVector(1, Vector3()));
+    NodeHandle b = table.Intern(NodeVector(2, Vector3()));
+
+    table.Update(a, NodeVector(10, Vector3(1.0f, 0.0f, 0.0f)));
+    EXPECT_EQ(table.Find(10), a);
+    EXPECT_EQ(table.Find(1), kInvalidNodeHandle);
+    EXPECT_THROW(table.Update(b, NodeVector(10, Vector3())), std::invalid_argument);
+    EXPECT_THROW(table.Update(7, NodeVector(7, Vector3())), std::out_of_range);
+}
+
+// 테스트 케이스 3: BearingVectorRef는 BearingVector와 같은 JSON
+TEST(NodeTableTest, BearingVectorRefRoundTrip) {
+    NodeTable table;
+    BearingVector bearing(NodeVector(5, Vector3(1.0f, 1.0f, 0.0f)), Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f));
+    BearingVectorRef ref = BearingVectorRef::FromBearing(bearing, table);
+
+    EXPECT_EQ(ref.toJson(table), bearing.toJson());
+    BearingVectorRef back = BearingVectorRef::fromJson(bearing.toJson(), table);
+    EXPECT_EQ(back.Node, ref.Node);
+    EXPECT_EQ(table.Size(), 1);
+
+    NodeTable restored = NodeTable::fromJson(table.toJson());
+    EXPECT_EQ(restored.Get(0).Index, 5);
+}
+
+// 테스트 케이스 4: 리비전은 핸들별로 증가하고, 같은 값의 Update는 리비전을 유지
+TEST(NodeTableTest, RevisionIsPerHandle) {
+    NodeTable table;
+    NodeHandle a = table.Intern(NodeVector(1, Vector3()));
+    NodeHandle b = table.Intern(NodeVector(2, Vector3()));
+    uint64_t aRevision = table.Revision(a);
+    uint64_t bRevision = table.Revision(b);
+
+    EXPECT_TRUE(table.Update(a, NodeVector(1, Vector3(1.0f, 0.0f, 0.0f))));
+    EXPECT_GT(table.Revision(a), aRevision);
+    EXPECT_EQ(table.Revision(b), bRevision);
+
+    aRevision = table.Revision(a);
+    EXPECT_FALSE(table.Update(a, NodeVector(1, Vector3(1.0f, 0.0f, 0.0f))));
+    EXPECT_EQ(table.Revision(a), aRevision);
+
+    table.Clear();
+    EXPECT_GT(table.Revision(a), aRevision);
+}
@@ -0,0 +1,95 @@
+// SlotMapTest.cc
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SlotMap.h"
+
+// 테스트 케이스 1: 삭제된 핸들은 슬롯이 재사용되어도 무효
+TEST(SlotMapTest, ErasedHandlesStayStale) {
+    SlotMap<std::string> map;
+    SlotMap<std::string>::Handle a = map.Insert("a");
+    SlotMap<std::string>::Handle b = map.Insert("b");
+    EXPECT_TRUE(map.Contains(a));
+    EXPECT_EQ(map.Get(b), "b");
+
+    EXPECT_TRUE(map.Erase(a));
+    EXPECT_FALSE(map.Erase(a));
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_EQ(map.Find(a), nullptr);
+    EXPECT_THROW(map.Get(a), std::out_of_range);
+
+    // 같은 슬롯을 재사용하지만 세대가 다름
+    SlotMap<std::string>::Handle c = map.Insert("c");
+    EXPECT_EQ(c.Index, a.Index);
+    EXPECT_NE(c, a);
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_EQ(map.Get(c), "c");
+    EXPECT_EQ(map.SlotCount(), 2u);
+
+    EXPECT_FALSE(map.Contains(SlotMap<std::string>::Handle()));
+}
+
+// 테스트 케이스 2: 삭제는 마지막 값을 빈자리로 옮기고 그 핸들을 알려줌
+TEST(SlotMapTest, EraseReportsMovedHandle) {
+    SlotMap<int> map;
+    std::vector<SlotMap<int>::Handle> handles;
+    for (int i = 0; i < 5; ++i) {
+        handles.push_back(map.Insert(i * 10));
+    }
+
+    SlotMap<int>::Handle moved;
+    EXPECT_TRUE(map.Erase(handles[1], &moved));
+    EXPECT_EQ(moved, handles[4]);
+    EXPECT_EQ(map.DenseIndex(handles[4]), 1u);
+    EXPECT_EQ(map.HandleAt(1), handles[4]);
+
+    // 마지막 값을 지우면 옮겨지는 값이 없음
+    EXPECT_TRUE(map.Erase(handles[3], &moved));
+    EXPECT_TRUE(moved.IsNull());
+
+    ASSERT_EQ(map.Size(), 3u);
+    EXPECT_EQ(map.Get(handles[0]), 0);
+    EXPECT_EQ(map.Get(handles[2]), 20);
+    EXPECT_EQ(map.Get(handles[4]), 40);
+    std::vector<int> dense(map.begin(), map.end());
+    EXPECT_EQ(dense, (std::vector<int>{0, 40, 20}));
+}
+
+// 테스트 케이스 3: 재배치 후에도 핸들이 같은 값을 가리킴
+TEST(SlotMapTest, ReorderKeepsHandles) {
+    SlotMap<int> map;
+    std::vector<SlotMap<int>::Handle> handles;
+    for (int i = 0; i < 4; ++i) {
+        handles.push_back(map.Insert(i));
+    }
+    map.Reorder({3, 1, 0, 2});
+    std::vector<int> dense(map.begin(), map.end());
+    EXPECT_EQ(dense, (std::vector<int>{3, 1, 0, 2}));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(map.Get(handles[i]), i);
+        EXPECT_EQ(map.HandleAt(map.DenseIndex(handles[i])), handles[i]);
+    }
+    EXPECT_THROW(map.Reorder({0, 1}), std::invalid_argument);
+}
+
+// 테스트 케이스 4: Clear 이전의 핸들은 다시 유효해지지 않음
+TEST(SlotMapTest, ClearRetiresHandles) {
+    SlotMap<int> map;
+    SlotMap<int>::Handle a = map.Insert(1);
+    SlotMap<int>::Handle b = map.Insert(2);
+    map.Clear();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_FALSE(map.Contains(b));
+
+    SlotMap<int>::Handle c = map.Insert(3);
+    SlotMap<int>::Handle d = map.Insert(4);
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_FALSE(map.Contains(b));
+    EXPECT_EQ(map.Get(c), 3);
+    EXPECT_EQ(map.Get(d), 4);
+    EXPECT_EQ(map.SlotCount(), 2u);
+}
@@ -0,0 +1,103 @@
+// Vector3ArrayTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3.h"
+#include "Vector3Array.h"
+#include "CpuFeatures.h"
+
+namespace {
+
+std::vector<Vector3> MakeVectors(size_t count, float seed) {
+    std::vector<Vector3> vectors;
+    for (size_t i = 0; i < count; ++i) {
+        float a = static_cast<float>(i) + seed;
+        vectors.emplace_back(std::sin(a) * 3.0f, std::cos(a * 1.3f) * 2.0f, a * 0.25f - 4.0f);
+    }
+    // 영벡터 정규화 경로 확인용
+    if (count > 3) vectors[3] = Vector3(0.0f, 0.0f, 0.0f);
+    return vectors;
+}
+
+void ExpectNear(const Vector3& actual, const Vector3& expected) {
+    EXPECT_NEAR(actual.x, expected.x, 1e-5f);
+    EXPECT_NEAR(actual.y, expected.y, 1e-5f);
+    EXPECT_NEAR(actual.z, expected.z, 1e-5f);
+}
+
+// 각 SIMD 레벨(스칼라 포함)에서 Vector3 연산 결과와 비교
+void CheckKernels() {
+    for (size_t count : {0u, 1u, 7u, 8u, 9u, 33u, 100u}) {
+        std::vector<Vector3> va = MakeVectors(count, 0.5f);
+        std::vector<Vector3> vb = MakeVectors(count, 2.0f);
+        Vector3Array a(va), b(vb), out;
+        std::vector<float> scalars;
+
+        Vector3Array::add(a, b, out);
+        for (size_t i = 0; i < count; ++i) ExpectNear(out[i], va[i] + vb[i]);
+
+        Vector3Array::subtract(a, b, out);
+        for (size_t i = 0; i < count; ++i) ExpectNear(out[i], va[i] - vb[i]);
+
+        Vector3Array::scale(a, 1.5f, out);
+        for (size_t i = 0; i < count; ++i) ExpectNear(out[i], va[i] * 1.5f);
+
+        Vector3Array::cross(a, b, out);
+        for (size_t i = 0; i < count; ++i) ExpectNear(out[i], va[i].cross(vb[i]));
+
+        Vector3Array::normalize(a, out);
+        for (size_t i = 0; i < count; ++i) ExpectNear(out[i], va[i].normalized());
+
+        Vector3Array::dot(a, b, scalars);
+        ASSERT_EQ(scalars.size(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_NEAR(scalars[i], va[i].dot(vb[i]), 1e-4f);
+
+        Vector3Array::magnitude(a, scalars);
+        for (size_t i = 0; i < count; ++i) EXPECT_NEAR(scalars[i], va[i].magnitude(), 1e-5f);
+
+        Vector3Array::distance(a, b, scalars);
+        for (size_t i = 0; i < count; ++i) EXPECT_NEAR(scalars[i], va[i].distance(vb[i]), 1e-5f);
+    }
+}
+
+} // namespace
+
+// 테스트 케이스 1: AoS <-> SoA 변환
+TEST(Vector3ArrayTest, RoundTripConversion) {
+    std::vector<Vector3> vectors = MakeVectors(19, 1.0f);
+    Vector3Array array(vectors);
+    EXPECT_EQ(array.size(), vectors.size());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.x()) % Vector3Array::kAlignment, 0u);
+
+    std::vector<Vector3> back = array.toVector();
+    ASSERT_EQ(back.size(), vectors.size());
+    for (size_t i = 0; i < vectors.size(); ++i) EXPECT_EQ(back[i], vectors[i]);
+
+    array.push_back(Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(array[19], Vector3(1.0f, 2.0f, 3.0f));
+    array.set(0, Vector3(4.0f, 5.0f, 6.0f));
+    EXPECT_EQ(array.get(0), Vector3(4.0f, 5.0f, 6.0f));
+}
+
+// 테스트 케이스 2: 런타임 디스패치 경로
+TEST(Vector3ArrayTest, KernelsMatchVector3) {
+    CheckKernels();
+}
+
+// 테스트 케이스 3: 스칼라 폴백 경로
+TEST(Vector3ArrayTest, ScalarFallbackMatchesVector3) {
+    CpuFeatures::Override(SimdLevel::Scalar);
+    EXPECT_EQ(CpuFeatures::Active(), SimdLevel::Scalar);
+    CheckKernels();
+    CpuFeatures::ClearOverride();
+    EXPECT_EQ(CpuFeatures::Active(), CpuFeatures::Detect());
+}
+
+// 테스트 케이스 4: 크기가 다른 피연산자
+TEST(Vector3ArrayTest, MismatchedSizesThrow) {
+    Vector3Array a(4), b(5), out;
+    EXPECT_THROW(Vector3Array::add(a, b, out), std::invalid_argument);
+}
@@ -138,3 +138,32 @@ TEST(Vector3Test, Deserialization) {
     EXPECT_FLOAT_EQ(v.y, 5.0f);
     EXPECT_FLOAT_EQ(v.z, 6.0f);
 }
+
+TEST(Vector3Test, ConstexprEvaluation) {
+    constexpr Vector3 a(1.0f, 2.0f, 3.0f);
+    constexpr Vector3 b(4.0f, 5.0f, 6.0f);
+    constexpr Vector3 sum = a + b;
+    constexpr Vector3 crossed = a.cross(b);
+    static_assert(sum.x == 5.0f && sum.y == 7.0f && sum.z == 9.0f, "constexpr addition");
+    static_assert(a.dot(b) == 32.0f, "constexpr dot product");
+    static_assert(crossed == Vector3(-3.0f, 6.0f, -3.0f), "constexpr cross product");
+    static_assert((2.0f * a)[2] == 6.0f, "constexpr scalar multiplication and index");
+    static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 layout");
+    EXPECT_EQ(sum, Vector3(5.0f, 7.0f, 9.0f));
+}
+
+TEST(Vector3Test, DoublePrecision) {
+    // float 로는 1e8 근처에서 0.5 차이를 표현할 수 없음
+    Vector3d a(1.0e8, 0.0, 0.0);
+    Vector3d b(1.0e8 + 0.5, 0.0, 0.0);
+    EXPECT_DOUBLE_EQ(a.distance(b), 0.5);
+
+    Vector3 narrowed(b);
+    Vector3d widened(narrowed);
+    EXPECT_FLOAT_EQ(narrowed.x, static_cast<float>(1.0e8 + 0.5));
+    EXPECT_DOUBLE_EQ(widened.x, static_cast<double>(narrowed.x));
+
+    json j = b.toJson();
+    Vector3d parsed = Vector3d::fromJson(j);
+    EXPECT_DOUBLE_EQ(parsed.x, 1.0e8 + 0.5);
+}
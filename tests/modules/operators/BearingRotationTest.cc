@@ -0,0 +1,126 @@
+// BearingRotationTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "BearingRotation.h"
+#include "CpuFeatures.h"
+
+constexpr float kRotationTolerance = 1e-5f;
+
+namespace {
+    std::vector<BearingVector> MakeBearings(size_t count) {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> coord(-5.0f, 5.0f);
+        NodeVector node(0, Vector3(0.0f, 0.0f, 0.0f));
+        std::vector<BearingVector> bearings;
+        for (size_t i = 0; i < count; ++i) {
+            bearings.emplace_back(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(coord(rng), coord(rng), coord(rng)));
+        }
+        return bearings;
+    }
+
+    void ExpectNear(const Vector3& a, const Vector3& b, float tolerance) {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+}
+
+// 테스트 케이스 1: 방향에서 만든 회전은 각도에서 만든 회전(Equ. 4-6)과 동일
+TEST(BearingRotationTest, FromDirectionMatchesFromAngles) {
+    const float theta = 0.7f, phi = 1.1f;
+    Vector3 direction(std::sin(phi) * std::cos(theta), std::sin(phi) * std::sin(theta), std::cos(phi)); // Equ. 1
+
+    RotationMatrix fromAngles = RotationMatrix::FromAngles(theta, phi);
+    RotationMatrix fromDirection = RotationMatrix::FromDirection(direction * 3.0f);
+    for (int k = 0; k < 9; ++k) {
+        EXPECT_NEAR(fromAngles.m[k], fromDirection.m[k], kRotationTolerance);
+    }
+
+    // 로컬 z축은 베어링 방향으로
+    ExpectNear(fromDirection.Apply(Vector3(0.0f, 0.0f, 1.0f)), direction, kRotationTolerance);
+}
+
+// 테스트 케이스 2: 직교 행렬이며 역회전은 전치
+TEST(BearingRotationTest, OrthonormalAndInverse) {
+    RotationMatrix r = RotationMatrix::FromDirection(Vector3(-1.0f, 2.0f, 0.5f));
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            float d = r(0, i) * r(0, j) + r(1, i) * r(1, j) + r(2, i) * r(2, j);
+            EXPECT_NEAR(d, i == j ? 1.0f : 0.0f, kRotationTolerance);
+        }
+    }
+    Vector3 v(0.3f, -1.2f, 4.0f);
+    ExpectNear(r.ApplyInverse(r.Apply(v)), v, kRotationTolerance);
+}
+
+// 테스트 케이스 3: 특이 방향 (영벡터, z축)
+TEST(BearingRotationTest, DegenerateDirections) {
+    RotationMatrix zero = RotationMatrix::FromDirection(Vector3(0.0f, 0.0f, 0.0f));
+    RotationMatrix identity = RotationMatrix::Identity();
+    for (int k = 0; k < 9; ++k) {
+        EXPECT_EQ(zero.m[k], identity.m[k]);
+    }
+    ExpectNear(RotationMatrix::FromDirection(Vector3(0.0f, 0.0f, 2.0f)).Apply(Vector3(0.0f, 0.0f, 1.0f)),
+               Vector3(0.0f, 0.0f, 1.0f), kRotationTolerance);
+    ExpectNear(RotationMatrix::FromDirection(Vector3(0.0f, 0.0f, -2.0f)).Apply(Vector3(0.0f, 0.0f, 1.0f)),
+               Vector3(0.0f, 0.0f, -1.0f), kRotationTolerance);
+}
+
+// 테스트 케이스 4: 배치 적용은 스칼라 적용과 동일 (SIMD / 스칼라 경로)
+TEST(BearingRotationTest, BatchApplyMatchesScalar) {
+    std::vector<BearingVector> bearings = MakeBearings(21);
+    BearingRotationSet rotations(bearings);
+    ASSERT_EQ(rotations.Size(), bearings.size());
+
+    Vector3Array local;
+    for (size_t i = 0; i < bearings.size(); ++i) {
+        local.push_back(Vector3(0.1f * i, 1.0f - 0.2f * i, 0.5f));
+    }
+    const Vector3 force(0.25f, -0.5f, 2.0f);
+
+    for (SimdLevel level : {CpuFeatures::Detect(), SimdLevel::Scalar}) {
+        CpuFeatures::Override(level);
+        SCOPED_TRACE(CpuFeatures::Name(level));
+
+        Vector3Array rotated, broadcast, restored;
+        rotations.Apply(local, rotated);
+        rotations.Apply(force, broadcast);
+        rotations.ApplyInverse(rotated, restored);
+
+        for (size_t i = 0; i < bearings.size(); ++i) {
+            RotationMatrix r = rotations.Get(i);
+            ExpectNear(rotated.get(i), r.Apply(local.get(i)), kRotationTolerance);
+            ExpectNear(broadcast.get(i), r.Apply(force), kRotationTolerance);
+            ExpectNear(restored.get(i), local.get(i), kRotationTolerance);
+        }
+    }
+    CpuFeatures::ClearOverride();
+
+    Vector3Array wrongSize(3);
+    Vector3Array out;
+    EXPECT_THROW(rotations.Apply(wrongSize, out), std::invalid_argument);
+}
+
+// 테스트 케이스 5: 증분 갱신은 재구성과 동일
+TEST(BearingRotationTest, IncrementalEditsMatchRebuild) {
+    std::vector<BearingVector> bearings = MakeBearings(5);
+    BearingRotationSet rotations;
+    for (const auto& bearing : bearings) {
+        rotations.PushBack(bearing);
+    }
+    bearings[2].Vector = Vector3(0.0f, 1.0f, 0.0f);
+    rotations.Set(2, bearings[2]);
+    bearings.pop_back();
+    rotations.PopBack();
+
+    BearingRotationSet rebuilt(bearings);
+    ASSERT_EQ(rotations.Size(), rebuilt.Size());
+    for (size_t i = 0; i < rebuilt.Size(); ++i) {
+        for (int k = 0; k < 9; ++k) {
+            EXPECT_EQ(rotations.Get(i).m[k], rebuilt.Get(i).m[k]);
+        }
+    }
+}
@@ -0,0 +1,134 @@
+// BinaryCodecTest.cc
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include "BinaryCodec.h"
+
+namespace {
+    std::vector<BearingVector> MakeBearings() {
+        NodeVector nodeA(1, Vector3(1.0f, 2.0f, 3.0f));
+        NodeVector nodeB(2, Vector3(-4.0f, 5.5f, 0.25f));
+        return {
+            BearingVector(nodeA, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 2.0f)),
+            BearingVector(nodeA, Vector3(0.0f, 2.0f, 0.0f), Vector3(3.0f, -1.0f, 0.5f)),
+            BearingVector(nodeB, Vector3(0.5f, 0.5f, 0.5f), Vector3(-2.0f, 0.0f, 1.0f)),
+        };
+    }
+
+    void ExpectSameBearing(const BearingVector& a, const BearingVector& b) {
+        EXPECT_EQ(a.Node.Index, b.Node.Index);
+        EXPECT_EQ(a.Node.Vector, b.Node.Vector);
+        EXPECT_EQ(a.Force, b.Force);
+        EXPECT_EQ(a.Vector, b.Vector);
+    }
+}
+
+// 테스트 케이스 1: NodeVector 왕복 및 리틀엔디언 헤더
+TEST(BinaryCodecTest, NodeVectorRoundTrip) {
+    std::vector<NodeVector> nodes = {NodeVector(7, Vector3(1.0f, -2.0f, 3.5f)), NodeVector(-1, Vector3(0.0f, 0.0f, 1e-3f))};
+    std::vector<uint8_t> buffer;
+    BinaryCodec::Encode(nodes, buffer);
+    ASSERT_EQ(buffer.size(), BinaryCodec::kHeaderBytes + 2 * BinaryCodec::kNodeRecordBytes);
+
+    // 매직 'NBVB', 버전 1
+    EXPECT_EQ(std::memcmp(buffer.data(), "NBVB", 4), 0);
+    EXPECT_EQ(buffer[4], 1);
+    EXPECT_EQ(buffer[5], 0);
+
+    BinaryView view(buffer.data(), buffer.size());
+    EXPECT_EQ(view.Type(), BinaryRecordType::NodeVector);
+    EXPECT_EQ(view.ByteSize(), buffer.size());
+
+    std::vector<NodeVector> decoded;
+    BinaryCodec::Decode(view, decoded);
+    ASSERT_EQ(decoded.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(decoded[i].Index, nodes[i].Index);
+        EXPECT_EQ(decoded[i].Vector, nodes[i].Vector);
+    }
+}
+
+// 테스트 케이스 2: BearingVector는 노드를 한 번만 저장
+TEST(BinaryCodecTest, BearingVectorSharesNodeTable) {
+    std::vector<BearingVector> bearings = MakeBearings();
+    std::vector<uint8_t> buffer;
+    BinaryCodec::Encode(bearings, buffer);
+
+    BinaryView view(buffer.data(), buffer.size());
+    EXPECT_EQ(view.Count(), 3);
+    EXPECT_EQ(view.NodeCount(), 2);
+    EXPECT_EQ(view.BearingNodeSlot(0), view.BearingNodeSlot(1));
+
+    // 디코딩 없이 버퍼에서 직접 읽기
+    EXPECT_EQ(view.BearingDirection(2), Vector3(-2.0f, 0.0f, 1.0f));
+    EXPECT_EQ(view.NodeIndex(view.BearingNodeSlot(2)), 2);
+
+    std::vector<BearingVector> decoded;
+    BinaryCodec::Decode(view, decoded);
+    ASSERT_EQ(decoded.size(), bearings.size());
+    for (size_t i = 0; i < bearings.size(); ++i) {
+        ExpectSameBearing(decoded[i], bearings[i]);
+    }
+}
+
+// 테스트 케이스 3: Vertex 블록 왕복 및 여러 블록 연결
+TEST(BinaryCodecTest, VertexRoundTripAndConcatenatedBlocks) {
+    std::vector<BearingVector> bearings = MakeBearings();
+    Vertex first, second;
+    first.UpdateNodeVector(NodeVector(1, Vector3(1.0f, 2.0f, 3.0f)));
+    first.PostBearingVector(bearings[0]);
+    first.PostBearingVector(bearings[1]);
+    second.UpdateNodeVector(NodeVector(2, Vector3(-4.0f, 5.5f, 0.25f)));
+    second.PostBearingVector(bearings[2]);
+
+    std::vector<uint8_t> buffer;
+    BinaryCodec::Encode(std::vector<const Vertex*>{&first, &second}, buffer);
+    BinaryCodec::Encode(std::vector<NodeVector>{NodeVector(9, Vector3(9.0f, 9.0f, 9.0f))}, buffer);
+
+    BinaryView vertices(buffer.data(), buffer.size());
+    EXPECT_EQ(vertices.Type(), BinaryRecordType::Vertex);
+    EXPECT_EQ(vertices.Count(), 2);
+    EXPECT_EQ(vertices.NodeCount(), 2);
+    EXPECT_EQ(vertices.BearingCount(), 3);
+
+    Vertex decoded;
+    decoded.PostBearingVector(bearings[2]); // 기존 베어링은 교체됨
+    BinaryCodec::Decode(vertices, 0, decoded);
+    EXPECT_EQ(decoded.ReadNodeVector().Index, 1);
+    ASSERT_EQ(decoded.ReadBearingVectorList().size(), 2);
+    ExpectSameBearing(decoded.ReadBearingVectorList()[1], bearings[1]);
+
+    BinaryView nodes(buffer.data() + vertices.ByteSize(), buffer.size() - vertices.ByteSize());
+    EXPECT_EQ(nodes.Type(), BinaryRecordType::NodeVector);
+    EXPECT_EQ(nodes.NodeIndex(0), 9);
+}
+
+// 테스트 케이스 4: 손상된 버퍼 거부
+TEST(BinaryCodecTest, RejectsMalformedBuffers) {
+    std::vector<uint8_t> buffer;
+    BinaryCodec::Encode(MakeBearings(), buffer);
+
+    // 잘린 버퍼
+    EXPECT_THROW(BinaryView(buffer.data(), buffer.size() - 1), std::runtime_error);
+    EXPECT_THROW(BinaryView(buffer.data(), 8), std::runtime_error);
+
+    // 잘못된 매직 / 미래 버전
+    std::vector<uint8_t> badMagic = buffer;
+    badMagic[0] ^= 0xFF;
+    EXPECT_THROW(BinaryView(badMagic.data(), badMagic.size()), std::runtime_error);
+    std::vector<uint8_t> futureVersion = buffer;
+    futureVersion[4] = BinaryCodec::kVersion + 1;
+    EXPECT_THROW(BinaryView(futureVersion.data(), futureVersion.size()), std::runtime_error);
+
+    // 존재하지 않는 노드 슬롯 참조
+    std::vector<uint8_t> badSlot = buffer;
+    badSlot[BinaryCodec::kHeaderBytes + 2 * BinaryCodec::kNodeRecordBytes] = 0x7F;
+    EXPECT_THROW(BinaryView(badSlot.data(), badSlot.size()), std::runtime_error);
+
+    // 다른 타입으로 디코딩
+    BinaryView view(buffer.data(), buffer.size());
+    std::vector<NodeVector> nodes;
+    EXPECT_THROW(BinaryCodec::Decode(view, nodes), std::runtime_error);
+}
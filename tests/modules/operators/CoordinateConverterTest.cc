@@ -1,8 +1,12 @@
 // CoordinateConverterTest.cc
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
+#include <random>
+#include <vector>
 #include "CoordinateConverter.h"
+#include "CpuFeatures.h"
 
 /**
  * @brief Float 비교를 위한 허용 오차.
@@ -77,4 +81,140 @@ TEST(CoordinateConverterTest, RoundTripSphericalToCartesianToSpherical) {
     EXPECT_NEAR(sphericalVector.r, sphericalResult.r, kTolerance);
     EXPECT_NEAR(sphericalVector.theta, sphericalResult.theta, kTolerance);
     EXPECT_NEAR(sphericalVector.phi, sphericalResult.phi, kTolerance);
-}
\ No newline at end of file
+}
+
+// ----------------------------
+// Batch conversion
+// ----------------------------
+
+namespace {
+    /**
+     * @brief 오차 측정용 무작위 입력.
+     */
+    void MakeSamples(size_t count, std::vector<SphericalVector>& spherical, std::vector<CartesianVector>& cartesian) {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> angle(-6.3f, 6.3f);
+        std::uniform_real_distribution<float> polar(0.0f, 3.1415926f);
+        std::uniform_real_distribution<float> radius(0.01f, 100.0f);
+        std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+        spherical.resize(count);
+        cartesian.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            spherical[i] = SphericalVector(radius(rng), angle(rng), polar(rng));
+            cartesian[i] = CartesianVector(coord(rng), coord(rng), coord(rng));
+        }
+    }
+
+    struct ErrorBounds {
+        double position; // |Δxyz| / r
+        double theta;    // rad
+        double phi;      // rad
+    };
+
+    /**
+     * @brief Exact(스칼라 libm) 경로 대비 최대 오차.
+     */
+    ErrorBounds MeasureError(ConversionAccuracy accuracy) {
+        std::vector<SphericalVector> spherical;
+        std::vector<CartesianVector> cartesian;
+        // 8의 배수가 아닌 크기로 SIMD 본체와 스칼라 꼬리를 모두 검사
+        MakeSamples(20003, spherical, cartesian);
+
+        std::vector<CartesianVector> exactCartesian, cartesianResult;
+        std::vector<SphericalVector> exactSpherical, sphericalResult;
+        CoordinateConverter::sphericalToCartesian(spherical, exactCartesian, ConversionAccuracy::Exact);
+        CoordinateConverter::cartesianToSpherical(cartesian, exactSpherical, ConversionAccuracy::Exact);
+        CoordinateConverter::sphericalToCartesian(spherical, cartesianResult, accuracy);
+        CoordinateConverter::cartesianToSpherical(cartesian, sphericalResult, accuracy);
+
+        ErrorBounds error{0.0, 0.0, 0.0};
+        for (size_t i = 0; i < spherical.size(); ++i) {
+            double d = std::max({std::fabs(cartesianResult[i].x - exactCartesian[i].x),
+                                 std::fabs(cartesianResult[i].y - exactCartesian[i].y),
+                                 std::fabs(cartesianResult[i].z - exactCartesian[i].z)});
+            error.position = std::max(error.position, d / spherical[i].r);
+
+            // theta = ±pi 경계에서의 부호 차이는 같은 각도
+            double dTheta = std::fabs(sphericalResult[i].theta - exactSpherical[i].theta);
+            dTheta = std::min(dTheta, std::fabs(dTheta - 2.0 * M_PI));
+            error.theta = std::max(error.theta, dTheta);
+            error.phi = std::max(error.phi, static_cast<double>(std::fabs(sphericalResult[i].phi - exactSpherical[i].phi)));
+        }
+        return error;
+    }
+}
+
+/**
+ * @brief Exact 배치 변환은 스칼라 함수와 동일.
+ */
+TEST(CoordinateConverterTest, BatchExactMatchesScalar) {
+    std::vector<SphericalVector> spherical;
+    std::vector<CartesianVector> cartesian;
+    MakeSamples(37, spherical, cartesian);
+
+    std::vector<CartesianVector> cartesianResult;
+    std::vector<SphericalVector> sphericalResult;
+    CoordinateConverter::sphericalToCartesian(spherical, cartesianResult, ConversionAccuracy::Exact);
+    CoordinateConverter::cartesianToSpherical(cartesian, sphericalResult, ConversionAccuracy::Exact);
+
+    ASSERT_EQ(cartesianResult.size(), spherical.size());
+    ASSERT_EQ(sphericalResult.size(), cartesian.size());
+    for (size_t i = 0; i < spherical.size(); ++i) {
+        CartesianVector c = CoordinateConverter::sphericalToCartesian(spherical[i]);
+        SphericalVector s = CoordinateConverter::cartesianToSpherical(cartesian[i]);
+        EXPECT_EQ(cartesianResult[i].x, c.x);
+        EXPECT_EQ(cartesianResult[i].y, c.y);
+        EXPECT_EQ(cartesianResult[i].z, c.z);
+        EXPECT_EQ(sphericalResult[i].r, s.r);
+        EXPECT_EQ(sphericalResult[i].theta, s.theta);
+        EXPECT_EQ(sphericalResult[i].phi, s.phi);
+    }
+}
+
+/**
+ * @brief Fast / Approx 오차 한계 (감지된 SIMD 경로와 스칼라 경로 모두).
+ *
+ * phi = acos(z / r)는 극 근처에서 조건수가 커서 r의 1 ulp 차이가 ~1e-5 rad가 되므로
+ * Fast의 phi 한계는 position / theta보다 느슨하다.
+ */
+TEST(CoordinateConverterTest, BatchErrorBounds) {
+    for (SimdLevel level : {CpuFeatures::Detect(), SimdLevel::Scalar}) {
+        CpuFeatures::Override(level);
+        SCOPED_TRACE(CpuFeatures::Name(level));
+
+        ErrorBounds fast = MeasureError(ConversionAccuracy::Fast);
+        EXPECT_LT(fast.position, 1e-6);
+        EXPECT_LT(fast.theta, 1e-6);
+        EXPECT_LT(fast.phi, 5e-5);
+
+        ErrorBounds approx = MeasureError(ConversionAccuracy::Approx);
+        EXPECT_LT(approx.position, 2e-4);
+        EXPECT_LT(approx.theta, 2e-4);
+        EXPECT_LT(approx.phi, 2e-4);
+    }
+    CpuFeatures::ClearOverride();
+}
+
+/**
+ * @brief 원점과 축 위의 특이점 처리.
+ */
+TEST(CoordinateConverterTest, BatchDegenerateInputs) {
+    std::vector<CartesianVector> cartesian(9, CartesianVector(0.0f, 0.0f, 0.0f));
+    cartesian[1] = CartesianVector(0.0f, 0.0f, 2.0f);
+    cartesian[2] = CartesianVector(0.0f, 0.0f, -2.0f);
+    cartesian[3] = CartesianVector(-1.0f, 0.0f, 0.0f);
+
+    for (ConversionAccuracy accuracy : {ConversionAccuracy::Fast, ConversionAccuracy::Approx}) {
+        std::vector<SphericalVector> result;
+        CoordinateConverter::cartesianToSpherical(cartesian, result, accuracy);
+        for (size_t i : {size_t(0), size_t(8)}) {
+            EXPECT_EQ(result[i].r, 0.0f);
+            EXPECT_EQ(result[i].theta, 0.0f);
+            EXPECT_EQ(result[i].phi, 0.0f);
+        }
+        EXPECT_NEAR(result[1].phi, 0.0f, 2e-4);
+        EXPECT_NEAR(result[2].phi, M_PI, 2e-4);
+        EXPECT_NEAR(std::fabs(result[3].theta), M_PI, 2e-4);
+        EXPECT_NEAR(result[3].phi, M_PI / 2, 2e-4);
+    }
+}
@@ -0,0 +1,106 @@
+// VertexPoolTest.cc
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "VertexPool.h"
+#include "BinaryCodec.h"
+
+namespace {
+    BearingVector MakeBearing(const NodeVector& node, float value) {
+        return BearingVector(node, Vector3(value, 0.0f, 0.0f), Vector3(0.0f, value, 1.0f));
+    }
+}
+
+// 테스트 케이스 1: Post / Put / Delete는 Vertex와 같은 동작
+TEST(VertexPoolTest, MatchesVertexSemantics) {
+    VertexPool pool;
+    Vertex reference;
+    NodeVector node(1, Vector3(1.0f, 2.0f, 3.0f));
+    VertexId id = pool.Create(node);
+    reference.UpdateNodeVector(node);
+
+    for (int i = 0; i < 6; ++i) {
+        pool.PostBearingVector(id, MakeBearing(node, float(i)));
+        reference.PostBearingVector(MakeBearing(node, float(i)));
+    }
+    pool.PutBearingVector(id, MakeBearing(node, 42.0f));
+    reference.PutBearingVector(MakeBearing(node, 42.0f));
+    pool.DeleteBearingVector(id);
+    reference.DeleteBearingVector();
+
+    ASSERT_EQ(pool.BearingCount(id), reference.BearingCount());
+    for (size_t i = 0; i < reference.BearingCount(); ++i) {
+        EXPECT_EQ(pool.ReadBearingForce(id, i), reference.ReadBearingForce(i));
+        EXPECT_EQ(pool.ReadBearingDirection(id, i), reference.ReadBearingDirection(i));
+        EXPECT_EQ(pool.ReadBearingNode(id, i).Index, 1);
+    }
+
+    // 빈 정점에서의 Put / Delete는 무시
+    VertexId empty = pool.Create(NodeVector(2, Vector3()));
+    pool.PutBearingVector(empty, MakeBearing(node, 1.0f));
+    pool.DeleteBearingVector(empty);
+    EXPECT_EQ(pool.BearingCount(empty), 0);
+}
+
+// 테스트 케이스 2: 교차 삽입 후 Compact는 연속 배치로 정리
+TEST(VertexPoolTest, InterleavedGrowthAndCompact) {
+    VertexPool pool;
+    NodeVector nodeA(1, Vector3(0.0f, 0.0f, 0.0f));
+    NodeVector nodeB(2, Vector3(1.0f, 0.0f, 0.0f));
+    VertexId a = pool.Create(nodeA);
+    VertexId b = pool.Create(nodeB);
+
+    for (int i = 0; i < 20; ++i) {
+        pool.PostBearingVector(a, MakeBearing(nodeA, float(i)));
+        pool.PostBearingVector(b, MakeBearing(nodeB, float(100 + i)));
+    }
+    pool.DeleteBearingVector(b);
+    EXPECT_EQ(pool.LiveBearings(), 39);
+    EXPECT_GT(pool.ArenaSize(), pool.LiveBearings());
+
+    pool.Compact();
+    EXPECT_EQ(pool.ArenaSize(), 39);
+    BearingSpan spanA = pool.ReadBearings(a);
+    BearingSpan spanB = pool.ReadBearings(b);
+    EXPECT_EQ(spanA.Data + spanA.Size, spanB.Data);
+    for (size_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(spanA[i].Force.x, float(i));
+    }
+    EXPECT_EQ(spanB[18].Force.x, 118.0f);
+
+    // Compact 후에도 추가 가능
+    pool.PostBearingVector(a, MakeBearing(nodeA, 7.0f));
+    EXPECT_EQ(pool.BearingCount(a), 21);
+    EXPECT_EQ(pool.ReadBearingForce(a, 20).x, 7.0f);
+    EXPECT_EQ(pool.ReadBearingForce(b, 18).x, 118.0f);
+}
+
+// 테스트 케이스 3: Vertex / 바이너리 블록과의 변환
+TEST(VertexPoolTest, ImportExportAndLoad) {
+    Vertex first, second;
+    NodeVector nodeA(1, Vector3(1.0f, 1.0f, 1.0f));
+    NodeVector nodeB(2, Vector3(2.0f, 2.0f, 2.0f));
+    first.UpdateNodeVector(nodeA);
+    first.PostBearingVector(MakeBearing(nodeA, 1.0f));
+    first.PostBearingVector(MakeBearing(nodeA, 2.0f));
+    second.UpdateNodeVector(nodeB);
+    second.PostBearingVector(MakeBearing(nodeB, 3.0f));
+
+    VertexPool pool;
+    VertexId id = pool.Import(first);
+    Vertex exported;
+    pool.Export(id, exported);
+    EXPECT_EQ(exported.toJson(), first.toJson());
+
+    std::vector<uint8_t> buffer;
+    BinaryCodec::Encode(std::vector<const Vertex*>{&first, &second}, buffer);
+    VertexId loaded = pool.Load(BinaryView(buffer.data(), buffer.size()));
+    EXPECT_EQ(loaded, 1);
+    EXPECT_EQ(pool.Size(), 3);
+    EXPECT_EQ(pool.ReadNodeVector(loaded + 1).Index, 2);
+    EXPECT_EQ(pool.BearingCount(loaded), 2);
+    EXPECT_EQ(pool.ReadBearingVector(loaded + 1, 0).Force, Vector3(3.0f, 0.0f, 0.0f));
+
+    // 같은 Index의 노드는 풀 전체에서 공유
+    EXPECT_EQ(pool.Nodes().Size(), 2);
+}
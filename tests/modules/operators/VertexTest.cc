@@ -4,7 +4,11 @@
 #include "Vertex.h"
 #include "NodeVector.h"     // NodeVector를 사용하기 위해 포함
 #include "BearingVector.h"  // BearingVector를 사용하기 위해 포함
+#include "BinaryCodec.h"
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 // 테스트 케이스 1: 생성자 검증
 TEST(VertexTest, ConstructorInitializesCorrectly) {
@@ -86,6 +90,185 @@ TEST(VertexTest, BearingVectorListLifecycle) {
     EXPECT_EQ(vertex.ReadBearingVectorList().size(), 0);
 }
 
+// 테스트 케이스 6: 회전 캐시는 첫 조회 시 생성되고 베어링 편집을 따라감
+TEST(VertexTest, BearingRotationCacheFollowsEdits) {
+    Vertex vertex;
+    NodeVector node0(0, Vector3(0.0f, 0.0f, 0.0f));
+    vertex.PostBearingVector(BearingVector(node0, Vector3(1.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)));
+
+    // 조회 전에는 캐시를 만들지 않음
+    EXPECT_FALSE(vertex._bearingRotationsValid);
+    EXPECT_EQ(vertex.ReadBearingRotations().Size(), 1);
+    EXPECT_TRUE(vertex._bearingRotationsValid);
+
+    // 추가 / 수정 / 삭제 후에도 R_i e_z = B_i
+    vertex.PostBearingVector(BearingVector(node0, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 2.0f, 0.0f)));
+    vertex.PutBearingVector(BearingVector(node0, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -3.0f)));
+    const BearingRotationSet& rotations = vertex.ReadBearingRotations();
+    ASSERT_EQ(rotations.Size(), 2);
+    EXPECT_EQ(rotations.Get(0).Apply(Vector3(0.0f, 0.0f, 1.0f)), Vector3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(rotations.Get(1).Apply(Vector3(0.0f, 0.0f, 1.0f)), Vector3(0.0f, 0.0f, -1.0f));
+
+    vertex.DeleteBearingVector();
+    EXPECT_EQ(vertex.ReadBearingRotations().Size(), 1);
+}
+
+// 테스트 케이스 7: 정규화 저장은 노드를 공유하고 같은 JSON / 바이너리를 생성
+TEST(VertexTest, NormalizedStorageSharesNodes) {
+    auto table = std::make_shared<NodeTable>();
+    NodeVector node(1, Vector3(1.0f, 2.0f, 3.0f));
+    BearingVector bearing1(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    BearingVector bearing2(node, Vector3(0.0f, 3.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f));
+
+    Vertex embedded;
+    Vertex normalized(table);
+    EXPECT_EQ(normalized.GetBearingStorage(), BearingStorage::Normalized);
+    for (Vertex* vertex : {&embedded, &normalized}) {
+        vertex->UpdateNodeVector(node);
+        vertex->PostBearingVector(bearing1);
+        vertex->PostBearingVector(bearing2);
+    }
+
+    // 노드는 테이블에 한 번만 저장
+    EXPECT_EQ(table->Size(), 1);
+    EXPECT_EQ(normalized._bearingRefList->at(0).Node, normalized._nodeHandle);
+    EXPECT_EQ(normalized.ReadBearingForce(1), Vector3(0.0f, 3.0f, 0.0f));
+
+    // 같은 JSON / 바이너리
+    EXPECT_EQ(normalized.toJson(), embedded.toJson());
+    std::vector<uint8_t> a, b;
+    BinaryCodec::Encode(std::vector<const Vertex*>{&embedded}, a);
+    BinaryCodec::Encode(std::vector<const Vertex*>{&normalized}, b);
+    EXPECT_EQ(a, b);
+
+    Vertex restored = Vertex::fromJson(normalized.toJson(), std::make_shared<NodeTable>());
+    EXPECT_EQ(restored.toJson(), embedded.toJson());
+
+    // 노드 수정이 모든 베어링에 반영 (임베디드 복사본은 그대로)
+    normalized.UpdateNodeVector(NodeVector(1, Vector3(5.0f, 5.0f, 5.0f)));
+    EXPECT_EQ(normalized.ReadBearingNode(0).Vector, Vector3(5.0f, 5.0f, 5.0f));
+    EXPECT_EQ(normalized.ReadBearingVectorList()[1].Node.Vector, Vector3(5.0f, 5.0f, 5.0f));
+
+    // 메모리: 임베디드 16 + 40k, 정규화 4 + 16 + 28k 바이트
+    VertexMemoryReport report = normalized.ReportMemory();
+    EXPECT_EQ(report.BearingCount, 2);
+    EXPECT_EQ(report.EmbeddedBytes, sizeof(NodeVector) + 2 * sizeof(BearingVector));
+    EXPECT_LT(report.NormalizedBytes, report.EmbeddedBytes);
+    EXPECT_GT(report.BytesSaved(), 0);
+}
+
+// 테스트 케이스 8: 편집마다 버전 증가, 조회와 실패한 편집은 버전 유지
+TEST(VertexTest, VersionBumpsOnEdits) {
+    Vertex vertex;
+    uint64_t version = vertex.GetVersion();
+
+    NodeVector node(1, Vector3(1.0f, 0.0f, 0.0f));
+    vertex.UpdateNodeVector(node);
+    EXPECT_GT(vertex.GetVersion(), version);
+    version = vertex.GetVersion();
+
+    vertex.PostBearingVector(BearingVector(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)));
+    EXPECT_GT(vertex.GetVersion(), version);
+    version = vertex.GetVersion();
+
+    // 조회는 버전을 바꾸지 않음
+    vertex.ReadBearingVectorList();
+    vertex.ReadBearingRotations();
+    EXPECT_EQ(vertex.GetVersion(), version);
+
+    vertex.PutBearingVector(BearingVector(node, Vector3(2.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)));
+    EXPECT_GT(vertex.GetVersion(), version);
+    version = vertex.GetVersion();
+
+    vertex.DeleteBearingVector();
+    EXPECT_GT(vertex.GetVersion(), version);
+    version = vertex.GetVersion();
+
+    // 빈 목록에 대한 삭제는 아무것도 바꾸지 않음
+    vertex.DeleteBearingVector();
+    EXPECT_EQ(vertex.GetVersion(), version);
+
+    // 정규화 저장소: 공유 노드를 다른 정점이 수정해도 버전이 바뀜
+    auto table = std::make_shared<NodeTable>();
+    Vertex a(table), b(table);
+    a.UpdateNodeVector(NodeVector(7, Vector3(0.0f, 0.0f, 0.0f)));
+    b.UpdateNodeVector(NodeVector(7, Vector3(0.0f, 0.0f, 0.0f)));
+    uint64_t aVersion = a.GetVersion();
+    b.UpdateNodeVector(NodeVector(7, Vector3(3.0f, 0.0f, 0.0f)));
+    EXPECT_GT(a.GetVersion(), aVersion);
+    EXPECT_EQ(a.ReadNodeVector().Vector, Vector3(3.0f, 0.0f, 0.0f));
+}
+
+// 테스트 케이스 9: 정규화 목록은 편집 전까지 다시 만들지 않고, 동시 조회에도 안전
+TEST(VertexTest, NormalizedListRebuildsOnlyAfterEdits) {
+    auto table = std::make_shared<NodeTable>();
+    Vertex vertex(table);
+    NodeVector node(1, Vector3(1.0f, 2.0f, 3.0f));
+    vertex.UpdateNodeVector(node);
+    for (int i = 0; i < 8; ++i) {
+        vertex.PostBearingVector(BearingVector(node, Vector3(static_cast<float>(i), 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)));
+    }
+
+    // 같은 버전에서는 앞서 받은 참조의 내용이 그대로 유지
+    const std::vector<BearingVector>& list = vertex.ReadBearingVectorList();
+    const BearingVector* first = list.data();
+    EXPECT_EQ(vertex.ReadBearingVectorList().data(), first);
+    EXPECT_EQ(list[3].Force, Vector3(3.0f, 0.0f, 0.0f));
+
+    // 공유 테이블의 노드 수정은 다음 조회에 반영
+    table->Update(vertex._nodeHandle, NodeVector(1, Vector3(4.0f, 4.0f, 4.0f)));
+    EXPECT_EQ(vertex.ReadBearingVectorList()[7].Node.Vector, Vector3(4.0f, 4.0f, 4.0f));
+
+    vertex.UpdateNodeVector(NodeVector(1, Vector3(5.0f, 5.0f, 5.0f)));
+    const Vertex& shared = vertex;
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            for (int k = 0; k < 200; ++k) {
+                const std::vector<BearingVector>& read = shared.ReadBearingVectorList();
+                if (read.size() != 8 || read[5].Node.Vector != Vector3(5.0f, 5.0f, 5.0f)) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+// 테스트 케이스 10: 정규화 저장소에서 관련 없는 노드 편집과 같은 값 쓰기는 버전을 유지
+TEST(VertexTest, VersionIgnoresUnrelatedNodes) {
+    auto table = std::make_shared<NodeTable>();
+    Vertex a(table), b(table), c(table);
+    NodeVector shared(3, Vector3(0.0f, 0.0f, 1.0f));
+    a.UpdateNodeVector(NodeVector(1, Vector3(0.0f, 0.0f, 0.0f)));
+    b.UpdateNodeVector(NodeVector(2, Vector3(1.0f, 0.0f, 0.0f)));
+    c.UpdateNodeVector(shared);
+    a.PostBearingVector(BearingVector(shared, Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f)));
+    uint64_t aVersion = a.GetVersion();
+
+    // 다른 정점의 노드 편집은 영향 없음
+    b.UpdateNodeVector(NodeVector(2, Vector3(2.0f, 0.0f, 0.0f)));
+    EXPECT_EQ(a.GetVersion(), aVersion);
+
+    // 같은 값으로 쓰기는 아무것도 바꾸지 않음
+    a.UpdateNodeVector(NodeVector(1, Vector3(0.0f, 0.0f, 0.0f)));
+    EXPECT_EQ(a.GetVersion(), aVersion);
+    Vertex embedded;
+    embedded.UpdateNodeVector(NodeVector(4, Vector3(1.0f, 1.0f, 1.0f)));
+    uint64_t embeddedVersion = embedded.GetVersion();
+    embedded.UpdateNodeVector(NodeVector(4, Vector3(1.0f, 1.0f, 1.0f)));
+    EXPECT_EQ(embedded.GetVersion(), embeddedVersion);
+
+    // 베어링이 가리키는 노드의 편집은 해석된 목록을 바꾸므로 버전 증가
+    c.UpdateNodeVector(NodeVector(3, Vector3(0.0f, 0.0f, 2.0f)));
+    EXPECT_GT(a.GetVersion(), aVersion);
+    EXPECT_EQ(a.ReadBearingVectorList()[0].Node.Vector, Vector3(0.0f, 0.0f, 2.0f));
+}
+
 // 메인 함수: 모든 테스트 실행
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,118 @@
+// AdaptiveTessellatorTest.cc
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "AdaptiveTessellator.h"
+#include "BezierEvaluator.h"
+#include "Vector3.h"
+
+namespace {
+
+// 직선 구간과 급격한 굽힘이 섞인 곡선
+std::vector<Vector3> MakeHookCurve() {
+    return {
+        Vector3(0.0f, 0.0f, 0.0f), Vector3(10.0f, 0.0f, 0.0f), Vector3(20.0f, 0.0f, 0.0f),
+        Vector3(30.0f, 0.0f, 0.0f), Vector3(40.0f, 0.0f, 0.0f), Vector3(40.0f, 0.0f, 0.0f),
+        Vector3(40.0f, 1.0f, 0.0f), Vector3(39.0f, 1.0f, 0.5f),
+    };
+}
+
+// 조밀한 기준 샘플에 대해 폴리라인이 보이는 최대 편차
+float MaxDeviation(const std::vector<Vector3>& controlPoints, const std::vector<Vector3>& points, const std::vector<float>& params) {
+    const BezierEvaluator& evaluator = BezierEvaluator::Get(BezierMethod::DeCasteljau);
+    float worst = 0.0f;
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        for (int k = 1; k < 16; ++k) {
+            float t = params[i] + (params[i + 1] - params[i]) * k / 16.0f;
+            Vector3 p = evaluator.Evaluate(controlPoints, t);
+            worst = std::max(worst, AdaptiveTessellator::DistanceToChord(p, points[i], points[i + 1]));
+        }
+    }
+    return worst;
+}
+
+// 같은 허용 오차를 만족하는 가장 작은 균등 분할 수
+int UniformSegmentsFor(const std::vector<Vector3>& controlPoints, float tolerance) {
+    const BezierEvaluator& evaluator = BezierEvaluator::Get(BezierMethod::DeCasteljau);
+    for (int segments = 1; segments < 4096; ++segments) {
+        std::vector<Vector3> points;
+        evaluator.EvaluateUniform(controlPoints, segments, points);
+        std::vector<float> params(points.size());
+        for (std::size_t i = 0; i < params.size(); ++i) params[i] = static_cast<float>(i) / segments;
+        if (MaxDeviation(controlPoints, points, params) <= tolerance) return segments;
+    }
+    return 4096;
+}
+
+} // namespace
+
+// 테스트 케이스 1: 직선은 초기 분할만 사용
+TEST(AdaptiveTessellatorTest, StraightLineStaysCoarse) {
+    std::vector<Vector3> controlPoints = {Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f), Vector3(2.0f, 2.0f, 0.0f), Vector3(5.0f, 5.0f, 0.0f)};
+    AdaptiveTessellationOptions options;
+    options.tolerance = 1e-4f;
+    std::vector<Vector3> points;
+    std::vector<float> params;
+    AdaptiveTessellator::Tessellate(controlPoints, options, BezierEvaluator::Get(BezierMethod::Horner), points, params);
+
+    EXPECT_EQ(points.size(), static_cast<std::size_t>(options.minSegments + 1));
+    EXPECT_EQ(points.front(), controlPoints.front());
+    EXPECT_EQ(points.back(), controlPoints.back());
+}
+
+// 테스트 케이스 2: 허용 오차 만족, 균등 분할보다 적은 점, t 값 단조 증가
+TEST(AdaptiveTessellatorTest, MeetsToleranceWithFewerPoints) {
+    std::vector<Vector3> controlPoints = MakeHookCurve();
+    const BezierEvaluator& evaluator = BezierEvaluator::Get(BezierMethod::Horner);
+    const float tolerance = 1e-3f;
+
+    for (AdaptiveCriterion criterion : {AdaptiveCriterion::ChordDeviation, AdaptiveCriterion::Curvature}) {
+        AdaptiveTessellationOptions options;
+        options.criterion = criterion;
+        options.tolerance = tolerance;
+        options.maxPoints = 4096;
+        std::vector<Vector3> points;
+        std::vector<float> params;
+        AdaptiveTessellator::Tessellate(controlPoints, options, evaluator, points, params);
+
+        ASSERT_EQ(points.size(), params.size());
+        EXPECT_EQ(params.front(), 0.0f);
+        EXPECT_EQ(params.back(), 1.0f);
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if (i > 0) {
+                EXPECT_GT(params[i], params[i - 1]);
+            }
+            Vector3 expected = evaluator.Evaluate(controlPoints, params[i]);
+            EXPECT_NEAR(points[i].x, expected.x, 1e-5f);
+            EXPECT_NEAR(points[i].y, expected.y, 1e-5f);
+            EXPECT_NEAR(points[i].z, expected.z, 1e-5f);
+        }
+
+        // 곡률 기준은 추정치이므로 약간의 여유를 둠
+        float slack = criterion == AdaptiveCriterion::Curvature ? 2.0f : 1.0f;
+        float deviation = MaxDeviation(controlPoints, points, params);
+        EXPECT_LE(deviation, tolerance * slack);
+
+        // 같은 실제 오차를 내는 균등 분할과 비교
+        int uniform = UniformSegmentsFor(controlPoints, deviation);
+        EXPECT_LT(points.size() * 3, static_cast<std::size_t>(uniform + 1) * 2) << "uniform segments: " << uniform;
+    }
+}
+
+// 테스트 케이스 3: 점 예산은 절대 초과하지 않음
+TEST(AdaptiveTessellatorTest, RespectsPointBudget) {
+    std::vector<Vector3> controlPoints = MakeHookCurve();
+    AdaptiveTessellationOptions options;
+    options.tolerance = 1e-7f;
+    for (int budget : {2, 3, 5, 17, 64}) {
+        options.maxPoints = budget;
+        std::vector<Vector3> points;
+        std::vector<float> params;
+        AdaptiveTessellator::Tessellate(controlPoints, options, BezierEvaluator::Get(BezierMethod::DeCasteljau), points, params);
+        EXPECT_EQ(points.size(), static_cast<std::size_t>(budget));
+        EXPECT_EQ(params.back(), 1.0f);
+    }
+}
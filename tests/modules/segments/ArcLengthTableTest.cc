@@ -0,0 +1,86 @@
+// ArcLengthTableTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "ArcLengthTable.h"
+#include "Vector3.h"
+
+namespace {
+
+// 기준 길이: 아주 촘촘한 폴리라인 길이 (double)
+double ReferenceLength(const ArcLengthTable& table, double t0, double t1) {
+    const int steps = 200000;
+    double length = 0.0;
+    Vector3d previous(table.PointAt(static_cast<float>(t0)));
+    for (int i = 1; i <= steps; ++i) {
+        Vector3d p(table.PointAt(static_cast<float>(t0 + (t1 - t0) * i / steps)));
+        length += (p - previous).magnitude();
+        previous = p;
+    }
+    return length;
+}
+
+// 힘이 한쪽으로 몰려 t 간격이 매우 불균일한 곡선
+std::vector<Vector3> MakeSkewedCurve() {
+    return {
+        Vector3(0.0f, 0.0f, 0.0f), Vector3(0.1f, 0.0f, 0.0f), Vector3(0.2f, 0.1f, 0.0f),
+        Vector3(6.0f, 5.0f, 1.0f), Vector3(10.0f, 0.0f, 0.0f),
+    };
+}
+
+} // namespace
+
+// 테스트 케이스 1: 직선 길이와 t(s) 는 해석해와 일치
+TEST(ArcLengthTableTest, StraightLineIsExact) {
+    // 제어점이 균등하면 속도가 일정: s = 10 t
+    ArcLengthTable table({Vector3(0.0f, 0.0f, 0.0f), Vector3(5.0f, 0.0f, 0.0f), Vector3(10.0f, 0.0f, 0.0f)});
+    EXPECT_NEAR(table.TotalLength(), 10.0f, 1e-5f);
+    EXPECT_NEAR(table.ParameterAt(2.5f), 0.25f, 1e-6f);
+    EXPECT_NEAR(table.LengthAt(0.7f), 7.0f, 1e-5f);
+    EXPECT_EQ(table.ParameterAt(-1.0f), 0.0f);
+    EXPECT_EQ(table.ParameterAt(11.0f), 1.0f);
+}
+
+// 테스트 케이스 2: 곡선 길이와 역함수 정확도
+TEST(ArcLengthTableTest, CurveLengthAndInverse) {
+    ArcLengthTable table(MakeSkewedCurve());
+    double reference = ReferenceLength(table, 0.0, 1.0);
+    EXPECT_NEAR(table.TotalLength(), reference, 1e-4 * reference);
+    EXPECT_NEAR(table.LengthAt(0.3f), ReferenceLength(table, 0.0, 0.3), 1e-4 * reference);
+
+    for (int k = 1; k < 20; ++k) {
+        float s = table.TotalLength() * k / 20.0f;
+        float t = table.ParameterAt(s);
+        EXPECT_NEAR(table.LengthAt(t), s, 1e-4f * table.TotalLength());
+    }
+}
+
+// 테스트 케이스 3: 재샘플링 결과는 같은 호 길이 간격
+TEST(ArcLengthTableTest, ResampleIsEquallySpaced) {
+    ArcLengthTable table(MakeSkewedCurve());
+    std::vector<Vector3> points;
+    std::vector<float> params;
+    table.Resample(33, points, &params);
+    ASSERT_EQ(points.size(), 33);
+    ASSERT_EQ(params.size(), 33);
+    EXPECT_EQ(params.front(), 0.0f);
+    EXPECT_EQ(params.back(), 1.0f);
+
+    float step = table.TotalLength() / 32.0f;
+    for (std::size_t k = 1; k < params.size(); ++k) {
+        EXPECT_NEAR(table.LengthAt(params[k]) - table.LengthAt(params[k - 1]), step, 1e-3f * step);
+    }
+
+    // 간격 지정: 마지막 구간만 짧아짐
+    table.ResampleBySpacing(1.0f, points, &params);
+    EXPECT_EQ(points.size(), static_cast<std::size_t>(std::ceil(table.TotalLength())) + 1);
+    EXPECT_EQ(params.back(), 1.0f);
+    EXPECT_NEAR(table.LengthAt(params[1]), 1.0f, 1e-3f);
+
+    // 너무 작은 간격은 거부
+    EXPECT_THROW(table.ResampleBySpacing(1e-30f, points, &params), std::invalid_argument);
+    EXPECT_THROW(table.ResampleBySpacing(table.TotalLength() / (ArcLengthTable::kMaxResampleSteps * 2.0f), points), std::invalid_argument);
+}
@@ -0,0 +1,103 @@
+// BernsteinBasisCacheTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "BernsteinBasisCache.h"
+#include "BezierEvaluator.h"
+#include "Vector3.h"
+
+// 테스트 케이스 1: 같은 (degree, numSegments) 는 같은 테이블을 공유
+TEST(BernsteinBasisCacheTest, SharedTablePerKey) {
+    auto a = BernsteinBasisCache::Get(6, 50);
+    auto b = BernsteinBasisCache::Get(6, 50);
+    auto c = BernsteinBasisCache::Get(6, 51);
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_NE(a.get(), c.get());
+    EXPECT_EQ(a->Rows(), 51);
+    EXPECT_EQ(a->Columns(), 7);
+}
+
+// 테스트 케이스 2: 각 행의 기저 합은 1, 미분 기저 합은 0 (partition of unity)
+TEST(BernsteinBasisCacheTest, PartitionOfUnity) {
+    auto basis = BernsteinBasisCache::Get(9, 20);
+    for (int k = 0; k < basis->Rows(); ++k) {
+        float sum = 0.0f, sum1 = 0.0f, sum2 = 0.0f;
+        for (int i = 0; i < basis->Columns(); ++i) {
+            sum += basis->weights[k * basis->Columns() + i];
+            sum1 += basis->first[k * basis->Columns() + i];
+            sum2 += basis->second[k * basis->Columns() + i];
+        }
+        EXPECT_NEAR(sum, 1.0f, 1e-5f);
+        EXPECT_NEAR(sum1, 0.0f, 1e-3f);
+        EXPECT_NEAR(sum2, 0.0f, 1e-2f);
+    }
+}
+
+// 테스트 케이스 3: 미분 기저가 해석적 미분과 일치 (cubic)
+TEST(BernsteinBasisCacheTest, DerivativesMatchCubic) {
+    std::vector<Vector3> controlPoints = {
+        Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 0.0f),
+        Vector3(3.0f, 2.0f, 1.0f), Vector3(4.0f, 0.0f, 2.0f)
+    };
+    auto basis = BernsteinBasisCache::Get(3, 8);
+    for (int k = 0; k <= 8; ++k) {
+        float t = k / 8.0f, u = 1.0f - t;
+        Vector3 d1 = (controlPoints[1] - controlPoints[0]) * (3 * u * u) +
+                     (controlPoints[2] - controlPoints[1]) * (6 * u * t) +
+                     (controlPoints[3] - controlPoints[2]) * (3 * t * t);
+        Vector3 d2 = (controlPoints[2] - controlPoints[1] * 2.0f + controlPoints[0]) * (6 * u) +
+                     (controlPoints[3] - controlPoints[2] * 2.0f + controlPoints[1]) * (6 * t);
+        Vector3 f1 = basis->FirstDerivative(controlPoints, k);
+        Vector3 f2 = basis->SecondDerivative(controlPoints, k);
+        EXPECT_NEAR(f1.x, d1.x, 1e-4f); EXPECT_NEAR(f1.y, d1.y, 1e-4f); EXPECT_NEAR(f1.z, d1.z, 1e-4f);
+        EXPECT_NEAR(f2.x, d2.x, 1e-4f); EXPECT_NEAR(f2.y, d2.y, 1e-4f); EXPECT_NEAR(f2.z, d2.z, 1e-4f);
+    }
+}
+
+// 테스트 케이스 4: 여러 스레드에서 동시에 조회해도 하나의 테이블만 생성
+TEST(BernsteinBasisCacheTest, ConcurrentGet) {
+    std::vector<std::thread> threads;
+    std::vector<const BernsteinBasis*> seen(8, nullptr);
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([i, &seen]() {
+            seen[i] = BernsteinBasisCache::Get(11, 333).get();
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (int i = 1; i < 8; ++i) EXPECT_EQ(seen[i], seen[0]);
+}
+
+// 테스트 케이스 5: 바이트 상한을 넘으면 가장 오래 쓰지 않은 테이블부터 제거
+TEST(BernsteinBasisCacheTest, EvictsLeastRecentlyUsedPastCap) {
+    BernsteinBasisCache::Clear();
+    size_t tableBytes = BernsteinBasis(3, 100).Bytes();
+    BernsteinBasisCache::SetMaxBytes(tableBytes * 4);
+
+    auto held = BernsteinBasisCache::Get(3, 100);
+    for (int n = 101; n < 140; ++n) {
+        BernsteinBasisCache::Get(3, n);
+        BernsteinBasisCache::Get(3, 100); // Keep it recently used
+        EXPECT_LE(BernsteinBasisCache::Bytes(), BernsteinBasisCache::MaxBytes());
+    }
+    EXPECT_LE(BernsteinBasisCache::Size(), 4u);
+    EXPECT_EQ(BernsteinBasisCache::Get(3, 100), held);
+
+    // A table evicted while held stays usable; the next Get builds a new one
+    auto evicted = BernsteinBasisCache::Get(3, 101);
+    for (int n = 200; n < 210; ++n) BernsteinBasisCache::Get(3, n);
+    EXPECT_NE(BernsteinBasisCache::Get(3, 101), evicted);
+    EXPECT_FLOAT_EQ(evicted->weights[0], 1.0f);
+
+    // Larger than the whole cap: returned but never cached
+    size_t before = BernsteinBasisCache::Size();
+    auto huge = BernsteinBasisCache::Get(3, 10000);
+    ASSERT_NE(huge, nullptr);
+    EXPECT_EQ(huge->Rows(), 10001);
+    EXPECT_EQ(BernsteinBasisCache::Size(), before);
+
+    BernsteinBasisCache::SetMaxBytes(BernsteinBasisCache::kDefaultMaxBytes);
+    BernsteinBasisCache::Clear();
+}
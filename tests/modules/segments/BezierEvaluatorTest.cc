@@ -0,0 +1,73 @@
+// BezierEvaluatorTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "BezierEvaluator.h"
+#include "Vector3.h"
+#include "CurveTestUtils.h"
+
+namespace {
+
+using curvetest::ExpectNear;
+using curvetest::MakeControlPoints;
+
+// 기준값: Equ. 8 을 double 로 직접 계산
+Vector3 ReferenceBezier(const std::vector<Vector3>& controlPoints, double t) {
+    return Vector3(curvetest::ReferenceDerivative(controlPoints, t, 0));
+}
+
+const BezierMethod kMethods[] = {
+    BezierMethod::DeCasteljau,
+    BezierMethod::Horner,
+    BezierMethod::ForwardDifference,
+    BezierMethod::BasisTable,
+    BezierMethod::FixedDegree
+};
+
+} // namespace
+
+// 테스트 케이스 1: 단일 t 평가가 기준값과 일치
+TEST(BezierEvaluatorTest, EvaluateMatchesReference) {
+    std::vector<Vector3> controlPoints = MakeControlPoints(13);
+    for (BezierMethod method : kMethods) {
+        const BezierEvaluator& evaluator = BezierEvaluator::Get(method);
+        for (int i = 0; i <= 20; ++i) {
+            float t = static_cast<float>(i) / 20.0f;
+            ExpectNear(evaluator.Evaluate(controlPoints, t), ReferenceBezier(controlPoints, t), 1e-3f);
+        }
+    }
+}
+
+// 테스트 케이스 2: 균일 샘플링이 기준값과 일치 (forward differencing 누적 오차 포함)
+TEST(BezierEvaluatorTest, EvaluateUniformMatchesReference) {
+    for (int count : {2, 4, 7, 13}) {
+        std::vector<Vector3> controlPoints = MakeControlPoints(count);
+        for (int numSegments : {1, 10, 100, 1000}) {
+            for (BezierMethod method : kMethods) {
+                std::vector<Vector3> out;
+                BezierEvaluator::Get(method).EvaluateUniform(controlPoints, numSegments, out);
+                ASSERT_EQ(out.size(), static_cast<size_t>(numSegments + 1));
+                for (int i = 0; i <= numSegments; ++i) {
+                    double t = static_cast<double>(i) / numSegments;
+                    ExpectNear(out[i], ReferenceBezier(controlPoints, t), 1e-3f);
+                }
+            }
+        }
+    }
+}
+
+// 테스트 케이스 3: 끝점 보간 및 퇴화 입력
+TEST(BezierEvaluatorTest, EndpointsAndDegenerateInput) {
+    std::vector<Vector3> controlPoints = MakeControlPoints(9);
+    for (BezierMethod method : kMethods) {
+        const BezierEvaluator& evaluator = BezierEvaluator::Get(method);
+        ExpectNear(evaluator.Evaluate(controlPoints, 0.0f), controlPoints.front(), 1e-5f);
+        ExpectNear(evaluator.Evaluate(controlPoints, 1.0f), controlPoints.back(), 1e-4f);
+
+        std::vector<Vector3> single = { Vector3(1.0f, 2.0f, 3.0f) };
+        ExpectNear(evaluator.Evaluate(single, 0.3f), single[0], 1e-6f);
+        EXPECT_EQ(evaluator.Evaluate({}, 0.5f), Vector3(0.0f, 0.0f, 0.0f));
+    }
+}
@@ -0,0 +1,119 @@
+// CubicBSplineTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "CubicBSpline.h"
+#include "CurveDerivatives.h"
+#include "Vector3.h"
+#include "CurveTestUtils.h"
+
+using curvetest::ExpectNear;
+using curvetest::MakePolygon;
+
+// 테스트 케이스 1: 제어점 4개 이하의 clamped B-spline 은 Bezier 와 동일
+TEST(CubicBSplineTest, ClampedWithFourPointsIsBezier) {
+    for (int count = 2; count <= 4; ++count) {
+        std::vector<Vector3> polygon = MakePolygon(count);
+        CubicBSpline spline(polygon);
+        CurveDerivatives bezier(polygon);
+        EXPECT_EQ(spline.Degree(), count - 1);
+        EXPECT_EQ(spline.SpanCount(), 1);
+        for (int i = 0; i <= 16; ++i) {
+            float t = i / 16.0f;
+            ExpectNear(spline.Point(t), bezier.Point(t), 1e-5f);
+            ExpectNear(spline.FirstDerivative(t), bezier.FirstDerivative(t), 1e-4f);
+            ExpectNear(spline.SecondDerivative(t), bezier.SecondDerivative(t), 1e-3f);
+        }
+    }
+}
+
+// 테스트 케이스 2: clamped 는 끝점 보간, 끝 접선은 제어 다각형 방향
+TEST(CubicBSplineTest, ClampedInterpolatesEnds) {
+    std::vector<Vector3> polygon = MakePolygon(12);
+    CubicBSpline spline(polygon, BSplineKnots::Clamped);
+    EXPECT_EQ(spline.Degree(), 3);
+    EXPECT_EQ(spline.SpanCount(), 9);
+    ExpectNear(spline.Point(0.0f), polygon.front(), 1e-5f);
+    ExpectNear(spline.Point(1.0f), polygon.back(), 1e-5f);
+
+    Vector3 start = spline.FirstDerivative(0.0f).normalized();
+    Vector3 end = spline.FirstDerivative(1.0f).normalized();
+    ExpectNear(start, (polygon[1] - polygon[0]).normalized(), 1e-5f);
+    ExpectNear(end, (polygon[11] - polygon[10]).normalized(), 1e-5f);
+
+    // uniform 매듭은 끝점을 지나지 않음
+    CubicBSpline uniform(polygon, BSplineKnots::Uniform);
+    EXPECT_GT(uniform.Point(0.0f).distance(polygon.front()), 1e-3f);
+}
+
+// 테스트 케이스 3: 도함수는 유한 차분과 일치 (두 매듭 배치 모두)
+TEST(CubicBSplineTest, DerivativesMatchFiniteDifferences) {
+    std::vector<Vector3> polygon = MakePolygon(9);
+    for (BSplineKnots knots : {BSplineKnots::Clamped, BSplineKnots::Uniform}) {
+        CubicBSpline spline(polygon, knots);
+        const float h = 1e-3f;
+        for (int i = 1; i < 20; ++i) {
+            float t = i / 20.0f + 0.013f; // 매듭 위를 피함
+            Vector3 d1 = (spline.Point(t + h) - spline.Point(t - h)) / (2.0f * h);
+            Vector3 d2 = (spline.FirstDerivative(t + h) - spline.FirstDerivative(t - h)) / (2.0f * h);
+            ExpectNear(spline.FirstDerivative(t), d1, 2e-2f * std::max(1.0f, d1.magnitude()));
+            ExpectNear(spline.SecondDerivative(t), d2, 2e-2f * std::max(1.0f, d2.magnitude()));
+        }
+    }
+}
+
+// 테스트 케이스 4: 제어점 하나를 옮기면 지지 구간 밖은 그대로 (국소 지지)
+TEST(CubicBSplineTest, EditsHaveLocalSupport) {
+    std::vector<Vector3> polygon = MakePolygon(30);
+    CubicBSpline before(polygon);
+    const int moved = 15;
+    polygon[moved] += Vector3(0.0f, 5.0f, 0.0f);
+    CubicBSpline after(polygon);
+
+    float t0, t1;
+    after.SupportOf(moved, t0, t1);
+    EXPECT_GT(t0, 0.0f);
+    EXPECT_LT(t1, 1.0f);
+    EXPECT_LT(t1 - t0, 0.25f);
+
+    // 범위 밖 인덱스는 양 끝 제어점으로 고정
+    float e0, e1, c0, c1;
+    after.SupportOf(-3, e0, e1);
+    after.SupportOf(0, c0, c1);
+    EXPECT_EQ(e0, c0);
+    EXPECT_EQ(e1, c1);
+    after.SupportOf(1000, e0, e1);
+    after.SupportOf(static_cast<int>(polygon.size()) - 1, c0, c1);
+    EXPECT_EQ(e0, c0);
+    EXPECT_EQ(e1, c1);
+    EXPECT_EQ(e1, 1.0f);
+
+    int changed = 0;
+    for (int i = 0; i <= 200; ++i) {
+        float t = i / 200.0f;
+        bool inside = t > t0 && t < t1;
+        if (inside) {
+            changed += after.Point(t).distance(before.Point(t)) > 1e-4f;
+        } else {
+            ExpectNear(after.Point(t), before.Point(t), 1e-5f);
+        }
+    }
+    EXPECT_GT(changed, 0);
+}
+
+// 테스트 케이스 5: 고차 다각형도 안정적 (Bezier 는 degree 60 에서 이항계수 정밀도 손실)
+TEST(CubicBSplineTest, HighVertexCountStaysOnPolygonHull) {
+    std::vector<Vector3> polygon = MakePolygon(61);
+    CubicBSpline spline(polygon);
+    std::vector<Vector3> samples;
+    spline.EvaluateUniform(600, samples);
+    ASSERT_EQ(samples.size(), 601);
+    for (const Vector3& p : samples) {
+        EXPECT_TRUE(std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z));
+        EXPECT_GE(p.x, -1e-4f);
+        EXPECT_LE(p.x, 60.0f + 1e-4f);
+        EXPECT_LE(std::abs(p.y), 3.0f + 1e-4f);
+    }
+}
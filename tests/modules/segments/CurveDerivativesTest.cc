@@ -0,0 +1,85 @@
+// CurveDerivativesTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "CurveDerivatives.h"
+#include "Vector3.h"
+#include "CurveTestUtils.h"
+
+namespace {
+
+using curvetest::ReferenceDerivative;
+
+std::vector<Vector3> MakeCurve() {
+    return {
+        Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 0.0f), Vector3(1.0f, 2.0f, 0.5f),
+        Vector3(3.0f, -1.0f, 1.0f), Vector3(6.0f, 1.0f, 0.0f), Vector3(9.0f, 0.0f, 0.0f),
+        Vector3(10.0f, 0.0f, 0.0f),
+    };
+}
+
+} // namespace
+
+// 테스트 케이스 1: 호도그래프 제어점과 단일 평가
+TEST(CurveDerivativesTest, HodographsMatchReference) {
+    std::vector<Vector3> controlPoints = MakeCurve();
+    CurveDerivatives derivatives(controlPoints);
+    EXPECT_EQ(derivatives.First().size(), controlPoints.size() - 1);
+    EXPECT_EQ(derivatives.Second().size(), controlPoints.size() - 2);
+
+    for (int i = 0; i <= 20; ++i) {
+        float t = i / 20.0f;
+        for (int order = 0; order <= 2; ++order) {
+            Vector3 expected(ReferenceDerivative(controlPoints, t, order));
+            Vector3 actual = order == 0 ? derivatives.Point(t) : order == 1 ? derivatives.FirstDerivative(t) : derivatives.SecondDerivative(t);
+            float tolerance = 1e-4f * std::max(1.0f, expected.magnitude());
+            EXPECT_NEAR(actual.x, expected.x, tolerance);
+            EXPECT_NEAR(actual.y, expected.y, tolerance);
+            EXPECT_NEAR(actual.z, expected.z, tolerance);
+        }
+    }
+}
+
+// 테스트 케이스 2: 배치 프로파일은 단일 평가와 같고 프레네 프레임은 정규직교
+TEST(CurveDerivativesTest, ProfileMatchesSingleEvaluation) {
+    CurveDerivatives derivatives(MakeCurve());
+    std::vector<float> ts;
+    for (int i = 0; i < 150; ++i) ts.push_back(i / 149.0f); // 블록 경계를 넘는 크기
+
+    std::vector<CurvatureSample> profile = derivatives.CurvatureProfile(ts);
+    ASSERT_EQ(profile.size(), ts.size());
+    for (std::size_t i = 0; i < ts.size(); ++i) {
+        CurvatureSample single = derivatives.Curvature(ts[i]);
+        EXPECT_FLOAT_EQ(profile[i].Curvature, single.Curvature);
+        EXPECT_EQ(profile[i].Tangent, single.Tangent);
+        EXPECT_EQ(profile[i].Normal, single.Normal);
+
+        Vector3d d1 = ReferenceDerivative(derivatives.ControlPoints(), ts[i], 1);
+        Vector3d d2 = ReferenceDerivative(derivatives.ControlPoints(), ts[i], 2);
+        double expected = d2.cross(d1).magnitude() / std::pow(d1.magnitude(), 3);
+        EXPECT_NEAR(profile[i].Curvature, expected, 1e-3 * std::max(1.0, expected));
+
+        EXPECT_NEAR(profile[i].Tangent.magnitude(), 1.0f, 1e-5f);
+        if (!profile[i].Normal.isZero()) {
+            EXPECT_NEAR(profile[i].Normal.magnitude(), 1.0f, 1e-5f);
+            EXPECT_NEAR(profile[i].Normal.dot(profile[i].Tangent), 0.0f, 1e-4f);
+        }
+    }
+}
+
+// 테스트 케이스 3: 직선과 퇴화 곡선
+TEST(CurveDerivativesTest, DegenerateCurves) {
+    CurveDerivatives line({Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f), Vector3(2.0f, 2.0f, 0.0f)});
+    CurvatureSample sample = line.Curvature(0.3f);
+    EXPECT_NEAR(sample.Curvature, 0.0f, 1e-6f);
+    EXPECT_TRUE(sample.Normal.isZero());
+    EXPECT_NEAR(sample.Tangent.x, std::sqrt(0.5f), 1e-6f);
+
+    CurveDerivatives point({Vector3(1.0f, 1.0f, 1.0f)});
+    EXPECT_EQ(point.Point(0.5f), Vector3(1.0f, 1.0f, 1.0f));
+    CurvatureSample still = point.Curvature(0.5f);
+    EXPECT_EQ(still.Curvature, 0.0f);
+    EXPECT_TRUE(still.Tangent.isZero());
+}
@@ -0,0 +1,145 @@
+// CurveQueryTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "CurveQuery.h"
+#include "CubicBSpline.h"
+#include "CurveDerivatives.h"
+#include "Vector3.h"
+#include "CurveTestUtils.h"
+
+namespace {
+
+using curvetest::MakePolygon;
+
+// 촘촘한 샘플링으로 구한 최소 거리 (기준값)
+template <typename DistanceFn>
+float DenseMinimum(const ParametricCurve& curve, DistanceFn distance) {
+    float best = 1e30f;
+    const int samples = 20000;
+    for (int i = 0; i <= samples; ++i) {
+        best = std::min(best, distance(curve.Point(static_cast<float>(i) / samples)));
+    }
+    return best;
+}
+
+std::vector<std::unique_ptr<ParametricCurve>> MakeCurves() {
+    std::vector<std::unique_ptr<ParametricCurve>> curves;
+    curves.emplace_back(new CurveDerivatives(MakePolygon(6)));
+    curves.emplace_back(new CubicBSpline(MakePolygon(12), BSplineKnots::Clamped));
+    curves.emplace_back(new CubicBSpline(MakePolygon(12), BSplineKnots::Uniform));
+    return curves;
+}
+
+} // namespace
+
+// 테스트 케이스 1: BezierPieces 는 원래 곡선을 구간별로 그대로 재현
+TEST(CurveQueryTest, BezierPiecesReproduceCurve) {
+    for (const auto& curve : MakeCurves()) {
+        std::vector<BezierPiece> pieces;
+        ASSERT_TRUE(curve->BezierPieces(pieces));
+        ASSERT_FALSE(pieces.empty());
+        EXPECT_FLOAT_EQ(pieces.front().T0, 0.0f);
+        EXPECT_FLOAT_EQ(pieces.back().T1, 1.0f);
+        for (const BezierPiece& piece : pieces) {
+            CurveDerivatives bezier(piece.ControlPoints);
+            for (int i = 0; i <= 8; ++i) {
+                float s = i / 8.0f;
+                Vector3 expected = curve->Point(piece.T0 + s * (piece.T1 - piece.T0));
+                Vector3 actual = bezier.Point(s);
+                EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+                EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+                EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+            }
+        }
+    }
+}
+
+// 테스트 케이스 2: 최근접점은 촘촘한 샘플링 결과 이하, 범위 밖이면 false
+TEST(CurveQueryTest, ClosestPointMatchesDenseSampling) {
+    const Vector3 queries[] = {Vector3(2.5f, 4.0f, 0.0f), Vector3(-3.0f, 0.0f, 1.0f), Vector3(6.0f, -1.0f, -2.0f),
+                               Vector3(4.2f, 0.3f, 0.8f)};
+    for (const auto& curve : MakeCurves()) {
+        for (const Vector3& q : queries) {
+            float expected = DenseMinimum(*curve, [&](const Vector3& p) { return p.distance(q); });
+            CurveHit hit;
+            ASSERT_TRUE(CurveQuery::ClosestPoint(*curve, q, 100.0f, hit));
+            EXPECT_LE(hit.Distance, expected + 1e-4f);
+            EXPECT_NEAR(hit.Distance, expected, 1e-3f);
+            EXPECT_NEAR(hit.Point.distance(curve->Point(hit.Parameter)), 0.0f, 1e-5f);
+            EXPECT_FALSE(CurveQuery::ClosestPoint(*curve, q, expected * 0.9f, hit));
+        }
+    }
+}
+
+// 테스트 케이스 3: 광선 피킹은 광선까지의 수직 거리 최소점을 찾음
+TEST(CurveQueryTest, PickRayMatchesDenseSampling) {
+    const Vector3 origin(3.0f, 0.5f, 10.0f);
+    const Vector3 directions[] = {Vector3(0.0f, 0.0f, -2.0f), Vector3(0.3f, -0.2f, -1.0f), Vector3(-0.5f, 0.4f, -1.0f)};
+    for (const auto& curve : MakeCurves()) {
+        for (const Vector3& direction : directions) {
+            Vector3 d = direction.normalized();
+            auto rayDistance = [&](const Vector3& p) {
+                Vector3 q = p - origin;
+                float along = std::max(0.0f, q.dot(d));
+                return (q - d * along).magnitude();
+            };
+            float expected = DenseMinimum(*curve, rayDistance);
+            CurveHit hit;
+            ASSERT_TRUE(CurveQuery::PickRay(*curve, origin, direction, 100.0f, hit));
+            EXPECT_LE(hit.Distance, expected + 1e-4f);
+            EXPECT_NEAR(hit.Distance, expected, 1e-3f);
+            EXPECT_NEAR(hit.RayDistance, (hit.Point - origin).dot(d), 1e-3f);
+            EXPECT_FALSE(CurveQuery::PickRay(*curve, origin, direction, expected * 0.9f, hit));
+        }
+    }
+    CurveHit hit;
+    EXPECT_FALSE(CurveQuery::PickRay(*MakeCurves()[0], origin, Vector3(), 100.0f, hit));
+}
+
+// 테스트 케이스 4: 두 곡선의 최근접 쌍은 촘촘한 샘플링 결과 이하, 교차하면 거리 0
+TEST(CurveQueryTest, ClosestPairMatchesDenseSampling) {
+    CurveDerivatives bezier(MakePolygon(6));
+    std::vector<BezierPiece> piecesA;
+    bezier.BezierPieces(piecesA);
+
+    // 중심 대칭인 제어점: t = 1/2 에서 A(0.37) 을 지나는 곡선, 그리고 떨어진 B-spline
+    Vector3 p = bezier.Point(0.37f);
+    Vector3 v(0.5f, 1.0f, 2.0f), n(1.0f, -0.5f, 0.3f);
+    std::vector<Vector3> separated;
+    for (const Vector3& q : MakePolygon(8)) separated.emplace_back(q.z * 2.0f + 2.0f, -q.x * 0.7f + 2.0f, q.y * 0.3f);
+    std::vector<std::unique_ptr<ParametricCurve>> others;
+    others.emplace_back(new CurveDerivatives({p - v, p - v * 0.3f + n, p + v * 0.3f - n, p + v}));
+    others.emplace_back(new CubicBSpline(separated));
+
+    for (const auto& other : others) {
+        std::vector<BezierPiece> piecesB;
+        other->BezierPieces(piecesB);
+
+        float expected = 1e30f;
+        const int samples = 1500;
+        std::vector<Vector3> sampled;
+        for (int j = 0; j <= samples; ++j) sampled.push_back(other->Point(static_cast<float>(j) / samples));
+        for (int i = 0; i <= samples; ++i) {
+            Vector3 a = bezier.Point(static_cast<float>(i) / samples);
+            for (const Vector3& b : sampled) expected = std::min(expected, a.distance(b));
+        }
+
+        CurvePairHit hit;
+        ASSERT_TRUE(CurveQuery::ClosestPair(bezier, piecesA, *other, piecesB, 100.0f, hit));
+        EXPECT_LE(hit.Distance, expected + 1e-4f);
+        EXPECT_NEAR(hit.PointA.distance(bezier.Point(hit.ParameterA)), 0.0f, 1e-5f);
+        EXPECT_NEAR(hit.PointB.distance(other->Point(hit.ParameterB)), 0.0f, 1e-5f);
+        if (expected < 0.05f) {
+            EXPECT_NEAR(hit.Distance, 0.0f, 1e-4f);
+            EXPECT_NEAR(hit.ParameterA, 0.37f, 1e-4f);
+            EXPECT_NEAR(hit.ParameterB, 0.5f, 1e-4f);
+        } else {
+            EXPECT_NEAR(hit.Distance, expected, 1e-3f);
+            EXPECT_FALSE(CurveQuery::ClosestPair(bezier, piecesA, *other, piecesB, hit.Distance * 0.9f, hit));
+        }
+    }
+}
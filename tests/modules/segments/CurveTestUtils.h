@@ -0,0 +1,73 @@
+/**
+ * CurveTestUtils.h
+ * Security: Top Secret
+ * Author: Minseok Doo
+ * Date: Oct 17, 2026
+ *
+ * Purpose: Reference evaluation and sample curves shared by the segment tests
+ *
+ * Equations
+ * Equ(1): \vec{B^{\left(r\right)}}\left(t\right)=\sum_{i=0}^{n-r}b_{i,n-r}\left(t\right)\Delta^r\vec{P_i}\prod_{k=0}^{r-1}\left(n-k\right)
+ */
+
+#ifndef CURVETESTUTILS_H
+#define CURVETESTUTILS_H
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "Vector3.h"
+
+namespace curvetest {
+
+    // 기준값: r 차 도함수 (Equ. 1) 를 double 로 직접 계산; order 0 은 곡선 자체
+    inline Vector3d ReferenceDerivative(const std::vector<Vector3>& controlPoints, double t, int order) {
+        std::vector<Vector3d> points;
+        for (const Vector3& p : controlPoints) points.emplace_back(p);
+        for (int r = 0; r < order; ++r) {
+            int n = static_cast<int>(points.size()) - 1;
+            std::vector<Vector3d> next;
+            for (int i = 0; i < n; ++i) next.push_back((points[i + 1] - points[i]) * static_cast<double>(n));
+            points.swap(next);
+        }
+        if (points.empty()) return Vector3d();
+        int n = static_cast<int>(points.size()) - 1;
+        Vector3d sum;
+        for (int i = 0; i <= n; ++i) {
+            double binomial = 1.0;
+            for (int k = 1; k <= i; ++k) binomial = binomial * (n - i + k) / k;
+            sum += points[i] * (binomial * std::pow(1.0 - t, n - i) * std::pow(t, i));
+        }
+        return sum;
+    }
+
+    // 베어링이 많은 Vertex 에서 나오는 고차 Bezier 제어점 (count = 13 이면 degree 12)
+    inline std::vector<Vector3> MakeControlPoints(int count) {
+        std::vector<Vector3> controlPoints;
+        for (int i = 0; i < count; ++i) {
+            float a = static_cast<float>(i);
+            controlPoints.emplace_back(a * 1.5f, std::sin(a) * 4.0f, std::cos(a * 0.7f) * 3.0f - a);
+        }
+        return controlPoints;
+    }
+
+    // B-스플라인용 긴 제어 다각형
+    inline std::vector<Vector3> MakePolygon(int count) {
+        std::vector<Vector3> points;
+        for (int i = 0; i < count; ++i) {
+            float a = static_cast<float>(i);
+            points.emplace_back(a, std::sin(a * 0.9f) * 3.0f, std::cos(a * 0.4f));
+        }
+        return points;
+    }
+
+    inline void ExpectNear(const Vector3& actual, const Vector3& expected, float tolerance) {
+        EXPECT_NEAR(actual.x, expected.x, tolerance);
+        EXPECT_NEAR(actual.y, expected.y, tolerance);
+        EXPECT_NEAR(actual.z, expected.z, tolerance);
+    }
+
+} // namespace curvetest
+
+#endif // CURVETESTUTILS_H
@@ -0,0 +1,65 @@
+// FixedDegreeBezierTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "FixedDegreeBezier.h"
+#include "BernsteinBasisCache.h"
+#include "Vector3.h"
+#include "CurveTestUtils.h"
+
+namespace {
+
+using curvetest::ExpectNear;
+using curvetest::MakeControlPoints;
+
+Vector3 Reference(const std::vector<Vector3>& controlPoints, double t, int order) {
+    return Vector3(curvetest::ReferenceDerivative(controlPoints, t, order));
+}
+
+} // namespace
+
+// 테스트 케이스 1: 디스패치 테이블 범위
+TEST(FixedDegreeBezierTest, DispatchCoversCompiledDegrees) {
+    EXPECT_EQ(FixedDegreeBezier::Find(0), nullptr);
+    EXPECT_EQ(FixedDegreeBezier::Find(FixedDegreeBezier::kMaxDegree + 1), nullptr);
+    for (int degree = FixedDegreeBezier::kMinDegree; degree <= FixedDegreeBezier::kMaxDegree; ++degree) {
+        const BezierKernelSet* kernel = FixedDegreeBezier::Find(degree);
+        ASSERT_NE(kernel, nullptr);
+        EXPECT_EQ(kernel->Degree, degree);
+    }
+    EXPECT_EQ(FixedDegreeBezier::ForControlPoints(MakeControlPoints(4))->Degree, 3);
+}
+
+// 테스트 케이스 2: 모든 차수에서 점, 1차, 2차 도함수가 기준값과 일치
+TEST(FixedDegreeBezierTest, KernelsMatchReference) {
+    for (int degree = FixedDegreeBezier::kMinDegree; degree <= FixedDegreeBezier::kMaxDegree; ++degree) {
+        std::vector<Vector3> controlPoints = MakeControlPoints(degree + 1);
+        const BezierKernelSet* kernel = FixedDegreeBezier::Find(degree);
+        for (int i = 0; i <= 16; ++i) {
+            float t = i / 16.0f;
+            Vector3 point = Reference(controlPoints, t, 0);
+            Vector3 first = Reference(controlPoints, t, 1);
+            Vector3 second = Reference(controlPoints, t, 2);
+            ExpectNear(kernel->Point(controlPoints.data(), t), point, 1e-4f * std::max(1.0f, point.magnitude()));
+            ExpectNear(kernel->FirstDerivative(controlPoints.data(), t), first, 1e-4f * std::max(1.0f, first.magnitude()));
+            ExpectNear(kernel->SecondDerivative(controlPoints.data(), t), second, 1e-4f * std::max(1.0f, second.magnitude()));
+        }
+    }
+}
+
+// 테스트 케이스 3: 기저 테이블 행 평가는 BernsteinBasis::EvaluateAll 과 일치
+TEST(FixedDegreeBezierTest, RowsMatchBasisTable) {
+    for (int degree : {1, 3, 7, 10}) {
+        std::vector<Vector3> controlPoints = MakeControlPoints(degree + 1);
+        auto basis = BernsteinBasisCache::Get(degree, 50);
+        std::vector<Vector3> expected;
+        basis->EvaluateAll(controlPoints, expected);
+        std::vector<Vector3> actual(basis->Rows());
+        FixedDegreeBezier::Find(degree)->EvaluateRows(controlPoints.data(), basis->weights.data(), basis->Rows(), actual.data());
+        for (int k = 0; k < basis->Rows(); ++k) {
+            ExpectNear(actual[k], expected[k], 1e-4f);
+        }
+    }
+}
@@ -1,7 +1,9 @@
 // LinearSegmentTest.cc
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 // 포함해야 할 헤더 파일들
 #include "LinearSegment.h"
@@ -156,3 +158,384 @@ TEST_F(LinearSegmentTest, CalculateControlPointsTest) {
     // Pn = N2
     EXPECT_EQ(controlPoints[6], Vector3(10.0f, 0.0f, 0.0f));
 }
+
+// 테스트 케이스 10: 모든 Bezier 평가 방식이 BezierPoint 와 일치
+TEST_F(LinearSegmentTest, BezierMethodsMatchBezierPoint) {
+    // 직선이 아닌 곡선을 만들기 위해 베어링 방향을 변경
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PostBearingVector(BearingVector(startNode, Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 1.0f, 0.5f)));
+    NodeVector endNode = endVertex.ReadNodeVector();
+    endVertex.PostBearingVector(BearingVector(endNode, Vector3(0.0f, 0.0f, 3.0f), Vector3(0.3f, 0.0f, 1.0f)));
+
+    std::vector<Vector3> controlPoints = linearSegment->CalculateControlPoints(0.5f);
+    for (BezierMethod method : {BezierMethod::DeCasteljau, BezierMethod::Horner, BezierMethod::ForwardDifference, BezierMethod::BasisTable, BezierMethod::FixedDegree}) {
+        linearSegment->SetBezierMethod(method);
+        EXPECT_EQ(linearSegment->ReadBezierMethod(), method);
+
+        auto cache = linearSegment->GetLinearSegmentCache();
+        ASSERT_EQ(cache->size(), 11);
+        for (int i = 0; i <= 10; ++i) {
+            float t = static_cast<float>(i) / 10.0f;
+            Vector3 expected = linearSegment->BezierPoint(controlPoints, t);
+            EXPECT_NEAR((*cache)[i].x, expected.x, 1e-4f);
+            EXPECT_NEAR((*cache)[i].y, expected.y, 1e-4f);
+            EXPECT_NEAR((*cache)[i].z, expected.z, 1e-4f);
+        }
+    }
+}
+
+// 테스트 케이스 11: 샘플 지점의 곡률은 기저 테이블 경로와 직접 계산 경로가 일치
+TEST_F(LinearSegmentTest, CurvatureFromBasisTableMatchesDirect) {
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PutBearingVector(BearingVector(startNode, Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 1.0f, 0.5f)));
+
+    std::vector<Vector3> controlPoints = linearSegment->CalculateControlPoints(0.5f);
+    for (int i = 0; i <= 10; ++i) {
+        float t = static_cast<float>(i) / 10.0f;
+        Vector3 d1 = linearSegment->BezierFirstDerivative(controlPoints, t);
+        Vector3 d2 = linearSegment->BezierSecondDerivative(controlPoints, t);
+        float expected = d2.cross(d1).magnitude() / powf(d1.magnitude(), 3);
+        EXPECT_NEAR(linearSegment->CalculateCurvature(t), expected, 1e-3f * std::max(1.0f, expected));
+    }
+}
+
+// 테스트 케이스 12: 정점 버전이 바뀔 때만 지연 재계산
+TEST_F(LinearSegmentTest, RebuildsOnlyWhenVertexVersionChanges) {
+    std::size_t builds = linearSegment->_rebuildCount;
+
+    // 수정이 없으면 재계산 없음
+    linearSegment->GetLinearSegmentCache();
+    linearSegment->CreatePolygonVertices(5);
+    EXPECT_FALSE(linearSegment->IsStale());
+    EXPECT_EQ(linearSegment->_rebuildCount, builds);
+
+    // 정점 수정 후 다음 조회에서 한 번만 재계산
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PutBearingVector(BearingVector(startNode, Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 1.0f, 0.5f)));
+    endVertex.UpdateNodeVector(NodeVector(1, Vector3(8.0f, 2.0f, 0.0f)));
+    EXPECT_TRUE(linearSegment->IsStale());
+    EXPECT_EQ(linearSegment->_rebuildCount, builds);
+
+    auto cache = linearSegment->GetLinearSegmentCache();
+    linearSegment->GetLinearSegmentCache();
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 1);
+    EXPECT_FALSE(linearSegment->IsStale());
+
+    // 새로 만든 세그먼트와 동일한 결과
+    LinearSegment fresh(startVertex, endVertex, 0.5f, 10);
+    auto expected = fresh.GetLinearSegmentCache();
+    ASSERT_EQ(cache->size(), expected->size());
+    for (std::size_t i = 0; i < cache->size(); ++i) {
+        EXPECT_EQ((*cache)[i], (*expected)[i]);
+    }
+}
+
+// 테스트 케이스 13: 지연 모드에서 여러 setter 호출 후 한 번만 재계산
+TEST_F(LinearSegmentTest, DeferredSettersRebuildOnce) {
+    std::size_t builds = linearSegment->_rebuildCount;
+
+    // LOD는 캐시에 영향이 없음
+    linearSegment->SetLOD(4);
+    EXPECT_EQ(linearSegment->_rebuildCount, builds);
+
+    linearSegment->SetDeferredRecompute(true);
+    for (int i = 0; i < 20; ++i) {
+        linearSegment->SetAlpha(0.05f * i);
+        linearSegment->SetNumSegments(10 + i);
+    }
+    EXPECT_TRUE(linearSegment->IsStale());
+    EXPECT_EQ(linearSegment->_rebuildCount, builds);
+
+    auto cache = linearSegment->GetLinearSegmentCache();
+    linearSegment->GetLinearSegmentCache();
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 1);
+    EXPECT_EQ(cache->size(), 30);
+
+    // 명시적 Commit
+    linearSegment->SetNumSegments(5);
+    linearSegment->Commit();
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 2);
+    EXPECT_EQ(linearSegment->GetLinearSegmentCache()->size(), 6);
+
+    // 지연 모드 해제 시 즉시 재계산 동작 복원
+    linearSegment->SetNumSegments(8);
+    linearSegment->SetDeferredRecompute(false);
+    EXPECT_FALSE(linearSegment->IsStale());
+    linearSegment->SetNumSegments(10);
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 4);
+}
+
+// 테스트 케이스 14: BatchEdit 가드는 종료 시 한 번만 재계산
+TEST_F(LinearSegmentTest, BatchEditRebuildsOnceOnExit) {
+    std::size_t builds = linearSegment->_rebuildCount;
+    {
+        LinearSegment::BatchEdit outer(*linearSegment);
+        linearSegment->SetAlpha(0.3f);
+        {
+            LinearSegment::BatchEdit inner(*linearSegment);
+            linearSegment->SetNumSegments(16);
+            linearSegment->SetBezierMethod(BezierMethod::Horner);
+        }
+        EXPECT_EQ(linearSegment->_rebuildCount, builds);
+    }
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 1);
+    EXPECT_FALSE(linearSegment->IsStale());
+
+    // 즉시 계산한 세그먼트와 동일
+    LinearSegment eager(startVertex, endVertex, 0.3f, 16);
+    eager.SetBezierMethod(BezierMethod::Horner);
+    auto cache = linearSegment->GetLinearSegmentCache();
+    auto expected = eager.GetLinearSegmentCache();
+    ASSERT_EQ(cache->size(), expected->size());
+    for (std::size_t i = 0; i < cache->size(); ++i) {
+        EXPECT_EQ((*cache)[i], (*expected)[i]);
+    }
+
+    // 변경 없는 배치는 재계산하지 않음
+    { LinearSegment::BatchEdit noop(*linearSegment); }
+    EXPECT_EQ(linearSegment->_rebuildCount, builds + 1);
+}
+
+// 테스트 케이스 15: 적응형 모드는 곡선 모양에 맞춰 점 수를 줄임
+TEST_F(LinearSegmentTest, AdaptiveModeUsesFewerPoints) {
+    linearSegment->SetNumSegments(100);
+    EXPECT_EQ(linearSegment->GetLinearSegmentCache()->size(), 101);
+    EXPECT_FLOAT_EQ((*linearSegment->GetLinearSegmentParameters())[50], 0.5f);
+
+    // 직선: 초기 분할만 남음
+    AdaptiveTessellationOptions options;
+    options.tolerance = 1e-3f;
+    linearSegment->SetAdaptiveOptions(options);
+    linearSegment->SetTessellationMode(TessellationMode::Adaptive);
+    EXPECT_EQ(linearSegment->ReadTessellationMode(), TessellationMode::Adaptive);
+    EXPECT_EQ(linearSegment->GetLinearSegmentCache()->size(), static_cast<std::size_t>(options.minSegments + 1));
+
+    // 곡선으로 바꾸면 정점 버전 변경으로 다시 샘플링
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PostBearingVector(BearingVector(startNode, Vector3(0.0f, 4.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)));
+    auto cache = linearSegment->GetLinearSegmentCache();
+    auto params = linearSegment->GetLinearSegmentParameters();
+    ASSERT_EQ(cache->size(), params->size());
+    EXPECT_GT(cache->size(), static_cast<std::size_t>(options.minSegments + 1));
+    EXPECT_LE(cache->size(), static_cast<std::size_t>(options.maxPoints));
+    EXPECT_EQ(cache->front(), Vector3(0.0f, 0.0f, 0.0f));
+    EXPECT_EQ(cache->back(), Vector3(10.0f, 0.0f, 0.0f));
+
+    // 예산 변경은 적응형 모드에서 즉시 반영
+    options.maxPoints = 6;
+    options.tolerance = 1e-6f;
+    linearSegment->SetAdaptiveOptions(options);
+    EXPECT_EQ(linearSegment->GetLinearSegmentCache()->size(), 6);
+}
+
+// 테스트 케이스 16: LOD 피라미드는 캐시 재계산 때만 다시 만들어짐
+TEST_F(LinearSegmentTest, LodPyramidFollowsCache) {
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PutBearingVector(BearingVector(startNode, Vector3(0.0f, 4.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)));
+    linearSegment->SetNumSegments(64);
+
+    auto pyramid = linearSegment->GetLodPyramid();
+    ASSERT_TRUE(pyramid);
+    EXPECT_EQ(pyramid->Level(0).Points.size(), 65);
+
+    // 줌 변경은 재계산 없이 레벨만 선택
+    std::size_t builds = linearSegment->_rebuildCount;
+    auto fine = linearSegment->ReadLodPoints(0.0f);
+    auto coarse = linearSegment->ReadLodPoints(10.0f);
+    EXPECT_EQ(fine->size(), 65);
+    EXPECT_EQ(coarse->size(), 2);
+    EXPECT_EQ(linearSegment->ReadLodPointsForScreen(1.0f, 100.0f), linearSegment->ReadLodPoints(0.01f));
+    EXPECT_EQ(linearSegment->GetLodPyramid(), pyramid);
+    EXPECT_EQ(linearSegment->_rebuildCount, builds);
+
+    // 정점 수정 후 새 피라미드; 이전 포인터는 그대로 유효
+    endVertex.UpdateNodeVector(NodeVector(1, Vector3(12.0f, 0.0f, 0.0f)));
+    auto rebuilt = linearSegment->GetLodPyramid();
+    EXPECT_NE(rebuilt, pyramid);
+    EXPECT_EQ(rebuilt->Level(0).Points.back(), Vector3(12.0f, 0.0f, 0.0f));
+    EXPECT_EQ(pyramid->Level(0).Points.back(), Vector3(10.0f, 0.0f, 0.0f));
+    EXPECT_EQ(fine->back(), Vector3(10.0f, 0.0f, 0.0f));
+    EXPECT_EQ(coarse->size(), 2);
+}
+
+// 테스트 케이스 17: 호 길이 테이블은 지연 생성, 재샘플링은 등간격
+TEST_F(LinearSegmentTest, ArcLengthResamplingIsEquallySpaced) {
+    // 직선: 길이 10
+    EXPECT_NEAR(linearSegment->CalculateLength(), 10.0f, 1e-4f);
+    auto table = linearSegment->GetArcLengthTable();
+    EXPECT_EQ(linearSegment->GetArcLengthTable(), table);
+
+    // 베어링이 바뀌면 테이블도 다시 생성
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PutBearingVector(BearingVector(startNode, Vector3(0.0f, 4.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)));
+    EXPECT_NE(linearSegment->GetArcLengthTable(), table);
+    EXPECT_GT(linearSegment->CalculateLength(), 10.0f);
+
+    std::vector<Vector3> points = linearSegment->ResampleByArcLength(21);
+    ASSERT_EQ(points.size(), 21);
+    EXPECT_EQ(points.front(), Vector3(0.0f, 0.0f, 0.0f));
+    EXPECT_EQ(points.back(), Vector3(10.0f, 0.0f, 0.0f));
+    float step = linearSegment->CalculateLength() / 20.0f;
+    for (std::size_t k = 1; k < points.size(); ++k) {
+        // 현의 길이는 호 길이보다 약간 짧음
+        float chord = points[k].distance(points[k - 1]);
+        EXPECT_LE(chord, step * 1.001f);
+        EXPECT_GT(chord, step * 0.95f);
+    }
+
+    float half = linearSegment->ParameterAtLength(linearSegment->CalculateLength() * 0.5f);
+    EXPECT_GT(half, 0.0f);
+    EXPECT_LT(half, 1.0f);
+}
+
+// 테스트 케이스 18: 배치 곡률 프로파일은 캐시된 점마다 CalculateCurvature 와 일치
+TEST_F(LinearSegmentTest, CurvatureProfileMatchesScalar) {
+    NodeVector startNode = startVertex.ReadNodeVector();
+    startVertex.PutBearingVector(BearingVector(startNode, Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 1.0f, 0.5f)));
+
+    auto params = linearSegment->GetLinearSegmentParameters();
+    std::vector<CurvatureSample> profile = linearSegment->CurvatureProfile(*params);
+    ASSERT_EQ(profile.size(), params->size());
+    for (std::size_t i = 0; i < profile.size(); ++i) {
+        EXPECT_FLOAT_EQ(profile[i].Curvature, linearSegment->CalculateCurvature((*params)[i]));
+    }
+
+    // 호도그래프는 재계산 때만 교체
+    auto derivatives = linearSegment->GetCurveDerivatives();
+    EXPECT_EQ(linearSegment->GetCurveDerivatives(), derivatives);
+    EXPECT_EQ(derivatives->ControlPoints().size(), linearSegment->CalculateControlPoints(0.5f).size());
+    linearSegment->SetAlpha(0.25f);
+    EXPECT_NE(linearSegment->GetCurveDerivatives(), derivatives);
+}
+
+// 테스트 케이스 19: 구간별 3차 B-spline 표현과 Bezier 교차 검증
+TEST_F(LinearSegmentTest, PiecewiseCubicMatchesBezierWhereExpected) {
+    // 제어점 7개: 양 끝은 같고 직선은 직선으로 유지
+    linearSegment->SetCurveRepresentation(CurveRepresentation::PiecewiseCubic);
+    EXPECT_EQ(linearSegment->ReadCurveRepresentation(), CurveRepresentation::PiecewiseCubic);
+    auto cache = linearSegment->GetLinearSegmentCache();
+    ASSERT_EQ(cache->size(), 11);
+    EXPECT_EQ(cache->front(), Vector3(0.0f, 0.0f, 0.0f));
+    EXPECT_EQ(cache->back(), Vector3(10.0f, 0.0f, 0.0f));
+    for (const Vector3& p : *cache) {
+        EXPECT_NEAR(p.y, 0.0f, 1e-5f);
+        EXPECT_NEAR(p.z, 0.0f, 1e-5f);
+    }
+    EXPECT_NEAR(linearSegment->CalculateCurvature(0.5f), 0.0f, 1e-4f);
+    EXPECT_NEAR(linearSegment->CalculateLength(), 10.0f, 1e-3f);
+
+    // 제어점 4개 (시작 베어링 1개, 끝 베어링 0개): B-spline 과 Bezier 가 일치
+    Vertex a, b;
+    NodeVector na(0, Vector3(0.0f, 0.0f, 0.0f));
+    NodeVector nb(1, Vector3(6.0f, 1.0f, 0.0f));
+    a.UpdateNodeVector(na);
+    b.UpdateNodeVector(nb);
+    a.PostBearingVector(BearingVector(na, Vector3(0.0f, 3.0f, 0.0f), Vector3(0.0f, 1.0f, 0.2f)));
+    LinearSegment bezier(a, b, 0.5f, 20);
+    LinearSegment spline(a, b, 0.5f, 20);
+    spline.SetCurveRepresentation(CurveRepresentation::PiecewiseCubic);
+    ASSERT_EQ(spline.GetCurveDerivatives()->ControlPoints().size(), 4);
+
+    auto expected = bezier.GetLinearSegmentCache();
+    auto actual = spline.GetLinearSegmentCache();
+    ASSERT_EQ(actual->size(), expected->size());
+    for (std::size_t i = 0; i < actual->size(); ++i) {
+        EXPECT_NEAR((*actual)[i].x, (*expected)[i].x, 1e-4f);
+        EXPECT_NEAR((*actual)[i].y, (*expected)[i].y, 1e-4f);
+        EXPECT_NEAR((*actual)[i].z, (*expected)[i].z, 1e-4f);
+    }
+    EXPECT_NEAR(spline.CalculateCurvature(0.3f), bezier.CalculateCurvature(0.3f), 1e-3f);
+    EXPECT_NEAR(spline.CalculateLength(), bezier.CalculateLength(), 1e-3f);
+
+    // 매듭 배치 변경은 B-spline 일 때만 재계산
+    std::size_t builds = bezier._rebuildCount;
+    bezier.SetBSplineKnots(BSplineKnots::Uniform);
+    EXPECT_EQ(bezier._rebuildCount, builds);
+}
+
+// 테스트 케이스 20: 제어점 박스는 곡선을 포함하고 편집을 따라감
+TEST_F(LinearSegmentTest, BoundsContainCurveAndFollowEdits) {
+    startVertex.PutBearingVector(BearingVector(startVertex.ReadNodeVector(), Vector3(0.0f, 1.0f, 2.0f), Vector3(2.0f, 3.0f, 0.0f)));
+    for (CurveRepresentation representation : {CurveRepresentation::Bezier, CurveRepresentation::PiecewiseCubic}) {
+        linearSegment->SetCurveRepresentation(representation);
+        AABB bounds = linearSegment->GetBounds();
+        EXPECT_EQ(bounds.Min, AABB::FromPoints(linearSegment->GetCurveDerivatives()->ControlPoints()).Min);
+        for (const Vector3& p : *linearSegment->GetLinearSegmentCache()) {
+            EXPECT_TRUE(bounds.Contains(p)) << p;
+        }
+    }
+
+    endVertex.UpdateNodeVector(NodeVector(1, Vector3(10.0f, -7.0f, 0.0f)));
+    AABB moved = linearSegment->GetBounds();
+    EXPECT_FLOAT_EQ(moved.Min.y, -7.0f);
+    EXPECT_TRUE(moved.Contains(linearSegment->GetLinearSegmentCache()->back()));
+}
+
+// 테스트 케이스 21: 최근접점/광선 피킹은 캐시 샘플보다 가깝고 편집을 따라감
+TEST_F(LinearSegmentTest, ClosestPointAndPickMatchDenseSampling) {
+    startVertex.PutBearingVector(BearingVector(startVertex.ReadNodeVector(), Vector3(0.0f, 1.0f, 2.0f), Vector3(2.0f, 3.0f, 0.0f)));
+    const Vector3 query(1.5f, 2.0f, -1.0f);
+    for (CurveRepresentation representation : {CurveRepresentation::Bezier, CurveRepresentation::PiecewiseCubic}) {
+        linearSegment->SetCurveRepresentation(representation);
+        ASSERT_FALSE(linearSegment->GetBezierPieces()->empty());
+
+        float sampled = 1e30f;
+        for (const Vector3& p : *linearSegment->GetLinearSegmentCache()) {
+            sampled = std::min(sampled, p.distance(query));
+        }
+        CurveHit hit;
+        ASSERT_TRUE(linearSegment->ClosestPoint(query, 100.0f, hit));
+        EXPECT_LE(hit.Distance, sampled + 1e-5f);
+        EXPECT_NEAR(hit.Point.distance(linearSegment->GetCurve()->Point(hit.Parameter)), 0.0f, 1e-5f);
+
+        // 곡선 위의 점을 지나는 광선은 거리 0 으로 그 점을 찾음
+        Vector3 target = linearSegment->GetCurve()->Point(0.4f);
+        Vector3 origin = target + Vector3(0.0f, 0.0f, 5.0f);
+        CurveHit pick;
+        ASSERT_TRUE(linearSegment->PickRay(origin, Vector3(0.0f, 0.0f, -1.0f), 0.1f, pick));
+        EXPECT_NEAR(pick.Distance, 0.0f, 1e-3f);
+        EXPECT_NEAR(pick.RayDistance, 5.0f, 1e-2f);
+    }
+
+    endVertex.UpdateNodeVector(NodeVector(1, Vector3(10.0f, -7.0f, 0.0f)));
+    CurveHit moved;
+    ASSERT_TRUE(linearSegment->ClosestPoint(Vector3(10.0f, -7.0f, 0.0f), 1e-3f, moved));
+    EXPECT_NEAR(moved.Parameter, 1.0f, 1e-4f);
+}
+
+// 테스트 케이스 22: 재계산 중에도 다른 스레드는 완성된 스냅샷만 보고, 보유한 스냅샷은 바뀌지 않음
+TEST_F(LinearSegmentTest, SnapshotReadsStayConsistentDuringRebuild) {
+    std::shared_ptr<const LinearSegmentSnapshot> held = linearSegment->GetSnapshot();
+    const std::vector<Vector3> heldPoints = held->Points;
+
+    const Vector3 near(10.0f, 0.0f, 0.0f), far(20.0f, 5.0f, 0.0f);
+    std::atomic<bool> done(false);
+    std::atomic<int> reads(0), torn(0);
+    std::thread reader([&]() {
+        while (!done.load()) {
+            std::shared_ptr<const LinearSegmentSnapshot> snapshot = linearSegment->GetSnapshot();
+            // 11 점은 near 빌드, 31 점은 far 빌드여야 함
+            const std::vector<Vector3>& points = snapshot->Points;
+            bool consistent = points.size() == snapshot->Parameters.size() &&
+                              ((points.size() == 11 && points.back() == near) || (points.size() == 31 && points.back() == far)) &&
+                              snapshot->Bounds.Contains(points[points.size() / 2]);
+            torn += consistent ? 0 : 1;
+            ++reads;
+        }
+    });
+    while (reads.load() == 0) std::this_thread::yield();
+    for (int i = 0; i < 400; ++i) {
+        bool toFar = i % 2 == 0;
+        endVertex.UpdateNodeVector(NodeVector(1, toFar ? far : near));
+        linearSegment->SetNumSegments(toFar ? 30 : 10);
+        std::this_thread::yield();
+    }
+    done = true;
+    reader.join();
+    EXPECT_GT(reads.load(), 0);
+    EXPECT_EQ(torn.load(), 0);
+
+    // 이전 스냅샷은 보유자가 놓을 때까지 그대로
+    EXPECT_EQ(held->Points, heldPoints);
+    EXPECT_NE(linearSegment->GetSnapshot(), held);
+}
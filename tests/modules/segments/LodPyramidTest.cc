@@ -0,0 +1,92 @@
+// LodPyramidTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "LodPyramid.h"
+#include "AdaptiveTessellator.h"
+#include "Vector3.h"
+
+namespace {
+
+// 반원 호 샘플
+std::vector<Vector3> MakeArc(int count, float radius) {
+    std::vector<Vector3> samples;
+    for (int i = 0; i < count; ++i) {
+        float a = 3.14159265f * i / (count - 1);
+        samples.emplace_back(radius * std::cos(a), radius * std::sin(a), 0.0f);
+    }
+    return samples;
+}
+
+// 원본 샘플에서 폴리라인까지 최대 거리 (직접 계산)
+float BruteForceError(const std::vector<Vector3>& samples, const std::vector<Vector3>& polyline) {
+    float worst = 0.0f;
+    for (const Vector3& p : samples) {
+        float best = 1e30f;
+        for (std::size_t k = 0; k + 1 < polyline.size(); ++k) {
+            best = std::min(best, AdaptiveTessellator::DistanceToChord(p, polyline[k], polyline[k + 1]));
+        }
+        worst = std::max(worst, best);
+    }
+    return worst;
+}
+
+} // namespace
+
+// 테스트 케이스 1: 레벨 구조 - 중첩, 양 끝점 유지, 오차 단조 증가
+TEST(LodPyramidTest, LevelsAreNestedWithMonotonicError) {
+    std::vector<Vector3> samples = MakeArc(101, 10.0f);
+    LodPyramid pyramid;
+    pyramid.Build(samples);
+
+    ASSERT_GE(pyramid.LevelCount(), 2);
+    EXPECT_EQ(pyramid.Level(0).Points.size(), samples.size());
+    EXPECT_EQ(pyramid.Level(0).Error, 0.0f);
+    EXPECT_EQ(pyramid.Level(pyramid.LevelCount() - 1).Points.size(), 2);
+
+    for (std::size_t level = 1; level < pyramid.LevelCount(); ++level) {
+        const LodLevel& coarse = pyramid.Level(level);
+        const LodLevel& fine = pyramid.Level(level - 1);
+        EXPECT_LT(coarse.Points.size(), fine.Points.size());
+        EXPECT_GE(coarse.Error, fine.Error);
+        EXPECT_EQ(coarse.Points.front(), samples.front());
+        EXPECT_EQ(coarse.Points.back(), samples.back());
+        // 저장된 오차는 직접 계산한 오차 이상 (단조화 때문에 같거나 큼)
+        EXPECT_GE(coarse.Error + 1e-5f, BruteForceError(samples, coarse.Points));
+    }
+}
+
+// 테스트 케이스 2: 임계값 이하의 가장 거친 레벨 선택
+TEST(LodPyramidTest, SelectsCoarsestLevelUnderThreshold) {
+    LodPyramid pyramid;
+    pyramid.Build(MakeArc(257, 10.0f));
+
+    for (float threshold : {0.0f, 1e-3f, 1e-2f, 0.1f, 1.0f, 100.0f}) {
+        std::size_t level = pyramid.SelectLevel(threshold);
+        if (level > 0) {
+            EXPECT_LE(pyramid.Level(level).Error, threshold);
+        }
+        if (level + 1 < pyramid.LevelCount()) {
+            EXPECT_GT(pyramid.Level(level + 1).Error, threshold);
+        }
+    }
+    EXPECT_EQ(pyramid.SelectLevel(0.0f), 0);
+    EXPECT_EQ(pyramid.SelectLevel(100.0f), pyramid.LevelCount() - 1);
+
+    // 화면 공간: 1 픽셀 = 0.1 월드 단위
+    EXPECT_EQ(pyramid.SelectLevelForScreen(0.5f, 10.0f), pyramid.SelectLevel(0.05f));
+}
+
+// 테스트 케이스 3: 빈 입력과 두 점 입력
+TEST(LodPyramidTest, HandlesTinyInputs) {
+    LodPyramid pyramid;
+    pyramid.Build({});
+    EXPECT_TRUE(pyramid.Empty());
+    EXPECT_EQ(pyramid.SelectLevel(1.0f), 0);
+
+    pyramid.Build({Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)});
+    EXPECT_EQ(pyramid.LevelCount(), 1);
+    EXPECT_EQ(pyramid.SelectLevel(1.0f), 0);
+}
@@ -0,0 +1,128 @@
+// SegmentBVHTest.cc
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "SegmentBVH.h"
+#include "AABB.h"
+#include "Vector3.h"
+
+namespace {
+
+std::vector<AABB> MakeBoxes(std::size_t count, unsigned seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+    std::vector<AABB> boxes;
+    for (std::size_t i = 0; i < count; ++i) {
+        Vector3 min(position(random), position(random), position(random));
+        boxes.emplace_back(min, min + Vector3(size(random), size(random), size(random)));
+    }
+    return boxes;
+}
+
+std::vector<std::size_t> Sorted(std::vector<std::size_t> values) {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+} // namespace
+
+// 테스트 케이스 1: AABB 기본 연산
+TEST(SegmentBVHTest, AABBTests) {
+    AABB empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_FALSE(empty.IntersectsSphere(Vector3(), 100.0f));
+
+    AABB box = AABB::FromPoints(std::vector<Vector3>{Vector3(1.0f, 2.0f, 3.0f), Vector3(-1.0f, 0.0f, 5.0f)});
+    EXPECT_EQ(box.Min, Vector3(-1.0f, 0.0f, 3.0f));
+    EXPECT_EQ(box.Max, Vector3(1.0f, 2.0f, 5.0f));
+    EXPECT_TRUE(box.Contains(Vector3(0.0f, 1.0f, 4.0f)));
+    EXPECT_TRUE(box.Intersects(AABB(Vector3(1.0f, 2.0f, 5.0f), Vector3(3.0f, 3.0f, 6.0f)))); // 모서리 접촉
+    EXPECT_FALSE(box.Intersects(AABB(Vector3(1.1f, 0.0f, 3.0f), Vector3(2.0f, 1.0f, 4.0f))));
+    EXPECT_FLOAT_EQ(box.DistanceSquared(Vector3(4.0f, 1.0f, 4.0f)), 9.0f);
+    EXPECT_TRUE(box.IntersectsSphere(Vector3(4.0f, 1.0f, 4.0f), 3.0f));
+    EXPECT_FALSE(box.IntersectsSphere(Vector3(4.0f, 1.0f, 4.0f), 2.9f));
+
+    // 축에 평행한 광선과 진입 거리
+    const float inf = std::numeric_limits<float>::infinity();
+    float entry = -1.0f;
+    EXPECT_TRUE(box.IntersectsRay(Vector3(-5.0f, 1.0f, 4.0f), Vector3(1.0f, inf, inf), 100.0f, &entry));
+    EXPECT_FLOAT_EQ(entry, 4.0f);
+    EXPECT_FALSE(box.IntersectsRay(Vector3(-5.0f, 1.0f, 4.0f), Vector3(1.0f, inf, inf), 3.0f));
+    EXPECT_FALSE(box.IntersectsRay(Vector3(-5.0f, 3.0f, 4.0f), Vector3(1.0f, inf, inf), 100.0f));
+    EXPECT_FALSE(box.IntersectsRay(Vector3(-5.0f, 1.0f, 4.0f), Vector3(-1.0f, inf, inf), 100.0f));
+}
+
+// 테스트 케이스 2: 박스, 구, 광선 질의는 전수 검사와 동일
+TEST(SegmentBVHTest, QueriesMatchLinearScan) {
+    std::vector<AABB> boxes = MakeBoxes(500, 7);
+    SegmentBVH bvh;
+    bvh.Build(boxes);
+    EXPECT_EQ(bvh.ItemCount(), boxes.size());
+    EXPECT_LE(bvh.NodeCount(), 2 * boxes.size());
+
+    AABB query(Vector3(-10.0f, -10.0f, -10.0f), Vector3(15.0f, 5.0f, 20.0f));
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); ++i) if (boxes[i].Intersects(query)) expected.push_back(i);
+    std::vector<std::size_t> actual;
+    bvh.QueryBox(query, actual);
+    EXPECT_EQ(Sorted(actual), expected);
+
+    Vector3 center(3.0f, -2.0f, 8.0f);
+    expected.clear();
+    for (std::size_t i = 0; i < boxes.size(); ++i) if (boxes[i].IntersectsSphere(center, 12.0f)) expected.push_back(i);
+    actual.clear();
+    bvh.QuerySphere(center, 12.0f, actual);
+    EXPECT_EQ(Sorted(actual), expected);
+
+    // 광선 결과는 진입 거리 순
+    Vector3 origin(-60.0f, 1.0f, -2.0f);
+    Vector3 direction(2.0f, 0.1f, 0.15f);
+    Vector3 unit = direction.normalized();
+    Vector3 inverse(1.0f / unit.x, 1.0f / unit.y, 1.0f / unit.z);
+    expected.clear();
+    for (std::size_t i = 0; i < boxes.size(); ++i) if (boxes[i].IntersectsRay(origin, inverse, 200.0f)) expected.push_back(i);
+    actual.clear();
+    bvh.QueryRay(origin, direction, 200.0f, actual);
+    ASSERT_EQ(Sorted(actual), expected);
+    float previous = -1.0f;
+    for (std::size_t index : actual) {
+        float entry = 0.0f;
+        boxes[index].IntersectsRay(origin, inverse, 200.0f, &entry);
+        EXPECT_GE(entry, previous);
+        previous = entry;
+    }
+}
+
+// 테스트 케이스 3: Refit 후에도 질의 결과가 정확
+TEST(SegmentBVHTest, RefitTracksMovedBoxes) {
+    std::vector<AABB> boxes = MakeBoxes(200, 11);
+    SegmentBVH bvh;
+    bvh.Build(boxes);
+    for (std::size_t i = 0; i < boxes.size(); i += 3) {
+        boxes[i] = AABB(boxes[i].Min + Vector3(30.0f, -20.0f, 5.0f), boxes[i].Max + Vector3(30.0f, -20.0f, 5.0f));
+    }
+    bvh.Refit(boxes);
+    for (const AABB& box : boxes) {
+        EXPECT_TRUE(bvh.Bounds().Contains(box.Min));
+        EXPECT_TRUE(bvh.Bounds().Contains(box.Max));
+    }
+
+    AABB query(Vector3(0.0f, -40.0f, -20.0f), Vector3(60.0f, 0.0f, 30.0f));
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); ++i) if (boxes[i].Intersects(query)) expected.push_back(i);
+    std::vector<std::size_t> actual;
+    bvh.QueryBox(query, actual);
+    EXPECT_EQ(Sorted(actual), expected);
+
+    bvh.Build({});
+    EXPECT_TRUE(bvh.Empty());
+    actual.clear();
+    bvh.QueryBox(query, actual);
+    EXPECT_TRUE(actual.empty());
+}
@@ -0,0 +1,106 @@
+// JsonStreamReaderTest.cc
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "JsonStreamReader.h"
+
+// 테스트 케이스 1: LinearSegmentDTO.json의 expected_input 형식
+TEST(JsonStreamReaderTest, ReadsLinearSegmentDtoShape) {
+    std::istringstream in(R"({
+        "expected_input": {
+            "vertex1": {
+                "node": { "index": 3, "vec": [1.0, 2.0, 3.0] },
+                "bearings": {
+                    "bearing1": { "force": [0.5, 0.0, 0.0], "vec": [0.0, 1.0, 0.0] },
+                    "bearing2": { "force": [0.0, 2.0, 0.0], "vec": [1.0, 0.0, 0.0] }
+                }
+            },
+            "vertex2": {
+                "node": { "index": 4, "vec": [-1, 0, 5] },
+                "bearings": { "bearing1": { "force": [1.0, 1.0, 1.0], "vec": [0.0, 0.0, 1.0] } }
+            }
+        },
+        "expected_output": { "polygon_vertexs": { "vertex1": [0.0, 0.0, 0.0], "...": [] } }
+    })");
+
+    std::vector<std::unique_ptr<Vertex>> vertices;
+    JsonStreamReader::ReadVertices(in, vertices);
+
+    ASSERT_EQ(vertices.size(), 2);
+    EXPECT_EQ(vertices[0]->ReadNodeVector().Index, 3);
+    EXPECT_EQ(vertices[0]->ReadNodeVector().Vector, Vector3(1.0f, 2.0f, 3.0f));
+    ASSERT_EQ(vertices[0]->ReadBearingVectorList().size(), 2);
+    EXPECT_EQ(vertices[0]->ReadBearingVectorList()[1].Force, Vector3(0.0f, 2.0f, 0.0f));
+    EXPECT_EQ(vertices[0]->ReadBearingVectorList()[1].Vector, Vector3(1.0f, 0.0f, 0.0f));
+
+    // 정점의 노드를 베어링의 노드로 사용
+    EXPECT_EQ(vertices[0]->ReadBearingVectorList()[0].Node.Index, 3);
+    EXPECT_EQ(vertices[1]->ReadNodeVector().Vector, Vector3(-1.0f, 0.0f, 5.0f));
+    EXPECT_EQ(vertices[1]->ReadBearingVectorList().size(), 1);
+}
+
+// 테스트 케이스 2: toJson 형식은 fromJson과 같은 결과
+TEST(JsonStreamReaderTest, MatchesFromJsonForEntityShapes) {
+    NodeVector node(5, Vector3(1.5f, -2.0f, 0.25f));
+    std::vector<BearingVector> expected = {
+        BearingVector(node, Vector3(1.0f, 2.0f, 3.0f), Vector3(0.0f, 0.0f, 1.0f)),
+        BearingVector(NodeVector(6, Vector3(0.0f, 1.0f, 0.0f)), Vector3(-1.0f, 0.0f, 0.5f), Vector3(1.0f, 1.0f, 0.0f)),
+    };
+    json array = json::array();
+    for (const auto& bearing : expected) {
+        array.push_back(bearing.toJson());
+    }
+
+    std::vector<BearingVector> bearings;
+    JsonStreamReader::ReadBearings(array.dump(), bearings);
+    ASSERT_EQ(bearings.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        BearingVector reference = BearingVector::fromJson(array[i]);
+        EXPECT_EQ(bearings[i].Node.Index, reference.Node.Index);
+        EXPECT_EQ(bearings[i].Node.Vector, reference.Node.Vector);
+        EXPECT_EQ(bearings[i].Force, reference.Force);
+        EXPECT_EQ(bearings[i].Vector, reference.Vector);
+    }
+
+    std::vector<NodeVector> nodes;
+    JsonStreamReader::ReadNodes(json::array({node.toJson(), NodeVector(0, Vector3()).toJson()}).dump(), nodes);
+    ASSERT_EQ(nodes.size(), 2);
+    EXPECT_EQ(nodes[0].Index, 5);
+    EXPECT_EQ(nodes[0].Vector, node.Vector);
+}
+
+// 테스트 케이스 3: 잘못된 입력은 예외
+TEST(JsonStreamReaderTest, RejectsMalformedInput) {
+    std::vector<std::unique_ptr<Vertex>> vertices;
+    std::vector<NodeVector> nodes;
+
+    // 구문 오류
+    EXPECT_THROW(JsonStreamReader::ReadNodes(std::string(R"([{"index": 1, "vec": [0, 0, 0]})"), nodes), std::runtime_error);
+    // 성분 누락
+    EXPECT_THROW(JsonStreamReader::ReadNodes(std::string(R"([{"index": 1, "vec": [0, 0]}])"), nodes), std::runtime_error);
+    // 정수가 아닌 index
+    EXPECT_THROW(JsonStreamReader::ReadNodes(std::string(R"([{"index": 1.5, "vec": [0, 0, 0]}])"), nodes), std::runtime_error);
+    // 노드 없는 정점
+    EXPECT_THROW(JsonStreamReader::ReadVertices(std::string(R"({"vertex1": {"bearings": {}}})"), vertices), std::runtime_error);
+    // force 없는 베어링
+    EXPECT_THROW(JsonStreamReader::ReadVertices(
+        std::string(R"({"vertex1": {"node": {"index": 0, "vec": [0, 0, 0]}, "bearings": {"b": {"vec": [0, 0, 1]}}}})"), vertices),
+        std::runtime_error);
+}
+
+// 테스트 케이스 4: json/NodeVectorDTO.json, json/BearingVectorDTO.json 형식
+TEST(JsonStreamReaderTest, ReadsDtoWrappedArrays) {
+    std::vector<NodeVector> nodes;
+    JsonStreamReader::ReadNodes(std::string(R"({"expected_input": [{"index": 2, "vec": [0.0, 1.0, 0.0]}]})"), nodes);
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes[0].Index, 2);
+
+    std::vector<BearingVector> bearings;
+    JsonStreamReader::ReadBearings(std::string(R"({"expected_input": [{
+        "node": {"index": 2, "vec": [0.0, 1.0, 0.0]}, "force": [1.0, 0.0, 0.0], "vec": [0.0, 0.0, 1.0]
+    }]})"), bearings);
+    ASSERT_EQ(bearings.size(), 1);
+    EXPECT_EQ(bearings[0].Node.Vector, Vector3(0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(bearings[0].Vector, Vector3(0.0f, 0.0f, 1.0f));
+}
@@ -0,0 +1,206 @@
+// ObjectManagerTest.cc
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "ObjectManager.h"
+#include "LinearSegment.h"
+#include "Vertex.h"
+
+// 테스트 클래스 정의
+class ObjectManagerTest : public ::testing::Test {
+protected:
+    VertexHandle AddVertex(int i) {
+        NodeVector node(i, Vector3(static_cast<float>(i), std::sin(i * 0.5f), 0.0f));
+        Vertex vertex;
+        vertex.UpdateNodeVector(node);
+        vertex.PostBearingVector(BearingVector(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(1.0f, std::cos(i * 0.3f), 0.2f)));
+        return manager.CreateVertex(std::move(vertex));
+    }
+
+    // 현재 정점 값으로 새로 만든 세그먼트와 캐시가 같아야 함
+    void ExpectMatchesFresh(SegmentHandle handle) {
+        const SegmentEnds& ends = manager.GetSegmentEnds(handle);
+        const LinearSegment& segment = manager.GetLinearSegment(handle);
+        EXPECT_EQ(&segment.GetStartVertex(), manager.FindVertex(ends.Start));
+        EXPECT_EQ(&segment.GetEndVertex(), manager.FindVertex(ends.End));
+
+        LinearSegment fresh(manager.GetVertex(ends.Start), manager.GetVertex(ends.End), 0.5f, 20);
+        const std::vector<Vector3>& expected = *fresh.GetLinearSegmentCache();
+        std::shared_ptr<const std::vector<Vector3>> actual = segment.GetLinearSegmentCache();
+        ASSERT_EQ(actual->size(), expected.size());
+        for (std::size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ((*actual)[k], expected[k]);
+        }
+    }
+
+    ObjectManager manager;
+};
+
+// 테스트 케이스 1: 정점 저장소가 커져도 세그먼트가 옮겨진 정점을 따라감
+TEST_F(ObjectManagerTest, SegmentsFollowVertexGrowth) {
+    std::vector<VertexHandle> vertices;
+    std::vector<SegmentHandle> segments;
+    for (int i = 0; i < 3; ++i) {
+        vertices.push_back(AddVertex(i));
+    }
+    segments.push_back(manager.CreateLinearSegment(vertices[0], vertices[1], 0.5f, 20));
+    segments.push_back(manager.CreateLinearSegment(vertices[1], vertices[2], 0.5f, 20));
+    for (int i = 3; i < 200; ++i) {
+        vertices.push_back(AddVertex(i));
+    }
+    EXPECT_EQ(manager.VertexCount(), 200u);
+    EXPECT_EQ(manager.LinearSegmentCount(), 2u);
+    for (SegmentHandle segment : segments) {
+        ExpectMatchesFresh(segment);
+    }
+
+    // 편집도 옮겨진 정점을 통해 반영됨
+    manager.GetVertex(vertices[1]).UpdateNodeVector(NodeVector(1, Vector3(1.0f, 5.0f, 0.0f)));
+    EXPECT_TRUE(manager.GetLinearSegment(segments[0]).IsStale());
+    for (SegmentHandle segment : segments) {
+        ExpectMatchesFresh(segment);
+    }
+}
+
+// 테스트 케이스 2: 정점 삭제는 그 정점을 쓰는 세그먼트도 삭제
+TEST_F(ObjectManagerTest, EraseVertexErasesDependents) {
+    std::vector<VertexHandle> vertices;
+    for (int i = 0; i < 5; ++i) {
+        vertices.push_back(AddVertex(i));
+    }
+    std::vector<SegmentHandle> segments;
+    for (int i = 0; i + 1 < 5; ++i) {
+        segments.push_back(manager.CreateLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20));
+    }
+    EXPECT_EQ(manager.SegmentsOf(vertices[2]).size(), 2u);
+
+    // 가운데 정점을 지우면 마지막 정점이 빈자리로 옮겨짐
+    EXPECT_TRUE(manager.EraseVertex(vertices[1]));
+    EXPECT_FALSE(manager.EraseVertex(vertices[1]));
+    EXPECT_FALSE(manager.ContainsVertex(vertices[1]));
+    EXPECT_FALSE(manager.ContainsLinearSegment(segments[0]));
+    EXPECT_FALSE(manager.ContainsLinearSegment(segments[1]));
+    EXPECT_EQ(manager.FindLinearSegment(segments[0]), nullptr);
+    EXPECT_EQ(manager.VertexCount(), 4u);
+    EXPECT_EQ(manager.LinearSegmentCount(), 2u);
+
+    EXPECT_TRUE(manager.SegmentsOf(vertices[0]).empty());
+    EXPECT_TRUE(manager.SegmentsOf(vertices[1]).empty());
+    EXPECT_EQ(manager.SegmentsOf(vertices[2]), std::vector<SegmentHandle>{segments[2]});
+    EXPECT_EQ(manager.SegmentsOf(vertices[4]), std::vector<SegmentHandle>{segments[3]});
+    ExpectMatchesFresh(segments[2]);
+    ExpectMatchesFresh(segments[3]);
+
+    EXPECT_THROW(manager.CreateLinearSegment(vertices[1], vertices[2]), std::invalid_argument);
+    EXPECT_THROW(manager.GetVertex(vertices[1]), std::out_of_range);
+    EXPECT_THROW(manager.GetSegmentEnds(segments[0]), std::out_of_range);
+    EXPECT_THROW(manager.GetLinearSegment(segments[0]), std::out_of_range);
+}
+
+// 테스트 케이스 3: 세그먼트 삭제는 인접 목록에서만 빠지고 정점은 유지
+TEST_F(ObjectManagerTest, EraseSegmentUpdatesAdjacency) {
+    VertexHandle a = AddVertex(0);
+    VertexHandle b = AddVertex(1);
+    VertexHandle c = AddVertex(2);
+    SegmentHandle ab = manager.CreateLinearSegment(a, b);
+    SegmentHandle bc = manager.CreateLinearSegment(b, c);
+    SegmentHandle ca = manager.CreateLinearSegment(c, a);
+    EXPECT_EQ(manager.SegmentsOf(b), (std::vector<SegmentHandle>{ab, bc}));
+
+    EXPECT_TRUE(manager.EraseLinearSegment(ab));
+    EXPECT_FALSE(manager.EraseLinearSegment(ab));
+    EXPECT_EQ(manager.SegmentsOf(a), std::vector<SegmentHandle>{ca});
+    EXPECT_EQ(manager.SegmentsOf(b), std::vector<SegmentHandle>{bc});
+    EXPECT_EQ(manager.VertexCount(), 3u);
+
+    // 새 세그먼트가 같은 슬롯을 써도 옛 핸들은 무효
+    SegmentHandle ba = manager.CreateLinearSegment(b, a);
+    EXPECT_EQ(ba.Index, ab.Index);
+    EXPECT_FALSE(manager.ContainsLinearSegment(ab));
+    EXPECT_EQ(manager.SegmentsOf(a), (std::vector<SegmentHandle>{ca, ba}));
+}
+
+// 테스트 케이스 4: 압축 후 핸들과 캐시가 유지되고 정점은 세그먼트 순서로 배치
+TEST_F(ObjectManagerTest, CompactKeepsHandlesAndRebinds) {
+    std::vector<VertexHandle> vertices;
+    for (int i = 0; i < 40; ++i) {
+        vertices.push_back(AddVertex(i));
+    }
+    // 정점 순서와 반대로 연결한 뒤 일부를 삭제
+    std::vector<SegmentHandle> segments;
+    for (int i = 39; i > 0; --i) {
+        segments.push_back(manager.CreateLinearSegment(vertices[i], vertices[i - 1], 0.5f, 20));
+    }
+    for (int i = 0; i < 40; i += 7) {
+        manager.EraseVertex(vertices[i]);
+    }
+    const std::size_t vertexCount = manager.VertexCount();
+    const std::size_t segmentCount = manager.LinearSegmentCount();
+
+    manager.Compact();
+    EXPECT_EQ(manager.VertexCount(), vertexCount);
+    EXPECT_EQ(manager.LinearSegmentCount(), segmentCount);
+
+    // 세그먼트 순서대로 정점을 순회하면 배열을 앞으로만 진행
+    std::size_t previous = 0;
+    for (std::size_t i = 0; i < manager.LinearSegmentCount(); ++i) {
+        SegmentHandle handle = manager.Segments().HandleAt(i);
+        std::size_t start = manager.Vertices().DenseIndex(manager.GetSegmentEnds(handle).Start);
+        EXPECT_GE(start, previous);
+        previous = start;
+    }
+
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+        if (manager.ContainsLinearSegment(segments[i])) {
+            ++live;
+            ExpectMatchesFresh(segments[i]);
+        }
+    }
+    EXPECT_EQ(live, segmentCount);
+    for (int i = 0; i < 40; ++i) {
+        EXPECT_EQ(manager.ContainsVertex(vertices[i]), i % 7 != 0);
+        if (i % 7 != 0) {
+            EXPECT_FLOAT_EQ(manager.GetVertex(vertices[i]).ReadNodeVector().Vector.x, static_cast<float>(i));
+        }
+    }
+}
+
+// 테스트 케이스 5: 세그먼트는 지연 생성되어 SegmentManager 의 병렬 테셀레이션과 공간 질의에 참여
+TEST_F(ObjectManagerTest, SegmentsShareSegmentManager) {
+    std::vector<VertexHandle> vertices;
+    for (int i = 0; i < 30; ++i) {
+        vertices.push_back(AddVertex(i));
+    }
+    std::vector<SegmentHandle> segments;
+    for (int i = 0; i + 1 < 30; ++i) {
+        segments.push_back(manager.CreateLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20));
+    }
+    SegmentManager& shared = manager.Segments();
+    EXPECT_EQ(shared.LinearSegmentCount(), 29u);
+    EXPECT_EQ(shared.CountDirty(), 29u);
+    EXPECT_TRUE(manager.GetLinearSegment(segments[3]).IsStale());
+    EXPECT_EQ(shared.TessellateDirty(), 29u);
+
+    // 질의 결과의 인덱스는 HandleAt 으로 핸들이 됨
+    Vector3 target = (*manager.GetLinearSegment(segments[12]).GetLinearSegmentCache())[7];
+    SegmentHit hit;
+    ASSERT_TRUE(shared.ClosestSegment(target + Vector3(0.0f, 0.0f, 0.1f), 1.0f, hit));
+    EXPECT_EQ(shared.HandleAt(hit.Segment), segments[12]);
+
+    // 삭제 후 인덱스가 바뀌어도 질의는 남은 세그먼트의 핸들로 이어짐
+    manager.EraseVertex(vertices[5]);
+    EXPECT_EQ(shared.LinearSegmentCount(), 27u);
+    ASSERT_TRUE(shared.ClosestSegment(target + Vector3(0.0f, 0.0f, 0.1f), 1.0f, hit));
+    EXPECT_EQ(shared.HandleAt(hit.Segment), segments[12]);
+    EXPECT_TRUE(shared.FindProximities(0.05f).empty());
+
+    // 정점 편집은 인접 세그먼트만 다시 계산
+    manager.GetVertex(vertices[20]).UpdateNodeVector(NodeVector(20, Vector3(20.0f, 3.0f, 0.0f)));
+    EXPECT_EQ(shared.TessellateDirty(), 2u);
+    ExpectMatchesFresh(segments[19]);
+    ExpectMatchesFresh(segments[20]);
+}
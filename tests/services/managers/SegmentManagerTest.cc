@@ -0,0 +1,311 @@
+// SegmentManagerTest.cc
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+#include "SegmentManager.h"
+#include "LinearSegment.h"
+#include "Vertex.h"
+
+// 테스트 클래스 정의
+class SegmentManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 곡선마다 다른 모양이 되도록 베어링을 배치
+        for (int i = 0; i < 41; ++i) {
+            NodeVector node(i, Vector3(static_cast<float>(i), std::sin(i * 0.5f), 0.0f));
+            vertices.emplace_back();
+            vertices.back().UpdateNodeVector(node);
+            vertices.back().PostBearingVector(BearingVector(node, Vector3(1.0f, 0.0f, 0.0f), Vector3(1.0f, std::cos(i * 0.3f), 0.2f)));
+        }
+    }
+
+    std::deque<Vertex> vertices; // 주소가 유지되어야 함
+};
+
+// 테스트 케이스 1: 추가만으로는 테셀레이션하지 않고, 병렬 결과는 직렬 결과와 동일
+TEST_F(SegmentManagerTest, ParallelMatchesSerial) {
+    TaskScheduler scheduler(4);
+    SegmentManager manager(scheduler, 3);
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        EXPECT_EQ(manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20), i);
+    }
+    EXPECT_EQ(manager.LinearSegmentCount(), 40u);
+    EXPECT_EQ(manager.CountDirty(), 40u);
+
+    EXPECT_EQ(manager.TessellateDirty(), 40u);
+    EXPECT_EQ(manager.CountDirty(), 0u);
+    EXPECT_EQ(manager.TessellateDirty(), 0u);
+
+    std::vector<Vector3> points;
+    std::vector<std::size_t> offsets;
+    manager.CollectVertices(points, offsets);
+    ASSERT_EQ(offsets.size(), 41u);
+    EXPECT_EQ(offsets.back(), points.size());
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        LinearSegment serial(vertices[i], vertices[i + 1], 0.5f, 20);
+        const std::vector<Vector3>& expected = *serial.GetLinearSegmentCache();
+        ASSERT_EQ(offsets[i + 1] - offsets[i], expected.size());
+        for (std::size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(points[offsets[i] + k], expected[k]);
+        }
+    }
+}
+
+// 테스트 케이스 2: 편집된 세그먼트만 다시 계산하고 비동기 배리어로 대기
+TEST_F(SegmentManagerTest, AsyncRebuildsOnlyDirtySegments) {
+    TaskScheduler scheduler(2);
+    SegmentManager manager(scheduler);
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        manager.AddLinearSegment(vertices[i], vertices[i + 1]);
+    }
+    std::shared_future<std::size_t> first = manager.TessellateDirtyAsync();
+    EXPECT_EQ(first.get(), 40u);
+    manager.Wait();
+    EXPECT_FALSE(manager.IsBusy());
+
+    // 세터는 즉시 재계산하지 않음 (deferred)
+    manager.GetLinearSegment(5).SetAlpha(0.25f);
+    vertices[20].UpdateNodeVector(NodeVector(20, Vector3(20.0f, 3.0f, 1.0f)));
+    EXPECT_EQ(manager.CountDirty(), 3u); // 5, 19, 20
+
+    manager.TessellateDirtyAsync();
+    manager.Wait();
+    EXPECT_EQ(manager.CountDirty(), 0u);
+    EXPECT_EQ(manager.GetLinearSegment(19).GetLinearSegmentCache()->back(), Vector3(20.0f, 3.0f, 1.0f));
+}
+
+// 테스트 케이스 3: 공간 질의는 전수 검사와 같고 편집 후 refit 으로 갱신
+TEST_F(SegmentManagerTest, SpatialQueriesFollowEdits) {
+    TaskScheduler scheduler(2);
+    SegmentManager manager(scheduler);
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20);
+    }
+
+    auto linearScan = [&](const AABB& query) {
+        std::vector<std::size_t> hits;
+        for (std::size_t i = 0; i < manager.LinearSegmentCount(); ++i) {
+            if (manager.GetLinearSegment(i).GetBounds().Intersects(query)) hits.push_back(i);
+        }
+        return hits;
+    };
+    auto sorted = [](std::vector<std::size_t> values) {
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+
+    AABB query(Vector3(9.5f, -5.0f, -5.0f), Vector3(12.5f, 5.0f, 5.0f));
+    EXPECT_EQ(sorted(manager.QueryBox(query)), linearScan(query));
+    EXPECT_EQ(manager.GetSpatialIndex().ItemCount(), 40u);
+
+    // 멀리 옮긴 정점은 refit 후 새 위치에서 찾음
+    vertices[30].UpdateNodeVector(NodeVector(30, Vector3(100.0f, 100.0f, 100.0f)));
+    std::vector<std::size_t> far = sorted(manager.QuerySphere(Vector3(100.0f, 100.0f, 100.0f), 0.5f));
+    EXPECT_EQ(far, (std::vector<std::size_t>{29, 30}));
+    EXPECT_EQ(sorted(manager.QueryBox(query)), linearScan(query));
+
+    // 광선: x 축을 따라 가장 가까운 세그먼트부터
+    std::vector<std::size_t> ray = manager.QueryRay(Vector3(-5.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), 8.0f);
+    ASSERT_FALSE(ray.empty());
+    EXPECT_EQ(ray.front(), 0u);
+
+    // 추가 후에는 다시 빌드
+    manager.AddLinearSegment(vertices[0], vertices[40]);
+    EXPECT_EQ(manager.GetSpatialIndex().ItemCount(), 41u);
+}
+
+// 테스트 케이스 4: BVH 를 통한 최근접/피킹 결과는 전체 세그먼트 전수 조사와 동일 (인덱스는 자동 갱신)
+TEST_F(SegmentManagerTest, PickAndClosestMatchBruteForce) {
+    TaskScheduler scheduler(2);
+    SegmentManager manager(scheduler);
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20);
+    }
+
+    const Vector3 points[] = {Vector3(12.3f, 2.0f, 0.5f), Vector3(-4.0f, 0.0f, 0.0f), Vector3(33.0f, -1.5f, -1.0f)};
+    for (const Vector3& q : points) {
+        float expected = 1e30f;
+        for (std::size_t i = 0; i < manager.LinearSegmentCount(); ++i) {
+            CurveHit hit;
+            if (manager.GetLinearSegment(i).ClosestPoint(q, 1e30f, hit)) expected = std::min(expected, hit.Distance);
+        }
+        SegmentHit hit;
+        ASSERT_TRUE(manager.ClosestSegment(q, 100.0f, hit));
+        EXPECT_FLOAT_EQ(hit.Hit.Distance, expected);
+        EXPECT_FALSE(manager.ClosestSegment(q, expected * 0.9f, hit));
+    }
+
+    // 곡선 근처를 지나는 광선 여러 개 (후보를 건너뛰는 경로까지 확인)
+    const Vector3 direction(-0.2f, -0.4f, -1.0f);
+    std::vector<Vector3> origins{Vector3(20.0f, 5.0f, 10.0f)};
+    for (std::size_t segment : {7u, 22u, 33u}) {
+        Vector3 p = (*manager.GetLinearSegment(segment).GetLinearSegmentCache())[5];
+        origins.push_back(p + Vector3(0.3f, -0.2f, 0.0f) - direction * 12.0f);
+    }
+    for (const Vector3& origin : origins) {
+        float expected = 1e30f;
+        std::size_t expectedSegment = 0;
+        for (std::size_t i = 0; i < manager.LinearSegmentCount(); ++i) {
+            CurveHit hit;
+            if (manager.GetLinearSegment(i).PickRay(origin, direction, 1e30f, hit) && hit.Distance < expected) {
+                expected = hit.Distance;
+                expectedSegment = i;
+            }
+        }
+        SegmentHit pick;
+        ASSERT_TRUE(manager.PickSegment(origin, direction, 5.0f, pick));
+        EXPECT_EQ(pick.Segment, expectedSegment);
+        EXPECT_FLOAT_EQ(pick.Hit.Distance, expected);
+        EXPECT_FALSE(manager.PickSegment(origin, direction, expected * 0.9f, pick));
+    }
+
+    // 편집이나 추가 후에도 UpdateSpatialIndex 호출 없이 새 위치에서 찾음
+    vertices[30].UpdateNodeVector(NodeVector(30, Vector3(100.0f, 100.0f, 100.0f)));
+    SegmentHit moved;
+    ASSERT_TRUE(manager.ClosestSegment(Vector3(100.0f, 100.0f, 100.0f), 1e-3f, moved));
+    EXPECT_TRUE(moved.Segment == 29u || moved.Segment == 30u);
+
+    std::deque<Vertex> extra(2);
+    extra[0].UpdateNodeVector(NodeVector(0, Vector3(-50.0f, 0.0f, 0.0f)));
+    extra[1].UpdateNodeVector(NodeVector(1, Vector3(-50.0f, 10.0f, 0.0f)));
+    std::size_t added = manager.AddLinearSegment(extra[0], extra[1], 0.5f, 20);
+    ASSERT_TRUE(manager.ClosestSegment(Vector3(-50.0f, 5.0f, 1.0f), 2.0f, moved));
+    EXPECT_EQ(moved.Segment, added);
+    ASSERT_TRUE(manager.PickSegment(Vector3(-50.0f, 5.0f, 10.0f), Vector3(0.0f, 0.0f, -1.0f), 0.5f, moved));
+    EXPECT_EQ(moved.Segment, added);
+}
+
+// 테스트 케이스 5: 근접 검출은 모든 쌍 전수 조사와 같고, 병렬/직렬 결과가 동일
+TEST_F(SegmentManagerTest, ProximitiesMatchBruteForce) {
+    // 체인 세그먼트, 체인 위의 점을 중점으로 지나는 직선 세그먼트, 체인 근처를 지나는 꺾은선
+    LinearSegment probe(vertices[10], vertices[11], 0.5f, 20);
+    Vector3 p = (*probe.GetLinearSegmentCache())[8];
+    std::deque<Vertex> crossing;
+    const Vector3 positions[] = {p + Vector3(0.2f, 0.0f, -2.0f), p - Vector3(0.2f, 0.0f, -2.0f),
+                                 Vector3(20.5f, -2.0f, 0.1f), Vector3(24.5f, 2.0f, 0.3f), Vector3(28.5f, -2.0f, 0.0f)};
+    for (int i = 0; i < 5; ++i) {
+        crossing.emplace_back();
+        crossing.back().UpdateNodeVector(NodeVector(100 + i, positions[i]));
+    }
+
+    auto build = [&](SegmentManager& manager) {
+        for (std::size_t i = 0; i + 1 < vertices.size(); ++i) manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20);
+        manager.AddLinearSegment(crossing[0], crossing[1], 0.5f, 20);
+        for (std::size_t i = 2; i + 1 < crossing.size(); ++i) manager.AddLinearSegment(crossing[i], crossing[i + 1], 0.5f, 20);
+    };
+    TaskScheduler parallel(4);
+    TaskScheduler serial(1);
+    SegmentManager manager(parallel, 2);
+    SegmentManager reference(serial);
+    build(manager);
+    build(reference);
+
+    const float clearance = 0.3f;
+    std::vector<SegmentProximity> found = manager.FindProximities(clearance);
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t a = 0; a < manager.LinearSegmentCount(); ++a) {
+        for (std::size_t b = a + 1; b < manager.LinearSegmentCount(); ++b) {
+            const LinearSegment& segmentA = manager.GetLinearSegment(a);
+            const LinearSegment& segmentB = manager.GetLinearSegment(b);
+            CurvePairHit hit;
+            if (!segmentA.SharesVertex(segmentB) && segmentA.ClosestPair(segmentB, clearance, hit)) expected.emplace_back(a, b);
+        }
+    }
+    ASSERT_EQ(found.size(), expected.size());
+    ASSERT_FALSE(found.empty());
+    bool crossed = false;
+    for (std::size_t i = 0; i < found.size(); ++i) {
+        EXPECT_EQ(found[i].SegmentA, expected[i].first);
+        EXPECT_EQ(found[i].SegmentB, expected[i].second);
+        EXPECT_LE(found[i].Hit.Distance, clearance);
+        crossed = crossed || found[i].Hit.Distance < 1e-3f;
+    }
+    EXPECT_TRUE(crossed);
+
+    std::vector<SegmentProximity> serialFound = reference.FindProximities(clearance);
+    ASSERT_EQ(serialFound.size(), found.size());
+    for (std::size_t i = 0; i < found.size(); ++i) {
+        EXPECT_EQ(serialFound[i].SegmentB, found[i].SegmentB);
+        EXPECT_EQ(serialFound[i].Hit.Distance, found[i].Hit.Distance);
+    }
+
+    // 인접 쌍을 포함하면 체인의 이웃은 공유 정점에서 거리 0
+    std::vector<SegmentProximity> withAdjacent = manager.FindProximities(clearance, false);
+    EXPECT_GE(withAdjacent.size(), found.size() + 39u);
+}
+
+// 테스트 케이스 6: 핸들은 삭제/재배치 후에도 같은 세그먼트를, 삭제된 핸들은 무효
+TEST_F(SegmentManagerTest, HandlesSurviveEraseAndReorder) {
+    TaskScheduler scheduler(2);
+    SegmentManager manager(scheduler);
+    for (std::size_t i = 0; i < 5; ++i) {
+        manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20);
+    }
+    std::vector<SegmentHandle> handles;
+    for (std::size_t i = 0; i < 5; ++i) {
+        handles.push_back(manager.HandleAt(i));
+    }
+    LinearSegment* last = manager.FindLinearSegment(handles[4]);
+
+    // 마지막 세그먼트가 지운 자리로 이동
+    EXPECT_TRUE(manager.EraseLinearSegment(handles[1]));
+    EXPECT_FALSE(manager.EraseLinearSegment(handles[1]));
+    EXPECT_FALSE(manager.ContainsLinearSegment(handles[1]));
+    EXPECT_EQ(manager.FindLinearSegment(handles[1]), nullptr);
+    EXPECT_THROW(manager.IndexOf(handles[1]), std::out_of_range);
+    EXPECT_EQ(manager.IndexOf(handles[4]), 1u);
+    EXPECT_EQ(&manager.GetLinearSegment(1), last);
+    EXPECT_THROW(manager.GetLinearSegment(4), std::out_of_range);
+
+    manager.ReorderLinearSegments({3, 2, 1, 0});
+    EXPECT_EQ(manager.IndexOf(handles[4]), 2u);
+    EXPECT_EQ(manager.FindLinearSegment(handles[4]), last);
+    EXPECT_EQ(&manager.GetLinearSegment(3).GetStartVertex(), &vertices[0]);
+
+    // 공간 인덱스는 새 인덱스로 다시 만들어짐
+    EXPECT_EQ(manager.GetSpatialIndex().ItemCount(), 4u);
+    Vector3 target = (*last->GetLinearSegmentCache())[10];
+    SegmentHit hit;
+    ASSERT_TRUE(manager.ClosestSegment(target, 1e-3f, hit));
+    EXPECT_EQ(manager.HandleAt(hit.Segment), handles[4]);
+}
+
+// 테스트 케이스 7: 인덱스 밖에서 다시 계산된 세그먼트도 refit 후 질의에 반영
+TEST_F(SegmentManagerTest, SpatialIndexFollowsExternalRebuilds) {
+    TaskScheduler scheduler(2);
+    SegmentManager manager(scheduler);
+    for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+        manager.AddLinearSegment(vertices[i], vertices[i + 1], 0.5f, 20);
+    }
+    EXPECT_EQ(manager.GetSpatialIndex().ItemCount(), 40u);
+
+    auto sorted = [](std::vector<std::size_t> values) {
+        std::sort(values.begin(), values.end());
+        return values;
+    };
+    const AABB nearA(Vector3(99.0f, 99.0f, 99.0f), Vector3(101.0f, 101.0f, 101.0f));
+    const AABB nearB(Vector3(-101.0f, 99.0f, 99.0f), Vector3(-99.0f, 101.0f, 101.0f));
+    const AABB nearC(Vector3(99.0f, -101.0f, 99.0f), Vector3(101.0f, -99.0f, 101.0f));
+
+    // 동기 테셀레이션
+    vertices[10].UpdateNodeVector(NodeVector(10, Vector3(100.0f, 100.0f, 100.0f)));
+    EXPECT_EQ(manager.TessellateDirty(), 2u);
+    EXPECT_EQ(sorted(manager.QueryBox(nearA)), (std::vector<std::size_t>{9, 10}));
+
+    // 비동기 테셀레이션
+    vertices[20].UpdateNodeVector(NodeVector(20, Vector3(-100.0f, 100.0f, 100.0f)));
+    EXPECT_EQ(manager.TessellateDirtyAsync().get(), 2u);
+    EXPECT_EQ(sorted(manager.QueryBox(nearB)), (std::vector<std::size_t>{19, 20}));
+
+    // 조회 시 갱신
+    vertices[30].UpdateNodeVector(NodeVector(30, Vector3(100.0f, -100.0f, 100.0f)));
+    manager.GetLinearSegment(29).GetLinearSegmentCache();
+    manager.GetLinearSegment(30).GetLinearSegmentCache();
+    EXPECT_EQ(manager.CountDirty(), 0u);
+    EXPECT_EQ(sorted(manager.QueryBox(nearC)), (std::vector<std::size_t>{29, 30}));
+}
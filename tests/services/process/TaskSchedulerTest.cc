@@ -0,0 +1,83 @@
+// TaskSchedulerTest.cc
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "thread.h"
+
+// 테스트 케이스 1: Submit 결과와 예외는 future 로 전달
+TEST(TaskSchedulerTest, SubmitDeliversResultsAndExceptions) {
+    TaskScheduler scheduler(3);
+    EXPECT_EQ(scheduler.Size(), 3u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 64; ++i) results.push_back(scheduler.Submit([i]() { return i + 1; }));
+    for (int i = 0; i < 64; ++i) EXPECT_EQ(results[i].get(), i + 1);
+
+    std::future<void> failing = scheduler.Submit([]() { throw std::runtime_error("task"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+// 테스트 케이스 2: ParallelFor 는 모든 인덱스를 정확히 한 번 처리하고 예외를 전달
+TEST(TaskSchedulerTest, ParallelForCoversEveryIndexOnce) {
+    TaskScheduler scheduler(4);
+    for (std::size_t grain : {0u, 1u, 7u, 5000u}) {
+        const std::size_t count = 1003;
+        std::vector<std::atomic<int>> hits(count);
+        scheduler.ParallelFor(count, grain, [&](std::size_t begin, std::size_t end) {
+            if (grain != 0) {
+                EXPECT_LE(end - begin, grain);
+            }
+            for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1);
+        });
+        for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(hits[i].load(), 1);
+    }
+
+    scheduler.ParallelFor(0, 4, [](std::size_t, std::size_t) { FAIL(); });
+    EXPECT_THROW(scheduler.ParallelFor(100, 10, [](std::size_t begin, std::size_t) {
+        if (begin >= 50) throw std::runtime_error("piece");
+    }), std::runtime_error);
+}
+
+// 테스트 케이스 3: 중첩 TaskGroup 은 워커가 적어도 교착되지 않음
+TEST(TaskSchedulerTest, NestedGroupsDoNotDeadlock) {
+    TaskScheduler scheduler(2);
+    std::function<long(int)> fib = [&](int n) -> long {
+        if (n < 12) return n < 2 ? n : fib(n - 1) + fib(n - 2);
+        long a = 0, b = 0;
+        TaskGroup group(scheduler);
+        group.Run([&]() { a = fib(n - 1); });
+        b = fib(n - 2);
+        group.Wait();
+        return a + b;
+    };
+    std::future<long> result = scheduler.Submit([&]() { return fib(24); });
+    EXPECT_EQ(result.get(), 46368);
+    EXPECT_EQ(fib(20), 6765); // 외부 스레드에서 대기
+}
+
+// 테스트 케이스 4: Then 은 그룹이 유휴 상태가 된 뒤 실행되고 Wait 에 포함됨
+TEST(TaskSchedulerTest, ContinuationRunsAfterGroup) {
+    TaskScheduler scheduler(3);
+    TaskGroup group(scheduler);
+    std::atomic<int> finished{0};
+    std::atomic<int> seenByContinuation{-1};
+    for (int i = 0; i < 32; ++i) {
+        group.Run([&]() { finished.fetch_add(1); });
+    }
+    group.Then([&]() { seenByContinuation = finished.load(); });
+    group.Wait();
+    EXPECT_TRUE(group.Done());
+    EXPECT_EQ(seenByContinuation.load(), 32);
+
+    // 유휴 그룹의 Then 은 즉시 예약되고, 작업 예외는 Wait 에서 한 번만 전달
+    std::atomic<bool> ran{false};
+    group.Then([&]() { ran = true; });
+    group.Run([]() { throw std::logic_error("member"); });
+    EXPECT_THROW(group.Wait(), std::logic_error);
+    EXPECT_TRUE(ran.load());
+    EXPECT_NO_THROW(group.Wait());
+}
@@ -0,0 +1,56 @@
+// ThreadPoolTest.cc
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "thread.h"
+
+// 테스트 케이스 1: Submit 결과와 예외는 future 로 전달
+TEST(ThreadPoolTest, SubmitDeliversResultsAndExceptions) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.Size(), 2u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 16; ++i) results.push_back(pool.Submit([i]() { return i * i; }));
+    for (int i = 0; i < 16; ++i) EXPECT_EQ(results[i].get(), i * i);
+
+    std::future<void> failing = pool.Submit([]() { throw std::runtime_error("task"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+// 테스트 케이스 2: ParallelFor 는 모든 인덱스를 정확히 한 번, 연속 청크로 처리
+TEST(ThreadPoolTest, ParallelForCoversEveryIndexOnce) {
+    ThreadPool pool(4);
+    const std::size_t count = 1003;
+    std::vector<std::atomic<int>> hits(count);
+    std::atomic<int> chunks{0};
+    pool.ParallelFor(count, 16, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(begin % 16, 0u);
+        EXPECT_LE(end - begin, 16u);
+        for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1);
+        chunks.fetch_add(1);
+    });
+    for (std::size_t i = 0; i < count; ++i) EXPECT_EQ(hits[i].load(), 1);
+    EXPECT_EQ(chunks.load(), 63);
+
+    // 빈 범위와 예외 전달
+    pool.ParallelFor(0, 16, [](std::size_t, std::size_t) { FAIL(); });
+    EXPECT_THROW(pool.ParallelFor(100, 10, [](std::size_t begin, std::size_t) {
+        if (begin == 50) throw std::runtime_error("chunk");
+    }), std::runtime_error);
+}
+
+// 테스트 케이스 3: 워커 안에서 ParallelFor 를 호출해도 교착되지 않음
+TEST(ThreadPoolTest, NestedParallelForDoesNotDeadlock) {
+    ThreadPool pool(1);
+    std::atomic<int> sum{0};
+    std::future<void> outer = pool.Submit([&]() {
+        pool.ParallelFor(64, 4, [&](std::size_t begin, std::size_t end) {
+            sum.fetch_add(static_cast<int>(end - begin));
+        });
+    });
+    outer.get();
+    EXPECT_EQ(sum.load(), 64);
+}